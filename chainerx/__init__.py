@@ -28,6 +28,9 @@ if _available:
 
     from chainerx._core import *  # NOQA
     from chainerx._core import _to_cupy  # NOQA
+    # NumPy has no bfloat16. This is the scalar type of ml_dtypes if it is
+    # installed, and a dtype object of ChainerX otherwise.
+    from chainerx._core import bfloat16  # NOQA
 
     from builtins import bool, int, float  # NOQA
 
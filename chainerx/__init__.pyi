@@ -84,7 +84,9 @@ def check_backward(
         eps: tp.List[ndarray],
         atol: float=...,
         rtol: float=...,
-        backprop_id: tp.Optional[BackpropId]=None) -> None: ...
+        backprop_id: tp.Optional[BackpropId]=None,
+        elementwise: bool=...,
+        parallel: bool=...) -> None: ...
 
 
 def check_double_backward(
@@ -95,7 +97,9 @@ def check_double_backward(
         eps: tp.List[ndarray],
         atol: float=...,
         rtol: float=...,
-        backprop_id: tp.Optional[BackpropId]=None) -> None: ...
+        backprop_id: tp.Optional[BackpropId]=None,
+        elementwise: bool=...,
+        parallel: bool=...) -> None: ...
 
 
 # chainerx_cc/chainerx/python/context.cc
@@ -189,6 +193,22 @@ class DeviceScope:
     def device(self) -> Device: ...
 
 
+# chainerx_cc/chainerx/python/dtype.cc
+class _BFloat16Dtype:
+    @property
+    def name(self) -> str: ...
+
+    @property
+    def itemsize(self) -> int: ...
+
+    @property
+    def kind(self) -> str: ...
+
+
+# The scalar type of ml_dtypes if it is installed, _BFloat16Dtype otherwise.
+bfloat16: tp.Any
+
+
 # chainerx_cc/chainerx/python/error.cc
 class BackendError(Exception): ...
 
@@ -476,6 +496,19 @@ def abs(x: ndarray) -> ndarray: ...
 def absolute_error(x1: ndarray, x2: ndarray) -> ndarray: ...
 
 
+def adam_update(
+        params: tp.List[ndarray],
+        grads: tp.List[ndarray],
+        ms: tp.List[ndarray],
+        vs: tp.List[ndarray],
+        t: int,
+        alpha: tp.Any=...,
+        beta1: tp.Any=...,
+        beta2: tp.Any=...,
+        eps: tp.Any=...,
+        weight_decay_rate: tp.Any=...) -> None: ...
+
+
 def add(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
@@ -813,6 +846,14 @@ def maximum(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 def minimum(x1: tp.Any, x2: tp.Any) -> ndarray: ...
 
 
+def momentum_sgd_update(
+        params: tp.List[ndarray],
+        grads: tp.List[ndarray],
+        velocities: tp.List[ndarray],
+        lr: tp.Any,
+        momentum: tp.Any) -> None: ...
+
+
 def moveaxis(a: ndarray, source: tp.Union[int, tp.Tuple[int, ...]],
              destination: tp.Union[int, tp.Tuple[int, ...]]) -> ndarray: ...
 
@@ -842,6 +883,12 @@ def reshape(
 @tp.overload
 def reshape(a: ndarray, *args: tp.Any) -> ndarray: ...
 
+def sgd_update(
+        params: tp.List[ndarray],
+        grads: tp.List[ndarray],
+        lr: tp.Any) -> None: ...
+
+
 def sign(x: ndarray) -> ndarray: ...
 
 def sin(x: ndarray) -> ndarray: ...
@@ -856,6 +903,12 @@ def softmax(
         x: ndarray,
         axis: tp.Optional[tp.Union[int, tp.List[int]]]=None) -> ndarray: ...
 
+def softmax_cross_entropy(
+        x: ndarray,
+        t: ndarray,
+        class_weight: tp.Optional[ndarray]=None,
+        ignore_label: int=-1) -> ndarray: ...
+
 def split(
         ary: ndarray,
         indices_or_sections: tp.Union[int, tp.List[int]],
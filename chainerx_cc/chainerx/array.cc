@@ -47,6 +47,7 @@
 #include "chainerx/routines/routines_util.h"
 #include "chainerx/routines/sorting.h"
 #include "chainerx/routines/statistics.h"
+#include "chainerx/row_sparse_grad.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -241,21 +242,37 @@ const Array& Array::operator^=(Scalar rhs) const {
     return *this;
 }
 
-Array Array::operator+(const Array& rhs) const { return chainerx::Add(*this, rhs); }
+Array Array::operator+(const Array& rhs) const& { return chainerx::Add(*this, rhs); }
 
-Array Array::operator+(Scalar rhs) const { return chainerx::Add(*this, rhs); }
+Array Array::operator+(Scalar rhs) const& { return chainerx::Add(*this, rhs); }
 
-Array Array::operator-(const Array& rhs) const { return chainerx::Subtract(*this, rhs); }
+Array Array::operator-(const Array& rhs) const& { return chainerx::Subtract(*this, rhs); }
 
-Array Array::operator-(Scalar rhs) const { return chainerx::Subtract(*this, rhs); }
+Array Array::operator-(Scalar rhs) const& { return chainerx::Subtract(*this, rhs); }
 
-Array Array::operator*(const Array& rhs) const { return Multiply(*this, rhs); }
+Array Array::operator*(const Array& rhs) const& { return Multiply(*this, rhs); }
 
-Array Array::operator*(Scalar rhs) const { return Multiply(*this, rhs); }
+Array Array::operator*(Scalar rhs) const& { return Multiply(*this, rhs); }
 
-Array Array::operator/(const Array& rhs) const { return chainerx::Divide(*this, rhs); }
+Array Array::operator/(const Array& rhs) const& { return chainerx::Divide(*this, rhs); }
 
-Array Array::operator/(Scalar rhs) const { return chainerx::Divide(*this, rhs); }
+Array Array::operator/(Scalar rhs) const& { return chainerx::Divide(*this, rhs); }
+
+Array Array::operator+(const Array& rhs) && { return chainerx::Add(std::move(*this), rhs); }
+
+Array Array::operator+(Scalar rhs) && { return chainerx::Add(std::move(*this), rhs); }
+
+Array Array::operator-(const Array& rhs) && { return chainerx::Subtract(std::move(*this), rhs); }
+
+Array Array::operator-(Scalar rhs) && { return chainerx::Subtract(std::move(*this), rhs); }
+
+Array Array::operator*(const Array& rhs) && { return Multiply(std::move(*this), rhs); }
+
+Array Array::operator*(Scalar rhs) && { return Multiply(std::move(*this), rhs); }
+
+Array Array::operator/(const Array& rhs) && { return chainerx::Divide(std::move(*this), rhs); }
+
+Array Array::operator/(Scalar rhs) && { return chainerx::Divide(std::move(*this), rhs); }
 
 Array Array::operator&(const Array& rhs) const { return chainerx::BitwiseAnd(*this, rhs); }
 
@@ -328,6 +345,10 @@ Array Array::ToDevice(Device& dst_device) const {
     } else {
         // Make a contiguous copy to transfer it to the destination device.
         Array src_contig = AsContiguous(AsGradStopped(CopyKind::kView));
+        // Kernels may be running asynchronously on native devices, whose memory is read by other backends without synchronization.
+        if (src_device.backend().IsNative()) {
+            src_device.Synchronize();
+        }
 
         std::shared_ptr<void> dst_data;
         if (src_device.backend().SupportsTransfer(src_device, dst_device)) {
@@ -360,8 +381,12 @@ Array Array::ToDevice(Device& dst_device) const {
 
 Array Array::ToNative() const {
     Backend& backend = device().backend();
-    Device& native_device = backend.IsNative() ? device() : backend.context().GetNativeBackend().GetDevice(0);
-    return ToDevice(native_device);
+    if (backend.IsNative()) {
+        // The data is read on the host after kernels running asynchronously are finished.
+        device().Synchronize();
+        return ToDevice(device());
+    }
+    return ToDevice(backend.context().GetNativeBackend().GetDevice(0));
 }
 
 namespace {
@@ -421,11 +446,22 @@ const nonstd::optional<Array>& Array::GetGrad(const nonstd::optional<BackpropId>
     if (!IsGradRequired(actual_backprop_id)) {
         throw ChainerxError{"Array is not flagged as requiring gradient for backprop id: '", actual_backprop_id, "'."};
     }
+    body_->DensifyGrad(actual_backprop_id);
     const nonstd::optional<Array>* grad = body_->GetGrad(actual_backprop_id);
     CHAINERX_ASSERT(grad != nullptr);
     return *grad;
 }
 
+const nonstd::optional<RowSparseGrad>& Array::GetRowSparseGrad(const nonstd::optional<BackpropId>& backprop_id) const {
+    static const nonstd::optional<RowSparseGrad> kNullRowSparseGrad{};
+    BackpropId actual_backprop_id = internal::GetArrayBackpropId(*this, backprop_id);
+    if (!IsGradRequired(actual_backprop_id)) {
+        throw ChainerxError{"Array is not flagged as requiring gradient for backprop id: '", actual_backprop_id, "'."};
+    }
+    const nonstd::optional<RowSparseGrad>* sparse_grad = body_->GetRowSparseGrad(actual_backprop_id);
+    return sparse_grad != nullptr ? *sparse_grad : kNullRowSparseGrad;
+}
+
 void Array::SetGrad(Array grad, const nonstd::optional<BackpropId>& backprop_id) const {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(*this, backprop_id);
     nonstd::optional<Array>* target_grad = body_->GetGrad(actual_backprop_id);
@@ -436,7 +472,7 @@ void Array::SetGrad(Array grad, const nonstd::optional<BackpropId>& backprop_id)
     // Setting the gradient flags the array to require gradient, so that it can return the gradient with GetGrad().
     RequireGrad(actual_backprop_id);
 
-    internal::SetGrad(*target_grad, std::move(grad), shape(), dtype(), device());
+    body_->SetGrad(std::move(grad), actual_backprop_id);
 }
 
 void Array::ClearGrad(const nonstd::optional<BackpropId>& backprop_id) const {
@@ -453,7 +489,7 @@ bool Array::IsBackpropRequired(const nonstd::optional<BackpropId>& backprop_id)
 }
 
 bool Array::IsBackpropRequired(AnyGraph /*any_graph*/) const {
-    const std::vector<std::shared_ptr<internal::ArrayNode>>& array_nodes = body_->nodes();
+    internal::ArrayBody::ArrayNodeRange array_nodes = body_->nodes();
     return std::any_of(array_nodes.begin(), array_nodes.end(), [](const std::shared_ptr<const internal::ArrayNode>& array_node) {
         return chainerx::IsBackpropRequired(array_node->backprop_id());
     });
@@ -29,6 +29,9 @@
 #include "chainerx/strides.h"
 
 namespace chainerx {
+
+class RowSparseGrad;
+
 namespace internal {
 
 BackpropId GetArrayBackpropId(const Array& array, const nonstd::optional<BackpropId>& backprop_id);
@@ -106,14 +109,25 @@ public:
     const Array& operator^=(const Array& rhs) const;
     const Array& operator^=(Scalar rhs) const;
 
-    Array operator+(const Array& rhs) const;
-    Array operator+(Scalar rhs) const;
-    Array operator-(const Array& rhs) const;
-    Array operator-(Scalar rhs) const;
-    Array operator*(const Array& rhs) const;
-    Array operator*(Scalar rhs) const;
-    Array operator/(const Array& rhs) const;
-    Array operator/(Scalar rhs) const;
+    Array operator+(const Array& rhs) const&;
+    Array operator+(Scalar rhs) const&;
+    Array operator-(const Array& rhs) const&;
+    Array operator-(Scalar rhs) const&;
+    Array operator*(const Array& rhs) const&;
+    Array operator*(Scalar rhs) const&;
+    Array operator/(const Array& rhs) const&;
+    Array operator/(Scalar rhs) const&;
+
+    // Overloads for temporaries, which may write the output into the buffer of this array.
+    // See the rvalue overloads of Add, Subtract, Multiply and Divide.
+    Array operator+(const Array& rhs) &&;
+    Array operator+(Scalar rhs) &&;
+    Array operator-(const Array& rhs) &&;
+    Array operator-(Scalar rhs) &&;
+    Array operator*(const Array& rhs) &&;
+    Array operator*(Scalar rhs) &&;
+    Array operator/(const Array& rhs) &&;
+    Array operator/(Scalar rhs) &&;
     Array operator&(const Array& rhs) const;
     Array operator&(Scalar rhs) const;
     Array operator|(const Array& rhs) const;
@@ -225,12 +239,22 @@ public:
     void Fill(Scalar value) const;
 
     // Returns the gradient of the array.
+    // If the gradient is held in the row-sparse form, it is densified.
     //
     // ChainerxError is thrown if the array is constant with respect to the computation for the specified backprop ID.
     // ChainerxError is thrown if the array is not flagged as requiring gradient.
     // This function ignores no/force-backprop mode.
     const nonstd::optional<Array>& GetGrad(const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt) const;
 
+    // Returns the gradient of the array if it is held in the row-sparse form, or nullopt otherwise.
+    //
+    // Backward keeps the gradient row-sparse as long as only row-sparse gradients, e.g. those of Take with respect to the table, are
+    // accumulated into it, so that its memory usage is proportional to the number of touched rows. It is densified by GetGrad().
+    //
+    // ChainerxError is thrown if the array is not flagged as requiring gradient.
+    // This function ignores no/force-backprop mode.
+    const nonstd::optional<RowSparseGrad>& GetRowSparseGrad(const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt) const;
+
     // Sets the gradient of the array.
     // This function also flags the array as requiring gradient, so that preceding GetGrad() can return the gradient.
     //
@@ -1,6 +1,5 @@
 #include "chainerx/array_body.h"
 
-#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -13,13 +12,15 @@
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/object_pool.h"
+#include "chainerx/row_sparse_grad.h"
 
 namespace chainerx {
 namespace internal {
 
 std::shared_ptr<ArrayBody> CreateArrayBody(
         const Shape& shape, const Strides& strides, Dtype dtype, Device& device, std::shared_ptr<void> data, int64_t offset) {
-    // Trick to use make_shared with private ctor
+    // Trick to use allocate_shared with private ctor
     struct ArrayBodyWithPublicCtor : ArrayBody {
         ArrayBodyWithPublicCtor(
                 const Shape& shape, const Strides& strides, Dtype dtype, Device& device, std::shared_ptr<void> data, int64_t offset)
@@ -27,7 +28,7 @@ std::shared_ptr<ArrayBody> CreateArrayBody(
     };
 
     std::shared_ptr<ArrayBody> array_body =
-            std::make_shared<ArrayBodyWithPublicCtor>(shape, strides, dtype, device, std::move(data), offset);
+            MakePooledShared<ArrayBodyWithPublicCtor>(shape, strides, dtype, device, std::move(data), offset);
 
     if (internal::ArrayBodyLeakTracker* tracker = internal::ArrayBodyLeakDetectionScope::GetGlobalTracker()) {
         // TODO(niboshi): Make thread-safe
@@ -62,91 +63,96 @@ const std::shared_ptr<ArrayNode>& ArrayBody::AddNode(const std::shared_ptr<Array
     // as a retained output of backward)
     CHAINERX_ASSERT(array_node->weak_body().expired());
 
-    auto it = std::find_if(body->nodes_.begin(), body->nodes_.end(), [&array_node](const std::shared_ptr<ArrayNode>& existing_node) {
-        return existing_node->backprop_id() == array_node->backprop_id();
-    });
-    if (it != body->nodes_.end()) {
-        return *it;  // Do nothing and return the existing ArrayNode if found for this graph.
+    const BackpropId& backprop_id = array_node->backprop_id();
+    if (GraphEntry* entry = body->FindEntry(backprop_id)) {
+        return entry->node;  // Do nothing and return the existing ArrayNode if found for this graph.
     }
 
     // Connect the new backprop ID and the existing backprop IDs in this array body.
-    for (const std::shared_ptr<ArrayNode>& existing_array_node : body->nodes_) {
-        existing_array_node->device().context().ConnectBackpropIds(existing_array_node->backprop_id(), array_node->backprop_id());
+    for (const GraphEntry& entry : body->entries_) {
+        backprop_id.context().ConnectBackpropIds(entry.backprop_id, backprop_id);
     }
 
     array_node->weak_body_ = body;
 
-    body->nodes_.emplace_back(std::move(array_node));
-    body->grads_.emplace_back(std::make_unique<nonstd::optional<Array>>(nonstd::nullopt));
+    body->entries_.emplace_back(
+            GraphEntry{backprop_id, std::move(array_node), std::make_unique<nonstd::optional<Array>>(nonstd::nullopt), nullptr, false});
 
     body->AssertConsistency();
-    return body->nodes_.back();
+    return body->entries_.back().node;
 }
 
 const std::shared_ptr<ArrayNode>& ArrayBody::CreateArrayNode(const std::shared_ptr<ArrayBody>& body, const BackpropId& backprop_id) {
     CHAINERX_ASSERT(GetKind(body->dtype()) == DtypeKind::kFloat);
-    return AddNode(body, std::make_shared<ArrayNode>(body->shape_, body->dtype_, body->device_, backprop_id));
+    return AddNode(body, MakePooledShared<ArrayNode>(body->shape_, body->dtype_, body->device_, backprop_id));
 }
 
 void ArrayBody::AssertConsistency() const {
     if (CHAINERX_DEBUG) {
         // Array with integral dtypes can neither have array nodes nor gradients.
         if (GetKind(dtype()) != DtypeKind::kFloat) {
-            CHAINERX_ASSERT(nodes_.empty());
-            CHAINERX_ASSERT(grads_.empty());
+            CHAINERX_ASSERT(entries_.empty());
         }
 
-        CHAINERX_ASSERT(nodes_.size() == grads_.size());
-        for (size_t i = 0; i < nodes_.size(); ++i) {
-            const std::shared_ptr<ArrayNode>& array_node = nodes_[i];
-            const nonstd::optional<Array>& grad = *grads_[i];
+        for (const GraphEntry& entry : entries_) {
+            const std::shared_ptr<ArrayNode>& array_node = entry.node;
             CHAINERX_ASSERT(array_node != nullptr);
+            CHAINERX_ASSERT(entry.grad != nullptr);
+            CHAINERX_ASSERT(entry.backprop_id == array_node->backprop_id());
             CHAINERX_ASSERT(this == array_node->weak_body().lock().get());
 
+            const nonstd::optional<Array>& grad = *entry.grad;
             if (grad.has_value()) {
                 CHAINERX_ASSERT(internal::GetArrayBody(*grad) != nullptr);
                 CHAINERX_ASSERT(grad->shape() == array_node->shape());
                 CHAINERX_ASSERT(grad->dtype() == array_node->dtype());
                 CHAINERX_ASSERT(&grad->device() == &array_node->device());
             }
+            if (entry.sparse_grad != nullptr && entry.sparse_grad->has_value()) {
+                CHAINERX_ASSERT(!grad.has_value());
+                CHAINERX_ASSERT((*entry.sparse_grad)->shape() == array_node->shape());
+                CHAINERX_ASSERT((*entry.sparse_grad)->dtype() == array_node->dtype());
+                CHAINERX_ASSERT(&(*entry.sparse_grad)->device() == &array_node->device());
+            }
         }
     }
 }
 
-nonstd::optional<size_t> ArrayBody::GetNodeIndex(const BackpropId& backprop_id) const {
-    for (size_t i = 0; i < nodes_.size(); ++i) {
-        if (nodes_[i]->backprop_id() == backprop_id) {
-            return i;
-        }
+nonstd::optional<RowSparseGrad>& ArrayBody::GetOrCreateRowSparseGrad(const BackpropId& backprop_id) {
+    GraphEntry* entry = FindEntry(backprop_id);
+    CHAINERX_ASSERT(entry != nullptr);
+    if (entry->sparse_grad == nullptr) {
+        entry->sparse_grad = std::make_unique<nonstd::optional<RowSparseGrad>>(nonstd::nullopt);
     }
-    return nonstd::nullopt;
+    return *entry->sparse_grad;
 }
 
-void ArrayBody::SetGrad(Array grad, const BackpropId& backprop_id) {
-    nonstd::optional<Array>* target_grad = GetGrad(backprop_id);
-    CHAINERX_ASSERT(target_grad != nullptr);
-    internal::SetGrad(*target_grad, std::move(grad), shape_, dtype_, device_);
+void ArrayBody::DensifyGrad(const BackpropId& backprop_id) {
+    GraphEntry* entry = FindEntry(backprop_id);
+    CHAINERX_ASSERT(entry != nullptr);
+    if (entry->sparse_grad != nullptr && entry->sparse_grad->has_value()) {
+        internal::AccumulateGrad(*entry->grad, **entry->sparse_grad, shape_, dtype_, device_);
+        entry->sparse_grad->reset();
+    }
 }
 
-void ArrayBody::ClearGrad(const BackpropId& backprop_id) {
-    nonstd::optional<Array>* grad = GetGrad(backprop_id);
-    CHAINERX_ASSERT(grad != nullptr);
-    grad->reset();
+void ArrayBody::SetGrad(Array grad, const BackpropId& backprop_id) {
+    GraphEntry* entry = FindEntry(backprop_id);
+    CHAINERX_ASSERT(entry != nullptr);
+    internal::SetGrad(*entry->grad, std::move(grad), shape_, dtype_, device_);
+    if (entry->sparse_grad != nullptr) {
+        entry->sparse_grad->reset();
+    }
 }
 
-template <typename ThisPtr, typename ReturnType>
-ReturnType ArrayBody::GetGradImpl(ThisPtr this_ptr, const BackpropId& backprop_id) {
-    nonstd::optional<size_t> i = this_ptr->GetNodeIndex(backprop_id);
-    if (!i.has_value()) {
-        return nullptr;
+void ArrayBody::ClearGrad(const BackpropId& backprop_id) {
+    GraphEntry* entry = FindEntry(backprop_id);
+    CHAINERX_ASSERT(entry != nullptr);
+    entry->grad->reset();
+    if (entry->sparse_grad != nullptr) {
+        entry->sparse_grad->reset();
     }
-    CHAINERX_ASSERT(*i < this_ptr->grads_.size());
-    return this_ptr->grads_[*i].get();
 }
 
-template nonstd::optional<Array>* ArrayBody::GetGradImpl<ArrayBody*, nonstd::optional<Array>*>(ArrayBody*, const BackpropId&);
-template const nonstd::optional<Array>* ArrayBody::GetGradImpl<const ArrayBody*, const nonstd::optional<Array>*>(
-        const ArrayBody*, const BackpropId&);
-
 }  // namespace internal
 }  // namespace chainerx
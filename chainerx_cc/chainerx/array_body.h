@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -11,11 +13,13 @@
 #include "chainerx/dtype.h"
 #include "chainerx/graph.h"
 #include "chainerx/shape.h"
+#include "chainerx/small_vector.h"
 #include "chainerx/strides.h"
 
 namespace chainerx {
 
 class Array;
+class RowSparseGrad;
 
 namespace internal {
 
@@ -34,6 +38,70 @@ public:
         int64_t offset;
     };
 
+    // Array node, gradient and gradient requirement of a single graph.
+    // They are stored together so that a lookup by backprop ID touches a single entry.
+    struct GraphEntry {
+        BackpropId backprop_id;
+        std::shared_ptr<ArrayNode> node;
+        // Heap-allocated so that references to the gradient remain valid when entries are added.
+        std::unique_ptr<nonstd::optional<Array>> grad;
+        // Row-sparse gradient pending accumulation into `grad`, allocated on first use. At most one of them has a value.
+        std::unique_ptr<nonstd::optional<RowSparseGrad>> sparse_grad;
+        bool grad_required;
+    };
+
+    // Most arrays belong to at most two graphs (e.g. the default graph and the one for double backprop).
+    using GraphEntries = SmallVector<GraphEntry, 2>;
+
+    // Read-only range of the array nodes of an array body, in the order of addition.
+    class ArrayNodeRange {
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::shared_ptr<ArrayNode>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::shared_ptr<ArrayNode>*;
+            using reference = const std::shared_ptr<ArrayNode>&;
+
+            explicit Iterator(const GraphEntry* entry) : entry_{entry} {}
+
+            reference operator*() const { return entry_->node; }
+            pointer operator->() const { return &entry_->node; }
+
+            Iterator& operator++() {
+                ++entry_;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++entry_;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& other) const { return entry_ == other.entry_; }
+            bool operator!=(const Iterator& other) const { return entry_ != other.entry_; }
+
+        private:
+            const GraphEntry* entry_;
+        };
+
+        explicit ArrayNodeRange(const GraphEntries& entries) : entries_{entries} {}
+
+        Iterator begin() const { return Iterator{entries_.begin()}; }
+        Iterator end() const { return Iterator{entries_.end()}; }
+
+        size_t size() const { return entries_.size(); }
+
+        bool empty() const { return entries_.empty(); }
+
+        const std::shared_ptr<ArrayNode>& operator[](size_t index) const { return entries_[index].node; }
+
+    private:
+        const GraphEntries& entries_;
+    };
+
     ~ArrayBody() = default;
 
     ArrayBody(const ArrayBody&) = delete;
@@ -57,12 +125,17 @@ public:
 
     // Returns the list of backprop IDs whose gradients are marked as required.
     // This does not take backprop mode into account.
-    const std::vector<BackpropId>& grad_required_backprop_ids() const { return grad_required_backprop_ids_; }
-
-    const std::vector<std::shared_ptr<ArrayNode>>& nodes() const { return nodes_; }
+    std::vector<BackpropId> grad_required_backprop_ids() const {
+        std::vector<BackpropId> backprop_ids;
+        for (const GraphEntry& entry : entries_) {
+            if (entry.grad_required) {
+                backprop_ids.emplace_back(entry.backprop_id);
+            }
+        }
+        return backprop_ids;
+    }
 
-    // TODO(niboshi): Remove this function and add another to assign an array node at a specified index.
-    std::vector<std::shared_ptr<ArrayNode>>& nodes() { return nodes_; }
+    ArrayNodeRange nodes() const { return ArrayNodeRange{entries_}; }
 
     int64_t GetItemSize() const { return chainerx::GetItemSize(dtype()); }
 
@@ -72,8 +145,8 @@ public:
     // This does not take backprop mode into account.
     bool IsGradRequired(const BackpropId& backprop_id) const {
         backprop_id.CheckValid();
-        return grad_required_backprop_ids_.end() !=
-               std::find(grad_required_backprop_ids_.begin(), grad_required_backprop_ids_.end(), backprop_id);
+        const GraphEntry* entry = FindEntry(backprop_id);
+        return entry != nullptr && entry->grad_required;
     }
 
     // Mark the gradient of the specified backprop ID as required.
@@ -82,14 +155,12 @@ public:
         backprop_id.CheckValid();
         CHAINERX_ASSERT(GetKind(body->dtype_) == DtypeKind::kFloat);
 
-        if (body->grad_required_backprop_ids_.end() ==
-            std::find(body->grad_required_backprop_ids_.begin(), body->grad_required_backprop_ids_.end(), backprop_id)) {
-            body->grad_required_backprop_ids_.emplace_back(backprop_id);
-
-            if (!body->HasArrayNode(backprop_id)) {
-                CreateArrayNode(body, backprop_id);
-            }
+        if (body->FindEntry(backprop_id) == nullptr) {
+            CreateArrayNode(body, backprop_id);
         }
+        GraphEntry* entry = body->FindEntry(backprop_id);
+        CHAINERX_ASSERT(entry != nullptr);
+        entry->grad_required = true;
     }
 
     int64_t GetTotalSize() const { return shape().GetTotalSize(); }
@@ -97,15 +168,11 @@ public:
     int64_t GetNBytes() const { return GetTotalSize() * GetItemSize(); }
 
     const std::shared_ptr<ArrayNode>& GetArrayNode(const BackpropId& backprop_id) const {
-        nonstd::optional<size_t> index = GetNodeIndex(backprop_id);
-        if (index.has_value()) {
-            return nodes_[*index];
-        }
-
-        return kNullArrayNode;
+        const GraphEntry* entry = FindEntry(backprop_id);
+        return entry != nullptr ? entry->node : kNullArrayNode;
     }
 
-    bool HasArrayNode(const BackpropId& backprop_id) const { return GetNodeIndex(backprop_id).has_value(); }
+    bool HasArrayNode(const BackpropId& backprop_id) const { return FindEntry(backprop_id) != nullptr; }
 
     // Adds an array node to the array body.
     // The array node must have been initialized with this array body in advance.
@@ -124,20 +191,37 @@ public:
     // Returns a gradient array.
     // Returns nullptr if the array does not belong to the specified graph.
     const nonstd::optional<Array>* GetGrad(const BackpropId& backprop_id) const {
-        return GetGradImpl<const ArrayBody*, const nonstd::optional<Array>*>(this, backprop_id);
+        const GraphEntry* entry = FindEntry(backprop_id);
+        return entry != nullptr ? entry->grad.get() : nullptr;
     }
 
     // Returns a gradient array.
     // Returns nullptr if the array does not belong to the specified graph.
     nonstd::optional<Array>* GetGrad(const BackpropId& backprop_id) {
-        return GetGradImpl<ArrayBody*, nonstd::optional<Array>*>(this, backprop_id);
+        GraphEntry* entry = FindEntry(backprop_id);
+        return entry != nullptr ? entry->grad.get() : nullptr;
+    }
+
+    // Returns the row-sparse gradient which is pending accumulation into the gradient array.
+    // Returns nullptr if the array does not belong to the specified graph or a row-sparse gradient has never been accumulated.
+    const nonstd::optional<RowSparseGrad>* GetRowSparseGrad(const BackpropId& backprop_id) const {
+        const GraphEntry* entry = FindEntry(backprop_id);
+        return entry != nullptr ? entry->sparse_grad.get() : nullptr;
     }
 
-    // Sets a gradient array.
+    // Returns the row-sparse gradient which is pending accumulation into the gradient array, allocating it on first use.
+    // The behavior is undefined if there is no array node for the specified graph.
+    nonstd::optional<RowSparseGrad>& GetOrCreateRowSparseGrad(const BackpropId& backprop_id);
+
+    // Accumulates the pending row-sparse gradient, if any, into the gradient array.
+    // The behavior is undefined if there is no array node for the specified graph.
+    void DensifyGrad(const BackpropId& backprop_id);
+
+    // Sets a gradient array, discarding the pending row-sparse gradient.
     // The behavior is undefined if there is no array node for the specified graph.
     void SetGrad(Array grad, const BackpropId& backprop_id);
 
-    // Clears a gradient array.
+    // Clears a gradient array and the pending row-sparse gradient.
     // The behavior is undefined if there is no array node for the specified graph.
     void ClearGrad(const BackpropId& backprop_id);
 
@@ -156,10 +240,20 @@ private:
     // This function is no-op if CHAINERX_DEBUG is set.
     void AssertConsistency() const;
 
-    template <typename ThisPtr, typename ReturnType>
-    static ReturnType GetGradImpl(ThisPtr this_ptr, const BackpropId& backprop_id);
+    // Returns the entry of the specified graph, or nullptr if the array does not belong to the graph.
+    // Typically there are only one or two entries, for which a linear scan comparing ordinals is the fastest.
+    const GraphEntry* FindEntry(const BackpropId& backprop_id) const {
+        for (const GraphEntry& entry : entries_) {
+            if (entry.backprop_id == backprop_id) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
 
-    nonstd::optional<size_t> GetNodeIndex(const BackpropId& backprop_id) const;
+    GraphEntry* FindEntry(const BackpropId& backprop_id) {
+        return const_cast<GraphEntry*>(static_cast<const ArrayBody*>(this)->FindEntry(backprop_id));  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
 
     // The use of non-POD static storage object here is safe, because destructing a shared_ptr with nullptr does not incur any
     // destruction order problem.
@@ -172,9 +266,7 @@ private:
     std::shared_ptr<void> data_;
     int64_t offset_;  // in bytes
 
-    std::vector<BackpropId> grad_required_backprop_ids_;
-    std::vector<std::shared_ptr<ArrayNode>> nodes_;
-    std::vector<std::unique_ptr<nonstd::optional<Array>>> grads_;
+    GraphEntries entries_;
 };
 
 std::shared_ptr<ArrayBody> CreateArrayBody(
@@ -1,5 +1,6 @@
 #include "chainerx/array_body_leak_detection.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -9,6 +10,7 @@
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
 #include "chainerx/array_node.h"
+#include "chainerx/device.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
@@ -25,6 +27,25 @@ void ArrayBodyLeakTracker::operator()(const std::shared_ptr<ArrayBody>& array_bo
 }
 
 std::vector<std::shared_ptr<ArrayBody>> ArrayBodyLeakTracker::GetAliveArrayBodies() const {
+    // Array bodies may be referenced by kernels which are still pending on their devices.
+    // Such devices are synchronized before the array bodies are collected again.
+    std::vector<Device*> devices{};
+    for (const std::shared_ptr<ArrayBody>& array_body : CollectAliveArrayBodies()) {
+        Device* device = &array_body->device();
+        if (std::find(devices.begin(), devices.end(), device) == devices.end()) {
+            devices.emplace_back(device);
+        }
+    }
+    if (devices.empty()) {
+        return {};
+    }
+    for (Device* device : devices) {
+        device->Synchronize();
+    }
+    return CollectAliveArrayBodies();
+}
+
+std::vector<std::shared_ptr<ArrayBody>> ArrayBodyLeakTracker::CollectAliveArrayBodies() const {
     std::lock_guard<std::mutex> lock{mutex_};
     std::vector<std::shared_ptr<ArrayBody>> alive_ptrs;
     for (const std::weak_ptr<ArrayBody>& weak_ptr : weak_ptrs_) {
@@ -25,6 +25,8 @@ public:
     bool IsAllArrayBodiesFreed(std::ostream& os) const;
 
 private:
+    std::vector<std::shared_ptr<ArrayBody>> CollectAliveArrayBodies() const;
+
     std::vector<std::weak_ptr<ArrayBody>> weak_ptrs_;
     mutable std::mutex mutex_;
 };
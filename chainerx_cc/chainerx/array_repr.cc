@@ -64,6 +64,8 @@ class FloatFormatter {
 public:
     void Scan(Float16 value) { Scan(static_cast<double>(value)); }
 
+    void Scan(BFloat16 value) { Scan(static_cast<double>(value)); }
+
     void Scan(double value) {
         int b_digits = 0;
         if (value < 0) {
@@ -103,6 +105,8 @@ public:
 
     void Print(std::ostream& os, Float16 value) { Print(os, static_cast<double>(value)); }
 
+    void Print(std::ostream& os, BFloat16 value) { Print(os, static_cast<double>(value)); }
+
     void Print(std::ostream& os, double value) {
         if (digits_after_e_ > 0) {
             int width = 12 + (has_minus_ ? 1 : 0) + digits_after_e_;
@@ -223,7 +227,7 @@ struct ArrayReprImpl {
         os << ", shape=" << array.shape();
         os << ", dtype=" << array.dtype();
         os << ", device='" << array.device().name() << "'";
-        const std::vector<std::shared_ptr<internal::ArrayNode>>& array_nodes = internal::GetArrayBody(array)->nodes();
+        internal::ArrayBody::ArrayNodeRange array_nodes = internal::GetArrayBody(array)->nodes();
         if (!array_nodes.empty()) {
             os << ", backprop_ids=[";
             for (size_t i = 0; i < array_nodes.size(); ++i) {
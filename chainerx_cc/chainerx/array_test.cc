@@ -11,6 +11,7 @@
 #include <numeric>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -33,6 +34,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/op_node.h"
+#include "chainerx/routines/activation.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
@@ -673,6 +675,55 @@ TEST_P(ArrayTest, DivideScalar) {
     EXPECT_ARRAY_EQ(e, o);
 }
 
+TEST_P(ArrayTest, DonateTemporary) {
+    Array a = testing::BuildArray({3, 2}).WithLinearData<float>();
+    Array b = testing::BuildArray({3, 2}).WithData<float>({1, -1, 2, -2, 3, -3});
+    Array bias = testing::BuildArray({2}).WithData<float>({-1, 1});
+
+    // The buffer of the temporary is reused through the chain, including a broadcast operand.
+    {
+        Array t = a * b;
+        const void* data = t.raw_data();
+        Array o = Relu((std::move(t) + bias) * Scalar{2.f});
+        EXPECT_EQ(data, o.raw_data());
+        EXPECT_ARRAY_EQ(testing::BuildArray({3, 2}).WithData<float>({0, 0, 6, 0, 22, 0}), o);
+    }
+
+    // Shared buffers are not overwritten.
+    {
+        Array t = a * b;
+        Array view = t.Reshape({6});
+        Array o = std::move(t) + b;
+        EXPECT_NE(view.raw_data(), o.raw_data());
+        EXPECT_ARRAY_EQ(testing::BuildArray({6}).WithData<float>({0, -1, 4, -6, 12, -15}), view);
+    }
+
+    // Outputs of a different dtype are allocated.
+    {
+        Array t = testing::BuildArray({3}).WithData<int32_t>({1, 2, 3}).Build() * Scalar{2};
+        const void* data = t.raw_data();
+        Array o = std::move(t) / Scalar{4};
+        EXPECT_NE(data, o.raw_data());
+        EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<float>({0.5f, 1.f, 1.5f}), o);
+    }
+
+    // Inputs requiring grad are not overwritten since they may be retained for backward.
+    {
+        Array x = a.MakeView().RequireGrad();
+        Array t = x * b;
+        const void* data = t.raw_data();
+        Array o = std::move(t) * x;
+        EXPECT_NE(data, o.raw_data());
+        Backward(o);
+        EXPECT_ARRAY_EQ(2 * a * b, *x.GetGrad());
+
+        NoBackpropModeScope scope{};
+        Array u = a * b;
+        const void* u_data = u.raw_data();
+        EXPECT_EQ(u_data, (std::move(u) * x).raw_data());
+    }
+}
+
 TEST_P(ArrayTest, ComputationalGraph) {
     // c = a + b
     // o = a * c
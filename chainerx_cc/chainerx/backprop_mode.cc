@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <nonstd/optional.hpp>
@@ -19,36 +20,78 @@ namespace {
 
 using internal::BackpropModeStack;
 
+// Must be called after every modification of the backprop mode stack.
+void ResetBackpropModeCache(internal::InternalThreadLocalState& state) {
+    const BackpropModeStack& bms = state.backprop_mode_stack;
+    internal::BackpropModeCache& cache = state.backprop_mode_cache;
+    cache.results.clear();
+    // An innermost context-wide no-backprop entry hides all the other entries of the context.
+    if (!bms.empty() && !bms.back().backprop_id().has_value() && !bms.back().backprop()) {
+        cache.all_disabled_context = &bms.back().context();
+    } else {
+        cache.all_disabled_context = nullptr;
+    }
+}
+
+bool FindBackpropMode(const BackpropModeStack& bms, const BackpropId& backprop_id) {
+    auto it = std::find_if(bms.rbegin(), bms.rend(), [&backprop_id](const internal::BackpropMode& bm) {
+        if (bm.backprop_id().has_value()) {
+            return backprop_id == *bm.backprop_id();
+        }
+        // for all graphs in the context
+        return &backprop_id.context() == &bm.context();
+    });
+    if (it != bms.rend()) {
+        return it->backprop();
+    }
+    return true;  // Per default.
+}
+
 }  // namespace
 
 namespace backprop_mode_detail {
 
 template <bool kModeFlag>
-BackpropModeScope<kModeFlag>::BackpropModeScope(Context& context) : n_{1} {
-    BackpropModeStack& backprop_mode_stack = internal::GetInternalThreadLocalState().backprop_mode_stack;
-    backprop_mode_stack.emplace_back(context, kModeFlag);
+BackpropModeScope<kModeFlag>::BackpropModeScope(Context& context) {
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return;
+    }
+    n_ = 1;
+    state.backprop_mode_stack.emplace_back(context, kModeFlag);
+    ResetBackpropModeCache(state);
 }
 
 template <bool kModeFlag>
-BackpropModeScope<kModeFlag>::BackpropModeScope(const std::vector<BackpropId>& backprop_ids) : n_{backprop_ids.size()} {
+BackpropModeScope<kModeFlag>::BackpropModeScope(const std::vector<BackpropId>& backprop_ids) {
     // Need to throw before initializing because thowing error at ctor does not call the dtor.
     for (const BackpropId& backprop_id : backprop_ids) {
         if (&backprop_ids.front().context() != &backprop_id.context()) {
             throw ContextError{"Cannot specify backprop ids with different contexts together."};
         }
     }
-    BackpropModeStack& backprop_mode_stack = internal::GetInternalThreadLocalState().backprop_mode_stack;
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return;
+    }
+    n_ = backprop_ids.size();
     for (const BackpropId& backprop_id : backprop_ids) {
-        backprop_mode_stack.emplace_back(backprop_id, kModeFlag);
+        state.backprop_mode_stack.emplace_back(backprop_id, kModeFlag);
     }
+    ResetBackpropModeCache(state);
 }
 
 template <bool kModeFlag>
 BackpropModeScope<kModeFlag>::~BackpropModeScope() {
-    BackpropModeStack& backprop_mode_stack = internal::GetInternalThreadLocalState().backprop_mode_stack;
+    if (n_ == 0) {
+        return;
+    }
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    BackpropModeStack& backprop_mode_stack = state.backprop_mode_stack;
     CHAINERX_ASSERT(backprop_mode_stack.size() >= n_);
 
     backprop_mode_stack.erase(backprop_mode_stack.end() - n_, backprop_mode_stack.end());
+    ResetBackpropModeCache(state);
 }
 
 template class BackpropModeScope<true>;
@@ -56,24 +99,52 @@ template class BackpropModeScope<false>;
 
 }  // namespace backprop_mode_detail
 
+InferenceModeScope::InferenceModeScope() {
+    bool& inference_mode = internal::GetInternalThreadLocalState().inference_mode;
+    prev_inference_mode_ = inference_mode;
+    inference_mode = true;
+}
+
+InferenceModeScope::~InferenceModeScope() { internal::GetInternalThreadLocalState().inference_mode = prev_inference_mode_; }
+
+bool IsInferenceMode() { return internal::GetInternalThreadLocalState().inference_mode; }
+
 bool IsBackpropRequired(Context& context) {
+    const internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return false;
+    }
+    if (state.backprop_mode_stack.empty()) {
+        return true;
+    }
+    if (state.backprop_mode_cache.all_disabled_context == &context) {
+        return false;
+    }
     BackpropId backprop_id = context.default_backprop_id();
     return IsBackpropRequired(backprop_id);
 }
 
 bool IsBackpropRequired(const BackpropId& backprop_id) {
-    BackpropModeStack& bms = internal::GetInternalThreadLocalState().backprop_mode_stack;
-    auto it = std::find_if(bms.rbegin(), bms.rend(), [&backprop_id](const internal::BackpropMode& bm) {
-        if (bm.backprop_id().has_value()) {
-            return backprop_id == *bm.backprop_id();
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return false;
+    }
+    if (state.backprop_mode_stack.empty()) {
+        return true;  // Per default.
+    }
+
+    internal::BackpropModeCache& cache = state.backprop_mode_cache;
+    if (cache.all_disabled_context == &backprop_id.context()) {
+        return false;
+    }
+    for (const std::pair<BackpropId, bool>& result : cache.results) {
+        if (result.first == backprop_id) {
+            return result.second;
         }
-        // for all graphs in the context
-        return &backprop_id.context() == &bm.context();
-    });
-    if (it != bms.rend()) {
-        return it->backprop();
     }
-    return true;  // Per default.
+    bool backprop = FindBackpropMode(state.backprop_mode_stack, backprop_id);
+    cache.results.emplace_back(backprop_id, backprop);
+    return backprop;
 }
 
 }  // namespace chainerx
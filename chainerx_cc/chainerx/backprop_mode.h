@@ -37,6 +37,15 @@ private:
 
 using BackpropModeStack = std::vector<internal::BackpropMode>;
 
+// Results of the queries to the backprop mode stack of a thread, which are reset whenever the stack is modified.
+struct BackpropModeCache {
+    // Context whose graphs all have backprop disabled by the innermost entry of the stack, or nullptr.
+    Context* all_disabled_context{};
+
+    // Results of IsBackpropRequired for the backprop IDs queried since the last modification of the stack.
+    std::vector<std::pair<BackpropId, bool>> results{};
+};
+
 }  // namespace internal
 
 namespace backprop_mode_detail {
@@ -76,6 +85,28 @@ using NoBackpropModeScope = backprop_mode_detail::BackpropModeScope<false>;
 // Make a context which enables back-propagation.
 using ForceBackpropModeScope = backprop_mode_detail::BackpropModeScope<true>;
 
+// Makes a scope in which no graph is recorded in the current thread, regardless of the contexts and backprop IDs.
+//
+// Unlike NoBackpropModeScope, ForceBackpropModeScope cannot re-enable backprop inside this scope and backprop mode scopes do not modify
+// the backprop mode stack, so that routines do not pay for the graph construction at all.
+class InferenceModeScope {
+public:
+    InferenceModeScope();
+
+    InferenceModeScope(const InferenceModeScope&) = delete;
+    InferenceModeScope(InferenceModeScope&& other) = delete;
+    InferenceModeScope& operator=(const InferenceModeScope&) = delete;
+    InferenceModeScope& operator=(InferenceModeScope&& other) = delete;
+
+    ~InferenceModeScope();
+
+private:
+    bool prev_inference_mode_;
+};
+
+// Returns true if the current thread is inside an InferenceModeScope.
+bool IsInferenceMode();
+
 bool IsBackpropRequired(Context& context = GetDefaultContext());
 bool IsBackpropRequired(const BackpropId& backprop_id);
 
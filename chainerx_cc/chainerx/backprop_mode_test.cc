@@ -12,6 +12,7 @@
 #include "chainerx/testing/array.h"
 #include "chainerx/testing/context_session.h"
 #include "chainerx/testing/device_session.h"
+#include "chainerx/thread_local_state.h"
 
 namespace chainerx {
 namespace {
@@ -438,5 +439,99 @@ TEST(BackpropModeScopeTest, BackpropModeScopeWithAnotherContext) {
     EXPECT_THROW(NoBackpropModeScope({backprop_id, another_backprop_id}), ContextError);
 }
 
+TEST(BackpropModeScopeTest, BackpropModeScopeRepeatedQueries) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope1{"bp1"};
+    BackpropScope backprop_scope2{"bp2"};
+    BackpropId backprop_id1 = backprop_scope1.backprop_id();
+    BackpropId backprop_id2 = backprop_scope2.backprop_id();
+
+    // Results of the previous queries must not be reused after the stack is modified.
+    {
+        NoBackpropModeScope scope1{backprop_id1};
+        EXPECT_FALSE(IsBackpropRequired(backprop_id1));
+        EXPECT_FALSE(IsBackpropRequired(backprop_id1));
+        EXPECT_TRUE(IsBackpropRequired(backprop_id2));
+        {
+            ForceBackpropModeScope scope2{};
+            EXPECT_TRUE(IsBackpropRequired(backprop_id1));
+            EXPECT_TRUE(IsBackpropRequired(backprop_id2));
+            {
+                NoBackpropModeScope scope3{};
+                EXPECT_FALSE(IsBackpropRequired());
+                EXPECT_FALSE(IsBackpropRequired(backprop_id1));
+                EXPECT_FALSE(IsBackpropRequired(backprop_id2));
+            }
+            EXPECT_TRUE(IsBackpropRequired(backprop_id1));
+            EXPECT_TRUE(IsBackpropRequired());
+        }
+        EXPECT_FALSE(IsBackpropRequired(backprop_id1));
+        EXPECT_TRUE(IsBackpropRequired(backprop_id2));
+    }
+    EXPECT_TRUE(IsBackpropRequired(backprop_id1));
+
+    // The cached results are carried over together with the stack.
+    ThreadLocalState state_outside = ThreadLocalState::Get();
+    ThreadLocalState state_inside{};
+    {
+        NoBackpropModeScope scope{};
+        EXPECT_FALSE(IsBackpropRequired(backprop_id1));
+        state_inside = ThreadLocalState::Get();
+        ThreadLocalState::Set(state_outside);
+        EXPECT_TRUE(IsBackpropRequired(backprop_id1));
+        EXPECT_TRUE(IsBackpropRequired());
+        ThreadLocalState::Set(state_inside);
+        EXPECT_FALSE(IsBackpropRequired(backprop_id1));
+        EXPECT_FALSE(IsBackpropRequired());
+    }
+    EXPECT_TRUE(IsBackpropRequired(backprop_id1));
+}
+
+TEST(BackpropModeScopeTest, InferenceModeScope) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    EXPECT_FALSE(IsInferenceMode());
+    {
+        InferenceModeScope scope1{};
+        EXPECT_TRUE(IsInferenceMode());
+        EXPECT_FALSE(IsBackpropRequired());
+        EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        {
+            // Backprop cannot be forced in the inference mode.
+            ForceBackpropModeScope scope2{};
+            EXPECT_FALSE(IsBackpropRequired());
+            ForceBackpropModeScope scope3{backprop_id};
+            EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        }
+        {
+            InferenceModeScope scope4{};
+            EXPECT_TRUE(IsInferenceMode());
+        }
+        EXPECT_TRUE(IsInferenceMode());
+    }
+    EXPECT_FALSE(IsInferenceMode());
+    EXPECT_TRUE(IsBackpropRequired());
+    EXPECT_TRUE(IsBackpropRequired(backprop_id));
+
+    // Scopes entered before the inference mode are still effective after it.
+    {
+        NoBackpropModeScope scope1{};
+        {
+            InferenceModeScope scope2{};
+            NoBackpropModeScope scope3{backprop_id};
+            EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        }
+        EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        {
+            ForceBackpropModeScope scope4{backprop_id};
+            EXPECT_TRUE(IsBackpropRequired(backprop_id));
+        }
+        EXPECT_FALSE(IsBackpropRequired(backprop_id));
+    }
+    EXPECT_TRUE(IsBackpropRequired(backprop_id));
+}
+
 }  // namespace
 }  // namespace chainerx
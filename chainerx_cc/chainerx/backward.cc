@@ -25,7 +25,9 @@
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
+#include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/row_sparse_grad.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -40,8 +42,10 @@ using internal::OpNode;
 namespace internal {
 namespace {
 
-// Throws GradientError in case of mismatch in gradient array props.
-void CheckGradCompatible(const Array& grad, const Shape& shape, Dtype dtype, Device& device) {
+// Throws GradientError in case of mismatch in gradient props.
+// `GradType` is either Array or RowSparseGrad.
+template <typename GradType>
+void CheckGradCompatible(const GradType& grad, const Shape& shape, Dtype dtype, Device& device) {
     if (dtype != grad.dtype()) {
         throw GradientError{"Gradient dtypes do not match. Expected: ", dtype, " Actual: ", grad.dtype(), "."};
     }
@@ -53,12 +57,53 @@ void CheckGradCompatible(const Array& grad, const Shape& shape, Dtype dtype, Dev
     }
 }
 
+// Returns true if the target gradient can be updated in-place without any observable side effect.
+// It requires that the target gradient buffer is referenced by nobody else (neither by user code, other gradients, retained arrays nor
+// views), that it is densely laid out (e.g. not a broadcasted view) and that it is not part of a graph (double backprop).
+bool CanUpdateGradInplace(const Array& target_grad) {
+    const std::shared_ptr<ArrayBody>& target_body = GetArrayBody(target_grad);
+    return target_body.use_count() == 1 && target_body->data().use_count() == 1 && target_body->IsContiguous() &&
+           target_body->nodes().empty();
+}
+
+// Returns true if the partial gradient can be added to the target gradient in-place without any observable side effect.
+// In addition to the requirements of CanUpdateGradInplace, no graph must be involved in the partial gradient.
+bool CanAccumulateGradInplace(const Array& target_grad, const Array& partial_grad) {
+    return CanUpdateGradInplace(target_grad) && GetArrayBody(partial_grad)->nodes().empty();
+}
+
 }  // namespace
 
 void AccumulateGrad(nonstd::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device) {
     CheckGradCompatible(partial_grad, shape, dtype, device);
     if (target_grad.has_value()) {
-        target_grad = *target_grad + partial_grad;
+        if (CanAccumulateGradInplace(*target_grad, partial_grad)) {
+            // Avoids allocating a new gradient on every accumulation, e.g. for parameters shared across many time steps.
+            internal::IAdd(*target_grad, partial_grad);
+        } else {
+            target_grad = *target_grad + partial_grad;
+        }
+    } else {
+        target_grad = std::move(partial_grad);
+    }
+}
+
+void AccumulateGrad(nonstd::optional<Array>& target_grad, const RowSparseGrad& partial_grad, const Shape& shape, Dtype dtype, Device& device) {
+    CheckGradCompatible(partial_grad, shape, dtype, device);
+    // Row-sparse gradients never involve graphs.
+    if (target_grad.has_value() && CanUpdateGradInplace(*target_grad)) {
+        // Only the touched rows of the target gradient are updated.
+        partial_grad.AddTo(*target_grad);
+    } else {
+        AccumulateGrad(target_grad, partial_grad.ToDense(), shape, dtype, device);
+    }
+}
+
+void AccumulateGrad(
+        nonstd::optional<RowSparseGrad>& target_grad, RowSparseGrad partial_grad, const Shape& shape, Dtype dtype, Device& device) {
+    CheckGradCompatible(partial_grad, shape, dtype, device);
+    if (target_grad.has_value()) {
+        target_grad->Merge(partial_grad);
     } else {
         target_grad = std::move(partial_grad);
     }
@@ -175,7 +220,7 @@ std::unordered_map<OpNode*, std::vector<uint8_t>> CreateSubgraph(
                 flags.resize(op_node->input_array_node_count());
             }
 
-            const std::vector<std::shared_ptr<ArrayNode>>& input_array_nodes = op_node->input_array_nodes();
+            const OpNode::InputArrayNodes& input_array_nodes = op_node->input_array_nodes();
             for (size_t i_input = 0; i_input < op_node->input_array_node_count(); ++i_input) {
                 if (input_array_nodes[i_input].get() == array_node) {
                     flags[i_input] = static_cast<int8_t>(true);
@@ -281,8 +326,9 @@ public:
 
             // Backpropagate gradients from the output array nodes into the input array nodes.
             {
-                std::vector<nonstd::optional<Array>> gxs = ComputeInputGradients(op_node);
-                AccumulateInputGradients(*op_node, std::move(gxs));
+                std::vector<nonstd::optional<RowSparseGrad>> sparse_gxs;
+                std::vector<nonstd::optional<Array>> gxs = ComputeInputGradients(op_node, sparse_gxs);
+                AccumulateInputGradients(*op_node, std::move(gxs), std::move(sparse_gxs));
             }
 
             // Push the creator op nodes into the queue
@@ -300,19 +346,28 @@ public:
             {
                 auto range = output_array_node_keeper_.equal_range(op_node.get());
                 for (auto it = range.first; it != range.second; ++it) {
-                    size_t n_removed = array_node_grad_map_.erase(it->second.get());
-                    CHAINERX_ASSERT(n_removed > 0);
+                    auto it_grad = array_node_grad_map_.find(it->second.get());
+                    CHAINERX_ASSERT(it_grad != array_node_grad_map_.end());
+                    array_node_grad_map_.erase(it_grad);
                 }
             }
         }
 
+        // Row-sparse gradients are kept as they are on the array bodies, e.g. of the leaf nodes, and densified on demand.
+        // Only those of the gradients returned by Grad() are densified.
+        for (auto& pair : array_node_grad_map_) {
+            pair.second.FlushSparseGrad();
+        }
+
         // Register this graph as backpropped.
         backprop_id_.context().SetBackpropDone(backprop_id_);
     }
 
 private:
     // Runs backward functions to compute gradients of input array nodes.
-    std::vector<nonstd::optional<Array>> ComputeInputGradients(const std::shared_ptr<OpNode>& op_node) {
+    // Row-sparse gradients are returned separately in `input_sparse_grads`.
+    std::vector<nonstd::optional<Array>> ComputeInputGradients(
+            const std::shared_ptr<OpNode>& op_node, std::vector<nonstd::optional<RowSparseGrad>>& input_sparse_grads) {
         // A single op node has multiple backward functions, each of which computes the gradients of a subset of the inputs.
         // They are responsible for non-overlapping subsets of inputs.
         // This function calls these backward functions, collects the gradients computed by them and returns the collected gradients.
@@ -361,6 +416,7 @@ private:
         // Call the backward functions and collects their gradients.
         std::vector<nonstd::optional<Array>> input_grads;
         input_grads.resize(op_node->input_array_node_count());
+        input_sparse_grads.resize(op_node->input_array_node_count());
 
         const std::vector<uint8_t>& requires_grad = input_required_flags_[op_node.get()];
         for (const internal::OpNodeBackwardEntry& backward_entry : op_node->backward_entries()) {
@@ -369,7 +425,8 @@ private:
                                            backward_entry.input_array_node_indices().begin(),
                                            backward_entry.input_array_node_indices().end(),
                                            [&requires_grad](size_t i_input) { return static_cast<bool>(requires_grad[i_input]); })) {
-                CallBackwardForSubsetOfInputGradients(op_node, backward_entry, output_array_nodes, input_grads, output_grads);
+                CallBackwardForSubsetOfInputGradients(
+                        op_node, backward_entry, output_array_nodes, input_grads, input_sparse_grads, output_grads);
             }
         }
 
@@ -414,14 +471,17 @@ private:
             const internal::OpNodeBackwardEntry& backward_entry,
             std::vector<std::shared_ptr<ArrayNode>>& output_array_nodes,
             std::vector<nonstd::optional<Array>>& input_grads,
+            std::vector<nonstd::optional<RowSparseGrad>>& input_sparse_grads,
             std::vector<internal::GradRef*>& output_grads) {
         // `computed_input_grads` holds the storage of gradients of all the inputs of the op node.
         // The given backward entry will compute and store a subset of those gradients.
         // The backward entry may compute and store the gradients of other inputs as well, which will be ignored.
         std::vector<Array> computed_input_grads(input_grads.size());
+        std::vector<nonstd::optional<RowSparseGrad>> computed_input_sparse_grads(input_grads.size());
 
         // Call backward.
-        BackwardContext bctx{op_node, backward_entry, output_array_nodes, output_grads, computed_input_grads, double_backprop_};
+        BackwardContext bctx{
+                op_node, backward_entry, output_array_nodes, output_grads, computed_input_grads, computed_input_sparse_grads, double_backprop_};
         {
             NoBackpropModeScope scope{backprop_ids_to_stop_gradient_};
             backward_entry.backward_func()(bctx);
@@ -438,7 +498,8 @@ private:
             }
 
             Array& computed_input_grad = gsl::at(computed_input_grads, i_input_grad);
-            if (internal::GetArrayBody(computed_input_grad) == nullptr) {
+            nonstd::optional<RowSparseGrad>& computed_input_sparse_grad = gsl::at(computed_input_sparse_grads, i_input_grad);
+            if (internal::GetArrayBody(computed_input_grad) == nullptr && !computed_input_sparse_grad.has_value()) {
                 // Input grad is not set by backward function
                 continue;
             }
@@ -447,15 +508,23 @@ private:
             {
                 const std::shared_ptr<ArrayNode>& input_array_node = gsl::at(op_node->input_array_nodes(), i_input_grad);
                 CHAINERX_ASSERT(input_array_node != nullptr);
-                nonstd::optional<Array>& input_grad = input_grads[i_input_grad];
 
                 try {
-                    internal::SetGrad(
-                            input_grad,
-                            computed_input_grad,
-                            input_array_node->shape(),
-                            input_array_node->dtype(),
-                            input_array_node->device());
+                    if (internal::GetArrayBody(computed_input_grad) != nullptr) {
+                        internal::SetGrad(
+                                input_grads[i_input_grad],
+                                computed_input_grad,
+                                input_array_node->shape(),
+                                input_array_node->dtype(),
+                                input_array_node->device());
+                    } else {
+                        internal::AccumulateGrad(
+                                input_sparse_grads[i_input_grad],
+                                std::move(*computed_input_sparse_grad),
+                                input_array_node->shape(),
+                                input_array_node->dtype(),
+                                input_array_node->device());
+                    }
                 } catch (const GradientError& e) {
                     // TODO(niboshi): Use std::nested_exception
                     throw GradientError{e.what(), " Op: ", op_node->name()};
@@ -492,23 +561,43 @@ private:
                        });
     }
 
-    void AccumulateInputGradients(const OpNode& op_node, std::vector<nonstd::optional<Array>> gxs) {
+    void AccumulateInputGradients(
+            const OpNode& op_node, std::vector<nonstd::optional<Array>> gxs, std::vector<nonstd::optional<RowSparseGrad>> sparse_gxs) {
         gsl::span<const std::shared_ptr<ArrayNode>> input_array_nodes = op_node.input_array_nodes();
         CHAINERX_ASSERT(input_array_nodes.size() == gxs.size());
+        CHAINERX_ASSERT(input_array_nodes.size() == sparse_gxs.size());
         for (size_t i = 0; i < input_array_nodes.size(); ++i) {
             nonstd::optional<Array>& gx = gxs[i];
-            if (gx.has_value()) {
+            nonstd::optional<RowSparseGrad>& sparse_gx = sparse_gxs[i];
+            if (gx.has_value() || sparse_gx.has_value()) {
                 CHAINERX_ASSERT(input_array_nodes[i] != nullptr);
                 const ArrayNode& input_array_node = *input_array_nodes[i];
                 // Retrieve the pointer to the input gradient.
                 internal::GradRef& input_grad = array_node_grad_map_.at(input_array_nodes[i].get());
                 try {
-                    internal::AccumulateGrad(
-                            input_grad.get(),
-                            std::move(*gx),
-                            input_array_node.shape(),
-                            input_array_node.dtype(),
-                            input_array_node.device());
+                    if (gx.has_value()) {
+                        internal::AccumulateGrad(
+                                input_grad.get(),
+                                std::move(*gx),
+                                input_array_node.shape(),
+                                input_array_node.dtype(),
+                                input_array_node.device());
+                    } else if (
+                            input_grad.GetDenseGrad().has_value() ||
+                            (input_grad.sparse_grad().has_value() && input_grad.sparse_grad()->axis() != sparse_gx->axis())) {
+                        // The rows are added to the dense gradient if any.
+                        // Row-sparse gradients along different axes cannot be merged, in which case the gradient is densified.
+                        internal::AccumulateGrad(
+                                input_grad.get(), *sparse_gx, input_array_node.shape(), input_array_node.dtype(), input_array_node.device());
+                    } else {
+                        // Row-sparse gradients are merged without densification until the gradient is needed.
+                        internal::AccumulateGrad(
+                                input_grad.sparse_grad(),
+                                std::move(*sparse_gx),
+                                input_array_node.shape(),
+                                input_array_node.dtype(),
+                                input_array_node.device());
+                    }
                 } catch (const GradientError& e) {
                     // TODO(niboshi): Use std::nested_exception
                     throw GradientError{e.what(), " Op: ", op_node.name()};
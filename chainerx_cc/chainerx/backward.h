@@ -14,6 +14,7 @@
 namespace chainerx {
 
 class BackwardContext;
+class RowSparseGrad;
 
 namespace internal {
 
@@ -23,6 +24,15 @@ class ArrayNode;
 // Throws GradientError in case of mismatch in gradient array props.
 void AccumulateGrad(nonstd::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device);
 
+// Adds a row-sparse partial gradient to the dense target gradient, in-place if possible.
+// Throws GradientError in case of mismatch in gradient array props.
+void AccumulateGrad(nonstd::optional<Array>& target_grad, const RowSparseGrad& partial_grad, const Shape& shape, Dtype dtype, Device& device);
+
+// Merges a row-sparse partial gradient into the row-sparse target gradient without densification.
+// Throws GradientError in case of mismatch in gradient array props.
+void AccumulateGrad(
+        nonstd::optional<RowSparseGrad>& target_grad, RowSparseGrad partial_grad, const Shape& shape, Dtype dtype, Device& device);
+
 // Throws GradientError in case of mismatch in gradient array props.
 void SetGrad(nonstd::optional<Array>& target_grad, Array grad, const Shape& shape, Dtype dtype, Device& device);
 
@@ -49,7 +49,7 @@ std::unordered_map<BackpropId, BackwardBuilder::Target::InputArrayNodes> Backwar
             // Need to access the input array via the builder.
             const Array& input = gsl::at(builder_.inputs_, input_index);
 
-            for (std::shared_ptr<ArrayNode>& input_array_node : internal::GetArrayBody(input)->nodes()) {
+            for (const std::shared_ptr<ArrayNode>& input_array_node : internal::GetArrayBody(input)->nodes()) {
                 const BackpropId& backprop_id = input_array_node->backprop_id();
                 if (!IsBackpropRequired(backprop_id)) {
                     continue;
@@ -131,8 +131,10 @@ BackwardBuilder::BackwardBuilder(const char* op_name, std::vector<ConstArrayRef>
     CHAINERX_ASSERT(std::all_of(
             inputs_.begin(), inputs_.end(), [this](const Array& input) { return &inputs_.begin()->get().device() == &input.device(); }));
 
-    has_any_applicable_outputs_ =
-            std::any_of(outputs_.begin(), outputs_.end(), [](const Array& output) { return GetKind(output.dtype()) == DtypeKind::kFloat; });
+    // No graph is recorded in the inference mode, where all the targets are left undefined.
+    has_any_applicable_outputs_ = !IsInferenceMode() && std::any_of(outputs_.begin(), outputs_.end(), [](const Array& output) {
+        return GetKind(output.dtype()) == DtypeKind::kFloat;
+    });
 }
 
 std::shared_ptr<OpNode>& BackwardBuilder::FindOrCreateOpNode(const BackpropId& backprop_id) {
@@ -150,13 +152,17 @@ std::shared_ptr<OpNode>& BackwardBuilder::FindOrCreateOpNode(const BackpropId& b
 
 RetainedInputToken BackwardBuilder::RetainInput(size_t input_index) {
     CHAINERX_ASSERT(input_index < inputs_.size());
-    input_retention_record_.Record(input_index);
+    if (has_any_applicable_outputs_) {
+        input_retention_record_.Record(input_index);
+    }
     return {internal::GetArrayBody(gsl::at(inputs_, input_index))->GetParams(), input_index};
 }
 
 RetainedOutputToken BackwardBuilder::RetainOutput(size_t output_index) {
     CHAINERX_ASSERT(output_index < outputs_.size());
-    output_retention_record_.Record(output_index);
+    if (has_any_applicable_outputs_) {
+        output_retention_record_.Record(output_index);
+    }
     return {internal::GetArrayBody(gsl::at(outputs_, output_index))->GetParams(), output_index};
 }
 
@@ -165,11 +171,14 @@ void BackwardBuilder::Finalize() {
     // Checks that the backward definitions cover all the input arrays.
     CHAINERX_ASSERT(std::all_of(inputs_target_created_.begin(), inputs_target_created_.end(), [](bool done) { return done; }));
 
-    AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention();
+    // Nothing to connect if no backward has been defined, e.g. in the no-backprop mode or in the inference mode.
+    if (!op_node_map_.empty()) {
+        AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention();
 
-    // Connect each pair of backprop IDs concerned in this op.
-    // If two backprop IDs are connected, backpropping on the one with lower ordinal will prohibit future backprop on the other.
-    ConnectBackpropIds();
+        // Connect each pair of backprop IDs concerned in this op.
+        // If two backprop IDs are connected, backpropping on the one with lower ordinal will prohibit future backprop on the other.
+        ConnectBackpropIds();
+    }
 
     is_finalized_ = true;
 }
@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 
 #include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backprop_mode.h"
 #include "chainerx/backward.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/dtype.h"
@@ -69,6 +71,39 @@ TEST(BackwardBuilderTest, FloatToInt_PartiallyBackproppable) {
     Backward(y2);
 }
 
+TEST(BackwardBuilderTest, InferenceMode) {
+    testing::ContextSession context_session;
+
+    auto forward = [](const Array& x, Array& y) {
+        y = Ones({2, 3}, Dtype::kFloat32, x.device());
+
+        BackwardBuilder bb{"forward", x, y};
+        BackwardBuilder::Target bt = bb.CreateTarget(0);
+        EXPECT_FALSE(static_cast<bool>(bt));
+        bb.RetainInput(0);
+        bb.RetainOutput(0);
+        bb.Finalize();
+    };
+
+    Array x = Ones({2, 3}, Dtype::kFloat32).RequireGrad();
+    Array y{};
+    {
+        InferenceModeScope scope{};
+        forward(x, y);
+    }
+    EXPECT_TRUE(internal::GetArrayBody(y)->nodes().empty());
+    EXPECT_FALSE(y.IsBackpropRequired());
+
+    // Routines do not record graphs either.
+    Array z{};
+    {
+        InferenceModeScope scope{};
+        z = x * x + x;
+    }
+    EXPECT_TRUE(internal::GetArrayBody(z)->nodes().empty());
+    EXPECT_TRUE((x * x).IsBackpropRequired());
+}
+
 TEST(BackwardBuilderTest, FloatToInt_GetIntRetainOutputFirstParam) {
     testing::ContextSession context_session;
     Shape shape{2, 3};
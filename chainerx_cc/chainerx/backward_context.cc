@@ -15,11 +15,13 @@
 #include "chainerx/array_body.h"
 #include "chainerx/array_node.h"
 #include "chainerx/backprop_mode.h"
+#include "chainerx/backward.h"
 #include "chainerx/device.h"
 #include "chainerx/error.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/row_sparse_grad.h"
 
 namespace chainerx {
 namespace {
@@ -35,6 +37,7 @@ namespace internal {
 GradRef::GradRef(ArrayNode& array_node) : original_grad_owner_body_{array_node.weak_body().lock()} {
     if (original_grad_owner_body_ != nullptr) {
         original_grad_ptr_ = original_grad_owner_body_->GetGrad(array_node.backprop_id());
+        sparse_grad_backprop_id_ = array_node.backprop_id();
     }
 }
 
@@ -47,6 +50,33 @@ GradRef::GradRef(nonstd::optional<Array>* grad) : original_grad_ptr_{grad} {
 }
 
 nonstd::optional<Array>& GradRef::get() {
+    if (sparse_grad_backprop_id_.has_value()) {
+        original_grad_owner_body_->DensifyGrad(*sparse_grad_backprop_id_);
+        return *original_grad_ptr_;
+    }
+    nonstd::optional<Array>& grad = GetDenseGrad();
+    if (temporary_sparse_grad_.has_value()) {
+        const RowSparseGrad& sparse_grad = *temporary_sparse_grad_;
+        AccumulateGrad(grad, sparse_grad, sparse_grad.shape(), sparse_grad.dtype(), sparse_grad.device());
+        temporary_sparse_grad_.reset();
+    }
+    return grad;
+}
+
+nonstd::optional<RowSparseGrad>& GradRef::sparse_grad() {
+    if (sparse_grad_backprop_id_.has_value()) {
+        return original_grad_owner_body_->GetOrCreateRowSparseGrad(*sparse_grad_backprop_id_);
+    }
+    return temporary_sparse_grad_;
+}
+
+void GradRef::FlushSparseGrad() {
+    if (original_grad_ptr_ != nullptr && !sparse_grad_backprop_id_.has_value()) {
+        get();
+    }
+}
+
+nonstd::optional<Array>& GradRef::GetDenseGrad() {
     if (original_grad_ptr_ == nullptr) {
         if (temporary_grad_ == nullptr) {
             // Original gradient is gone and this is the first accumulation.
@@ -70,19 +100,22 @@ BackwardContext::BackwardContext(
         gsl::span<std::shared_ptr<ArrayNode>> output_array_nodes,
         gsl::span<internal::GradRef*> output_grads,
         std::vector<Array>& input_grads,
+        std::vector<nonstd::optional<RowSparseGrad>>& input_sparse_grads,
         DoubleBackpropOption double_backprop_option)
     : op_node_{op_node},
       backward_entry_{backward_entry},
       output_array_nodes_{output_array_nodes},
       output_grads_{output_grads},
       input_grads_{input_grads},
+      input_sparse_grads_{input_sparse_grads},
       double_backprop_option_{double_backprop_option} {
     CHAINERX_ASSERT(op_node.get() == &backward_entry.op_node());
     CHAINERX_ASSERT(output_array_nodes_.size() == output_grads_.size());
     CHAINERX_ASSERT(input_grads_.size() == op_node->input_array_node_count());
+    CHAINERX_ASSERT(input_sparse_grads_.size() == input_grads_.size());
 
     // Input grads must be initialized with null-body arrays.
-    const std::vector<size_t>& input_grad_indices = backward_entry.input_array_node_indices();
+    const internal::OpNodeBackwardEntry::InputArrayNodeIndices& input_grad_indices = backward_entry.input_array_node_indices();
     CHAINERX_ASSERT(std::all_of(input_grad_indices.begin(), input_grad_indices.end(), [&](const size_t& index) {
         return internal::GetArrayBody(gsl::at(input_grads_, index)) == nullptr;
     }));
@@ -96,7 +129,7 @@ BackwardContext::BackwardContext(
 bool BackwardContext::HasOutputGrad(size_t output_index) const { return gsl::at(output_grads_, output_index)->get().has_value(); }
 
 bool BackwardContext::is_input_grad_required(size_t input_index) const {
-    const std::vector<size_t>& input_grad_indices = backward_entry_.input_array_node_indices();
+    const internal::OpNodeBackwardEntry::InputArrayNodeIndices& input_grad_indices = backward_entry_.input_array_node_indices();
     CHAINERX_ASSERT(std::find(input_grad_indices.begin(), input_grad_indices.end(), input_index) != input_grad_indices.end());
 
     return op_node_->HasInputArrayNode(input_index);
@@ -111,13 +144,24 @@ const nonstd::optional<Array>& BackwardContext::output_grad(size_t output_index)
 }
 
 Array& BackwardContext::input_grad() {
-    const std::vector<size_t>& input_grad_indices = backward_entry_.input_array_node_indices();
+    const internal::OpNodeBackwardEntry::InputArrayNodeIndices& input_grad_indices = backward_entry_.input_array_node_indices();
     CHAINERX_ASSERT(input_grad_indices.size() == 1);
     return input_grad(input_grad_indices.front());
 }
 
 Array& BackwardContext::input_grad(size_t index) { return gsl::at(input_grads_, index); }
 
+void BackwardContext::SetRowSparseInputGrad(RowSparseGrad grad) {
+    const internal::OpNodeBackwardEntry::InputArrayNodeIndices& input_grad_indices = backward_entry_.input_array_node_indices();
+    CHAINERX_ASSERT(input_grad_indices.size() == 1);
+    SetRowSparseInputGrad(input_grad_indices.front(), std::move(grad));
+}
+
+void BackwardContext::SetRowSparseInputGrad(size_t index, RowSparseGrad grad) {
+    CHAINERX_ASSERT(!next_required());
+    gsl::at(input_sparse_grads_, index) = std::move(grad);
+}
+
 namespace {
 
 // Returns the pointers to array nodes for all graphs in the input array corresponding to the input_index.
@@ -14,6 +14,7 @@
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
+#include "chainerx/row_sparse_grad.h"
 
 namespace chainerx {
 namespace internal {
@@ -45,9 +46,22 @@ public:
     GradRef& operator=(GradRef&&) = delete;
 
     // Returns the reference to the gradient.
+    // The pending row-sparse gradient, if any, is accumulated into the gradient beforehand.
     nonstd::optional<Array>& get();
 
+    // Returns the reference to the gradient without accumulating the pending row-sparse gradient.
+    nonstd::optional<Array>& GetDenseGrad();
+
+    // Returns the reference to the row-sparse gradient which is pending accumulation into the gradient.
+    // It is held by the array body if alive, so that the gradient of the array can be kept row-sparse after backward.
+    nonstd::optional<RowSparseGrad>& sparse_grad();
+
+    // Accumulates the pending row-sparse gradient into the gradient, unless it is held by the array body or the gradient is temporary.
+    // It is called at the end of backward for gradients returned in the dense form.
+    void FlushSparseGrad();
+
 private:
+
     // Pointer to the original gradient held by the original input array body.
     // If the array body is gone, this pointer will be nullptr.
     nonstd::optional<Array>* original_grad_ptr_{nullptr};
@@ -58,6 +72,13 @@ private:
 
     // Temporary gradient instantiated only when the original array body is gone.
     std::unique_ptr<nonstd::optional<Array>> temporary_grad_;
+
+    // Backprop ID of the array node, set if the row-sparse gradient is held by `original_grad_owner_body_`.
+    nonstd::optional<BackpropId> sparse_grad_backprop_id_;
+
+    // Row-sparse gradient accumulated separately if the array body is not available, so that the gradient is not densified as long as only
+    // row-sparse gradients are propagated.
+    nonstd::optional<RowSparseGrad> temporary_sparse_grad_;
 };
 
 }  // namespace internal
@@ -74,12 +95,14 @@ public:
     // `input_grads_storage` is where input gradients returned by backward functions will be stored.
     // Its size must be equal to the number of input arrays whose gradients are to be returned in this single backward function (1 in most
     // ordinary functions).
+    // `input_sparse_grads` is where row-sparse input gradients will be stored. Its size must be equal to that of `input_grads`.
     BackwardContext(
             const std::shared_ptr<internal::OpNode>& op_node,
             const internal::OpNodeBackwardEntry& backward_entry,
             gsl::span<std::shared_ptr<internal::ArrayNode>> output_array_nodes,
             gsl::span<internal::GradRef*> output_grads,
             std::vector<Array>& input_grads,
+            std::vector<nonstd::optional<RowSparseGrad>>& input_sparse_grads,
             DoubleBackpropOption double_backprop_option);
 
     size_t input_count() const { return input_grads_.size(); }
@@ -114,6 +137,14 @@ public:
     // Returns the reference to the input gradient.
     Array& input_grad(size_t index);
 
+    // Sets the input gradient as a row-sparse gradient, which is accumulated without densification as long as possible.
+    // Row-sparse gradients are not differentiable, so it must not be used if next_required() is true.
+    void SetRowSparseInputGrad(RowSparseGrad grad);
+
+    // Sets the input gradient as a row-sparse gradient, which is accumulated without densification as long as possible.
+    // Row-sparse gradients are not differentiable, so it must not be used if next_required() is true.
+    void SetRowSparseInputGrad(size_t index, RowSparseGrad grad);
+
     // TODO(hvy): Write comment.
     Array GetRetainedInput(const RetainedInputToken& token);
 
@@ -141,6 +172,9 @@ private:
     // Unset gradients will have null array body.
     std::vector<Array>& input_grads_;
 
+    // A reference to the storage of row-sparse input gradients, which are set instead of the input gradients of the same indices.
+    std::vector<nonstd::optional<RowSparseGrad>>& input_sparse_grads_;
+
     std::vector<std::shared_ptr<internal::ArrayBody>> retained_input_array_bodies_;
 
     // Array bodies for retained outputs.
@@ -28,6 +28,10 @@
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/explog.h"
+#include "chainerx/routines/indexing.h"
+#include "chainerx/routines/misc.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/row_sparse_grad.h"
 #include "chainerx/shape.h"
 #include "chainerx/testing/array.h"
 #include "chainerx/testing/array_check.h"
@@ -3012,5 +3016,226 @@ TEST(BackpropGradValidationTest, InvalidGradDevice) {
     EXPECT_THROW(Backward({y1}, backprop_id, DoubleBackpropOption::kDisable), GradientError);
 }
 
+class AccumulateGradTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    Device& device() { return device_session_->device(); }
+
+private:
+    nonstd::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(AccumulateGradTest, Inplace) {
+    using T = float;
+    Shape shape{2, 3};
+    nonstd::optional<Array> target_grad{};
+
+    internal::AccumulateGrad(target_grad, testing::BuildArray(shape).WithLinearData<T>(), shape, Dtype::kFloat32, device());
+    ASSERT_TRUE(target_grad.has_value());
+    std::shared_ptr<internal::ArrayBody> body = internal::GetArrayBody(*target_grad);
+    std::weak_ptr<internal::ArrayBody> weak_body = body;
+    body.reset();
+
+    // The target gradient is exclusively owned, thus it should be updated in-place.
+    internal::AccumulateGrad(target_grad, testing::BuildArray(shape).WithLinearData<T>(1), shape, Dtype::kFloat32, device());
+    EXPECT_EQ(weak_body.lock(), internal::GetArrayBody(*target_grad));
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(1, 2), *target_grad);
+}
+
+TEST_F(AccumulateGradTest, NotInplaceIfReferenced) {
+    using T = float;
+    Shape shape{2, 3};
+    Array initial_grad = testing::BuildArray(shape).WithLinearData<T>();
+    nonstd::optional<Array> target_grad{initial_grad};
+
+    // The initial gradient is still referenced, thus it must not be modified.
+    internal::AccumulateGrad(target_grad, testing::BuildArray(shape).WithLinearData<T>(1), shape, Dtype::kFloat32, device());
+    EXPECT_NE(internal::GetArrayBody(initial_grad), internal::GetArrayBody(*target_grad));
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(), initial_grad);
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(1, 2), *target_grad);
+}
+
+TEST_F(AccumulateGradTest, NotInplaceIfDataIsShared) {
+    using T = float;
+    Shape shape{2, 3};
+    Array base = testing::BuildArray(shape).WithLinearData<T>();
+    nonstd::optional<Array> target_grad{base.MakeView()};
+
+    // The view is the sole reference to its body, but the data is shared with another array.
+    internal::AccumulateGrad(target_grad, testing::BuildArray(shape).WithLinearData<T>(1), shape, Dtype::kFloat32, device());
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(), base);
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(1, 2), *target_grad);
+}
+
+TEST_F(AccumulateGradTest, NotInplaceIfBroadcasted) {
+    using T = float;
+    Shape shape{2, 3};
+    nonstd::optional<Array> target_grad{Full({}, T{1}, Dtype::kFloat32).BroadcastTo(shape)};
+
+    // Broadcasted arrays cannot be updated in-place, even if they are exclusively owned.
+    internal::AccumulateGrad(target_grad, testing::BuildArray(shape).WithLinearData<T>(), shape, Dtype::kFloat32, device());
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(1), *target_grad);
+}
+
+TEST_F(AccumulateGradTest, NotInplaceIfDoubleBackprop) {
+    using T = float;
+    Shape shape{2, 3};
+    BackpropScope backprop_scope{"bp"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+    nonstd::optional<Array> target_grad{testing::BuildArray(shape).WithLinearData<T>().Build().RequireGrad(backprop_id)};
+    Array partial_grad = testing::BuildArray(shape).WithLinearData<T>(1).Build().RequireGrad(backprop_id);
+
+    // The accumulation must be recorded in the graph.
+    internal::AccumulateGrad(target_grad, partial_grad, shape, Dtype::kFloat32, device());
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(1, 2), *target_grad);
+    EXPECT_TRUE(target_grad->IsBackpropRequired(backprop_id));
+}
+
+TEST_F(AccumulateGradTest, SharedParameter) {
+    // y = x * x * ... * x (4 times), where many partial gradients are accumulated into x.
+    using T = double;
+    Array x = testing::BuildArray({2}).WithData<T>({1, 2}).Build().RequireGrad();
+    Array y = x;
+    for (int i = 0; i < 3; ++i) {
+        y = y * x;
+    }
+    Backward(y);
+    EXPECT_ARRAY_ALL_CLOSE(testing::BuildArray({2}).WithData<T>({4, 32}), *x.GetGrad());
+}
+
+TEST_F(AccumulateGradTest, RowSparseMerge) {
+    using T = float;
+    Shape shape{4, 2};
+    nonstd::optional<RowSparseGrad> target_grad{};
+
+    internal::AccumulateGrad(
+            target_grad,
+            RowSparseGrad{testing::BuildArray({2}).WithData<int64_t>({1, 3}), testing::BuildArray({2, 2}).WithLinearData<T>(), 0, shape},
+            shape,
+            Dtype::kFloat32,
+            device());
+    internal::AccumulateGrad(
+            target_grad,
+            RowSparseGrad{testing::BuildArray({1}).WithData<int32_t>({1}), testing::BuildArray({1, 2}).WithLinearData<T>(4), 0, shape},
+            shape,
+            Dtype::kFloat32,
+            device());
+    ASSERT_TRUE(target_grad.has_value());
+
+    // Only the touched rows are held.
+    EXPECT_EQ(3, target_grad->row_count());
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<T>({0, 0, 4, 6, 0, 0, 2, 3}), target_grad->ToDense());
+}
+
+TEST_F(AccumulateGradTest, RowSparseInplace) {
+    using T = float;
+    Shape shape{3, 2};
+    nonstd::optional<Array> target_grad{testing::BuildArray(shape).WithLinearData<T>().Build()};
+    std::weak_ptr<internal::ArrayBody> weak_body = internal::GetArrayBody(*target_grad);
+
+    // The target gradient is exclusively owned, thus only the touched rows should be updated in-place.
+    internal::AccumulateGrad(
+            target_grad,
+            RowSparseGrad{testing::BuildArray({2}).WithData<int64_t>({2, 2}), testing::BuildArray({2, 2}).WithLinearData<T>(1), 0, shape},
+            shape,
+            Dtype::kFloat32,
+            device());
+    EXPECT_EQ(weak_body.lock(), internal::GetArrayBody(*target_grad));
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<T>({0, 1, 2, 3, 8, 11}), *target_grad);
+}
+
+TEST_F(AccumulateGradTest, RowSparseNotInplaceIfReferenced) {
+    using T = float;
+    Shape shape{3, 2};
+    Array initial_grad = testing::BuildArray(shape).WithLinearData<T>();
+    nonstd::optional<Array> target_grad{initial_grad};
+
+    internal::AccumulateGrad(
+            target_grad,
+            RowSparseGrad{testing::BuildArray({1}).WithData<int64_t>({0}), testing::BuildArray({1, 2}).WithLinearData<T>(1), 0, shape},
+            shape,
+            Dtype::kFloat32,
+            device());
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithLinearData<T>(), initial_grad);
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<T>({1, 3, 2, 3, 4, 5}), *target_grad);
+}
+
+TEST_F(AccumulateGradTest, RowSparseMismatch) {
+    using T = float;
+    Shape shape{3, 2};
+    nonstd::optional<RowSparseGrad> target_grad{};
+    RowSparseGrad grad{testing::BuildArray({1}).WithData<int64_t>({0}), testing::BuildArray({1, 2}).WithLinearData<T>(), 0, shape};
+
+    EXPECT_THROW(internal::AccumulateGrad(target_grad, grad, Shape{3, 3}, Dtype::kFloat32, device()), GradientError);
+    EXPECT_THROW(internal::AccumulateGrad(target_grad, grad, shape, Dtype::kFloat64, device()), GradientError);
+}
+
+TEST_F(AccumulateGradTest, SharedRowSparseParameter) {
+    // The gradients of multiple lookups from the same table are merged, including ones along another axis.
+    using T = double;
+    Array w = testing::BuildArray({4, 2}).WithLinearData<T>().Build().RequireGrad();
+    Array y1 = Take(w, testing::BuildArray({2}).WithData<int64_t>({0, 2}), 0);
+    Array y2 = Take(w, testing::BuildArray({2}).WithData<int32_t>({2, -1}), 0);
+    Array y3 = Take(w, testing::BuildArray({2}).WithData<int64_t>({1, 0}), 1);
+    Array y = Sum(y1 * y1) + Sum(y2) + Sum(y3);
+    Backward(y);
+    EXPECT_ARRAY_ALL_CLOSE(testing::BuildArray({4, 2}).WithData<T>({1, 3, 1, 1, 10, 12, 2, 2}), *w.GetGrad());
+}
+
+TEST_F(AccumulateGradTest, RowSparseGradKeptOnArray) {
+    // The gradient of a table only looked up by Take is kept row-sparse until the dense gradient is requested.
+    using T = double;
+    Array w = testing::BuildArray({4, 2}).WithLinearData<T>().Build().RequireGrad();
+    auto take = [&w](std::vector<int64_t> indices) {
+        return Take(w, testing::BuildArray({static_cast<int64_t>(indices.size())}).WithData<int64_t>(indices), 0);
+    };
+    Backward(Sum(take({0, 2})) + Sum(take({2}) * Scalar{2}));
+    ASSERT_TRUE(w.GetRowSparseGrad().has_value());
+    EXPECT_EQ(3, w.GetRowSparseGrad()->row_count());
+
+    // Gradients of further backward calls are merged without densification.
+    Backward(Sum(take({3})));
+    ASSERT_TRUE(w.GetRowSparseGrad().has_value());
+    EXPECT_EQ(4, w.GetRowSparseGrad()->row_count());
+
+    // GetGrad() densifies the gradient, to which gradients of further backward calls are added.
+    EXPECT_ARRAY_EQ(testing::BuildArray({4, 2}).WithData<T>({1, 1, 0, 0, 3, 3, 1, 1}), *w.GetGrad());
+    EXPECT_FALSE(w.GetRowSparseGrad().has_value());
+    Backward(Sum(take({1})));
+    EXPECT_FALSE(w.GetRowSparseGrad().has_value());
+    EXPECT_ARRAY_EQ(testing::BuildArray({4, 2}).WithData<T>({1, 1, 1, 1, 3, 3, 1, 1}), *w.GetGrad());
+
+    w.ClearGrad();
+    Backward(Sum(take({1})));
+    ASSERT_TRUE(w.GetRowSparseGrad().has_value());
+    w.ClearGrad();
+    EXPECT_FALSE(w.GetRowSparseGrad().has_value());
+    EXPECT_FALSE(w.GetGrad().has_value());
+
+    // Gradients returned by Grad() are dense.
+    Array y = Sum(take({0}));
+    std::vector<nonstd::optional<Array>> gw = Grad({y}, {w});
+    ASSERT_TRUE(gw[0].has_value());
+    EXPECT_ARRAY_EQ(testing::BuildArray({4, 2}).WithData<T>({1, 1, 0, 0, 0, 0, 0, 0}), *gw[0]);
+    EXPECT_FALSE(w.GetGrad().has_value());
+}
+
+TEST_F(AccumulateGradTest, TakeDoubleBackprop) {
+    // The gradient is dense and differentiable if double backprop is enabled, even though the implicit upstream gradient has no graph.
+    using T = double;
+    Array w = testing::BuildArray({3, 2}).WithLinearData<T>().Build().RequireGrad();
+    Array y = Sum(Square(Take(w, testing::BuildArray({3}).WithData<int64_t>({0, 2, 0}), 0)));
+    Backward(y, nonstd::nullopt, DoubleBackpropOption::kEnable);
+    Array gw = *w.GetGrad();
+    EXPECT_ARRAY_ALL_CLOSE(testing::BuildArray({3, 2}).WithData<T>({0, 4, 0, 0, 8, 10}), gw);
+
+    w.ClearGrad();
+    Backward(Sum(gw));
+    EXPECT_ARRAY_ALL_CLOSE(testing::BuildArray({3, 2}).WithData<T>({4, 4, 0, 0, 2, 2}), *w.GetGrad());
+}
+
 }  // namespace
 }  // namespace chainerx
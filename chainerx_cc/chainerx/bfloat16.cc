@@ -0,0 +1,86 @@
+#include "chainerx/bfloat16.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace chainerx {
+namespace {
+
+uint32_t FloatToBits(float v) {
+    uint32_t bits{};
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+float BitsToFloat(uint32_t bits) {
+    float v{};
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+// Rounds the single-precision representation to the upper 16 bits, half to even.
+// NaNs are kept quiet NaNs with the same sign, which the rounding could otherwise turn into infinities.
+uint16_t FloatbitsToBFloat16bits(uint32_t f) {
+    uint32_t rounded = (f + 0x7fffU + ((f >> 16) & 1U)) >> 16;
+    uint32_t nan = (f >> 16) | 0x0040U;
+    bool is_nan = (f & 0x7fffffffU) > 0x7f800000U;
+    return static_cast<uint16_t>(is_nan ? nan : rounded);
+}
+
+uint16_t FloatToBFloat16(float v) { return FloatbitsToBFloat16bits(FloatToBits(v)); }
+
+uint16_t DoubleToBFloat16(double v) {
+    float f = static_cast<float>(v);
+    uint32_t bits = FloatToBits(f);
+    // Rounding to single precision first may produce an exact tie between two bfloat16 values that did not exist in the original value,
+    // in which case the tie has to be broken towards the original value instead of to even.
+    if ((bits & 0xffffU) == 0x8000U && static_cast<double>(f) != v && !std::isnan(v)) {
+        bits = std::fabs(static_cast<double>(f)) > std::fabs(v) ? bits - 1 : bits + 1;
+    }
+    return FloatbitsToBFloat16bits(bits);
+}
+
+float BFloat16ToFloat(uint16_t v) { return BitsToFloat(static_cast<uint32_t>(v) << 16); }
+
+// Elements are converted in blocks of this constant size so that the compiler vectorizes the loops.
+constexpr int64_t kBlockSize = 16;
+
+}  // namespace
+
+static_assert(sizeof(BFloat16) == sizeof(uint16_t), "BFloat16 must be laid out as uint16_t for the bulk conversions.");
+
+BFloat16::BFloat16(float v) : data_{FloatToBFloat16(v)} {}
+BFloat16::BFloat16(double v) : data_{DoubleToBFloat16(v)} {}
+
+BFloat16::operator float() const { return BFloat16ToFloat(data_); }
+
+void ConvertBFloat16ToFloat(const BFloat16* src, float* dst, int64_t n) {
+    const uint16_t* CHAINERX_RESTRICT in = reinterpret_cast<const uint16_t*>(src);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    uint32_t* CHAINERX_RESTRICT out = reinterpret_cast<uint32_t*>(dst);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    int64_t i = 0;
+    for (; i + kBlockSize <= n; i += kBlockSize) {
+        for (int64_t j = 0; j < kBlockSize; ++j) {
+            out[i + j] = static_cast<uint32_t>(in[i + j]) << 16;
+        }
+    }
+    for (; i < n; ++i) {
+        out[i] = static_cast<uint32_t>(in[i]) << 16;
+    }
+}
+
+void ConvertFloatToBFloat16(const float* src, BFloat16* dst, int64_t n) {
+    const uint32_t* CHAINERX_RESTRICT in = reinterpret_cast<const uint32_t*>(src);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    uint16_t* CHAINERX_RESTRICT out = reinterpret_cast<uint16_t*>(dst);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    int64_t i = 0;
+    for (; i + kBlockSize <= n; i += kBlockSize) {
+        for (int64_t j = 0; j < kBlockSize; ++j) {
+            out[i + j] = FloatbitsToBFloat16bits(in[i + j]);
+        }
+    }
+    for (; i < n; ++i) {
+        out[i] = FloatbitsToBFloat16bits(in[i]);
+    }
+}
+
+}  // namespace chainerx
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+
+#include "chainerx/float16.h"
+#include "chainerx/macro.h"
+
+namespace chainerx {
+
+// Brain floating point, which has the 8-bit exponent of single precision and a 7-bit significand.
+//
+// Its value is the upper 16 bits of the single-precision representation, so the conversion from float is a rounding and the conversion
+// to float is a shift.
+class BFloat16 {
+private:
+    struct FromDataTag {};
+
+public:
+    // NOLINT is required since `= default` does now work with CUDA.
+    // NOLINTNEXTLINE(modernize-use-equals-default)
+    CHAINERX_HOST_DEVICE BFloat16() {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(float v);
+    CHAINERX_HOST_DEVICE explicit BFloat16(double v);
+    CHAINERX_HOST_DEVICE explicit BFloat16(Float16 v) : BFloat16{static_cast<float>(v)} {}
+
+    CHAINERX_HOST_DEVICE explicit BFloat16(bool v) : BFloat16{static_cast<float>(v)} {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(int16_t v) : BFloat16{static_cast<float>(v)} {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(uint16_t v) : BFloat16{static_cast<float>(v)} {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(int32_t v) : BFloat16{static_cast<double>(v)} {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(uint32_t v) : BFloat16{static_cast<double>(v)} {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(int64_t v) : BFloat16{static_cast<double>(v)} {}
+    CHAINERX_HOST_DEVICE explicit BFloat16(uint64_t v) : BFloat16{static_cast<double>(v)} {}
+
+    CHAINERX_HOST_DEVICE explicit operator float() const;
+    CHAINERX_HOST_DEVICE explicit operator double() const { return static_cast<double>(static_cast<float>(*this)); }
+    CHAINERX_HOST_DEVICE explicit operator Float16() const { return Float16{static_cast<float>(*this)}; }
+
+    CHAINERX_HOST_DEVICE explicit operator bool() const { return static_cast<float>(*this) != 0.0f; }
+    CHAINERX_HOST_DEVICE explicit operator int16_t() const { return static_cast<float>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator uint16_t() const { return static_cast<float>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator int32_t() const { return static_cast<double>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator uint32_t() const { return static_cast<double>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator int64_t() const { return static_cast<double>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator uint64_t() const { return static_cast<double>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator signed char() const { return static_cast<float>(*this); }
+    CHAINERX_HOST_DEVICE explicit operator unsigned char() const { return static_cast<float>(*this); }
+
+    CHAINERX_HOST_DEVICE bool operator==(BFloat16 r) const { return static_cast<float>(*this) == static_cast<float>(r); }
+    CHAINERX_HOST_DEVICE bool operator!=(BFloat16 r) const { return static_cast<float>(*this) != static_cast<float>(r); }
+    CHAINERX_HOST_DEVICE bool operator<(BFloat16 r) const { return static_cast<float>(*this) < static_cast<float>(r); }
+    CHAINERX_HOST_DEVICE bool operator>(BFloat16 r) const { return static_cast<float>(*this) > static_cast<float>(r); }
+    CHAINERX_HOST_DEVICE bool operator<=(BFloat16 r) const { return static_cast<float>(*this) <= static_cast<float>(r); }
+    CHAINERX_HOST_DEVICE bool operator>=(BFloat16 r) const { return static_cast<float>(*this) >= static_cast<float>(r); }
+    CHAINERX_HOST_DEVICE BFloat16 operator-() const { return FromData(data_ ^ 0x8000U); }
+    CHAINERX_HOST_DEVICE BFloat16 operator+(BFloat16 r) const { return BFloat16{static_cast<float>(*this) + static_cast<float>(r)}; }
+    CHAINERX_HOST_DEVICE BFloat16 operator-(BFloat16 r) const { return BFloat16{static_cast<float>(*this) - static_cast<float>(r)}; }
+    CHAINERX_HOST_DEVICE BFloat16 operator*(BFloat16 r) const { return BFloat16{static_cast<float>(*this) * static_cast<float>(r)}; }
+    CHAINERX_HOST_DEVICE BFloat16 operator/(BFloat16 r) const { return BFloat16{static_cast<float>(*this) / static_cast<float>(r)}; }
+    CHAINERX_HOST_DEVICE BFloat16& operator+=(BFloat16 r) { return *this = *this + r; }
+    CHAINERX_HOST_DEVICE BFloat16& operator-=(BFloat16 r) { return *this = *this - r; }
+    CHAINERX_HOST_DEVICE BFloat16& operator*=(BFloat16 r) { return *this = *this * r; }
+    CHAINERX_HOST_DEVICE BFloat16& operator/=(BFloat16 r) { return *this = *this / r; }
+
+    CHAINERX_HOST_DEVICE uint16_t data() const { return data_; }
+    CHAINERX_HOST_DEVICE static constexpr BFloat16 FromData(uint16_t data) { return BFloat16{data, FromDataTag{}}; }
+
+    bool IsNan() const { return (data_ & 0x7f80U) == 0x7f80U && (data_ & 0x007fU) != 0; }
+    bool IsInf() const { return (data_ & 0x7f80U) == 0x7f80U && (data_ & 0x007fU) == 0; }
+
+private:
+    CHAINERX_HOST_DEVICE constexpr BFloat16(uint16_t data, FromDataTag /*tag*/) : data_{data} {}
+    uint16_t data_{};
+};
+
+// Converts `n` contiguous bfloat16 values to single precision.
+void ConvertBFloat16ToFloat(const BFloat16* src, float* dst, int64_t n);
+
+// Converts `n` contiguous single-precision values to bfloat16, rounding half to even.
+void ConvertFloatToBFloat16(const float* src, BFloat16* dst, int64_t n);
+
+template <typename T>
+CHAINERX_HOST_DEVICE inline bool operator==(const T& l, BFloat16 r) {
+    return l == static_cast<float>(r);
+}
+
+template <typename T>
+CHAINERX_HOST_DEVICE inline bool operator==(BFloat16 l, const T& r) {
+    return static_cast<float>(l) == r;
+}
+
+template <typename T>
+CHAINERX_HOST_DEVICE inline bool operator!=(const T& l, BFloat16 r) {
+    return l != static_cast<float>(r);
+}
+
+template <typename T>
+CHAINERX_HOST_DEVICE inline bool operator!=(BFloat16 l, const T& r) {
+    return static_cast<float>(l) != r;
+}
+
+}  // namespace chainerx
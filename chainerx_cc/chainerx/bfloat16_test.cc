@@ -0,0 +1,140 @@
+#include "chainerx/bfloat16.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/float16.h"
+
+namespace chainerx {
+namespace {
+
+uint32_t FloatToBits(float v) {
+    uint32_t bits{};
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+float BitsToFloat(uint32_t bits) {
+    float v{};
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+TEST(BFloat16Test, BFloat16Zero) {
+    EXPECT_EQ(BFloat16{0.0f}.data(), 0x0000);
+    EXPECT_EQ(BFloat16{-0.0f}.data(), 0x8000);
+    EXPECT_EQ(BFloat16{0.0}.data(), 0x0000);
+    EXPECT_EQ(BFloat16{-0.0}.data(), 0x8000);
+    EXPECT_EQ(1 / static_cast<float>(BFloat16::FromData(0x0000)), std::numeric_limits<float>::infinity());
+    EXPECT_EQ(1 / static_cast<float>(BFloat16::FromData(0x8000)), -std::numeric_limits<float>::infinity());
+}
+
+TEST(BFloat16Test, BFloat16RoundTrip) {
+    // Every non-NaN bfloat16 value is exactly representable in single and double precision.
+    for (uint32_t bit = 0x0000; bit < 0x10000; ++bit) {
+        BFloat16 h = BFloat16::FromData(static_cast<uint16_t>(bit));
+        if (h.IsNan()) {
+            continue;
+        }
+        float f = static_cast<float>(h);
+        EXPECT_EQ(FloatToBits(f), bit << 16);
+        EXPECT_EQ(static_cast<double>(f), static_cast<double>(h));
+        EXPECT_EQ(h.data(), BFloat16{f}.data());
+        EXPECT_EQ(h.data(), BFloat16{static_cast<double>(h)}.data());
+    }
+}
+
+TEST(BFloat16Test, BFloat16RoundHalfToEven) {
+    // Ties are rounded to the value with the even significand.
+    EXPECT_EQ(0x3f80, BFloat16{1.0f + std::ldexp(1.0f, -8)}.data());
+    EXPECT_EQ(0x3f82, BFloat16{1.0f + 3 * std::ldexp(1.0f, -8)}.data());
+    EXPECT_EQ(0x3f80, BFloat16{1.0 + std::ldexp(1.0, -8)}.data());
+    EXPECT_EQ(0x3f82, BFloat16{1.0 + 3 * std::ldexp(1.0, -8)}.data());
+    // Values above ties are rounded up.
+    EXPECT_EQ(0x3f81, BFloat16{1.0f + std::ldexp(1.0f, -8) + std::ldexp(1.0f, -20)}.data());
+    // The tie must be broken by the double value, not by its rounding to single precision.
+    EXPECT_EQ(0x3f81, BFloat16{1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -40)}.data());
+    EXPECT_EQ(0x3f81, BFloat16{1.0 + 3 * std::ldexp(1.0, -8) - std::ldexp(1.0, -40)}.data());
+    // Values beyond the tie between the largest finite value and the next power of two overflow to infinity.
+    EXPECT_EQ(0x7f7f, BFloat16{BitsToFloat(0x7f7f7fffU)}.data());
+    EXPECT_EQ(0x7f80, BFloat16{std::numeric_limits<float>::max()}.data());
+    EXPECT_EQ(0x7f80, BFloat16{1e39}.data());
+}
+
+TEST(BFloat16Test, BFloat16Inf) {
+    EXPECT_EQ(BFloat16{std::numeric_limits<float>::infinity()}.data(), 0x7f80);
+    EXPECT_EQ(BFloat16{-std::numeric_limits<float>::infinity()}.data(), 0xff80);
+    EXPECT_EQ(BFloat16{std::numeric_limits<double>::infinity()}.data(), 0x7f80);
+    EXPECT_EQ(BFloat16{-std::numeric_limits<double>::infinity()}.data(), 0xff80);
+    EXPECT_TRUE(BFloat16::FromData(0x7f80).IsInf());
+    EXPECT_TRUE(BFloat16::FromData(0xff80).IsInf());
+    EXPECT_FALSE(BFloat16::FromData(0x7f80).IsNan());
+}
+
+TEST(BFloat16Test, BFloat16Nan) {
+    EXPECT_TRUE(BFloat16{std::numeric_limits<float>::quiet_NaN()}.IsNan());
+    EXPECT_TRUE(BFloat16{std::numeric_limits<double>::quiet_NaN()}.IsNan());
+    // NaNs whose payload is only in the lower bits must not be rounded to infinity.
+    EXPECT_TRUE(BFloat16{BitsToFloat(0x7f800001U)}.IsNan());
+    EXPECT_TRUE(BFloat16{BitsToFloat(0xffffffffU)}.IsNan());
+    EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16::FromData(0x7fc0))));
+    EXPECT_FALSE(BFloat16::FromData(0x7fc0) == BFloat16::FromData(0x7fc0));
+}
+
+TEST(BFloat16Test, BFloat16Arithmetic) {
+    BFloat16 a{1.5f};
+    BFloat16 b{-2.0f};
+    EXPECT_EQ(-0.5f, static_cast<float>(a + b));
+    EXPECT_EQ(3.5f, static_cast<float>(a - b));
+    EXPECT_EQ(-3.0f, static_cast<float>(a * b));
+    EXPECT_EQ(-0.75f, static_cast<float>(a / b));
+    EXPECT_EQ(-1.5f, static_cast<float>(-a));
+    EXPECT_TRUE(b < a);
+    EXPECT_EQ(static_cast<int32_t>(BFloat16{-3.0f}), -3);
+    EXPECT_EQ(static_cast<float>(static_cast<Float16>(BFloat16{0.25f})), 0.25f);
+    EXPECT_EQ(static_cast<float>(BFloat16{Float16{0.25f}}), 0.25f);
+}
+
+TEST(BFloat16Test, ConvertBFloat16ToFloat) {
+    std::vector<BFloat16> src{};
+    for (uint32_t bit = 0x0000; bit < 0x10000; ++bit) {
+        src.emplace_back(BFloat16::FromData(static_cast<uint16_t>(bit)));
+    }
+    src.emplace_back(BFloat16{1.0f});  // Length not a multiple of the block size.
+
+    std::vector<float> dst(src.size());
+    ConvertBFloat16ToFloat(src.data(), dst.data(), static_cast<int64_t>(src.size()));
+    for (size_t i = 0; i < src.size(); ++i) {
+        EXPECT_EQ(static_cast<uint32_t>(src[i].data()) << 16, FloatToBits(dst[i]));
+    }
+}
+
+TEST(BFloat16Test, ConvertFloatToBFloat16) {
+    std::vector<float> src{};
+    for (uint32_t bit = 0x00000000U; bit < 0x80000000U; bit += 0x00012345U) {
+        src.emplace_back(BitsToFloat(bit));
+        src.emplace_back(BitsToFloat(bit | 0x80000000U));
+    }
+    src.emplace_back(1.0f + std::ldexp(1.0f, -8));
+    src.emplace_back(std::numeric_limits<float>::infinity());
+    src.emplace_back(BitsToFloat(0x7f800001U));
+
+    std::vector<BFloat16> dst(src.size());
+    ConvertFloatToBFloat16(src.data(), dst.data(), static_cast<int64_t>(src.size()));
+    for (size_t i = 0; i < src.size(); ++i) {
+        BFloat16 expected{src[i]};
+        if (expected.IsNan()) {
+            EXPECT_TRUE(dst[i].IsNan());
+        } else {
+            EXPECT_EQ(expected.data(), dst[i].data()) << "value: " << src[i];
+        }
+    }
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -170,7 +170,9 @@ void CheckBackwardComputation(
         const std::vector<Array>& eps,
         double atol,
         double rtol,
-        const nonstd::optional<BackpropId>& backprop_id) {
+        const nonstd::optional<BackpropId>& backprop_id,
+        bool elementwise,
+        bool parallel) {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(inputs.front(), backprop_id);
 
     // Compute backward gradients
@@ -210,7 +212,7 @@ void CheckBackwardComputation(
     }
 
     // Compute numerical gradients
-    const std::vector<Array> numerical_grads = CalculateNumericalGradient(func, inputs, grad_outputs, eps);
+    const std::vector<Array> numerical_grads = CalculateNumericalGradient(func, inputs, grad_outputs, eps, elementwise, parallel);
 
     // If you're trapped in any of these asserts, numerical gradiends must be implemented incorrectly.
     if (CHAINERX_DEBUG) {
@@ -267,7 +269,9 @@ void CheckBackward(
         size_t concurrent_check_thread_count,
         double atol,
         double rtol,
-        const nonstd::optional<BackpropId>& backprop_id) {
+        const nonstd::optional<BackpropId>& backprop_id,
+        bool elementwise,
+        bool parallel) {
     if (CHAINERX_DEBUG) {
         CHAINERX_ASSERT(!inputs.empty());
         CHAINERX_ASSERT(
@@ -300,7 +304,7 @@ void CheckBackward(
         internal::ArrayBodyLeakTracker tracker{};
         {
             internal::ArrayBodyLeakDetectionScope scope{tracker};
-            CheckBackwardComputation(func, inputs, grad_outputs, eps, atol, rtol, backprop_id);
+            CheckBackwardComputation(func, inputs, grad_outputs, eps, atol, rtol, backprop_id, elementwise, parallel);
         }
         CheckAllArrayBodiesFreed(tracker);
     }
@@ -322,10 +326,12 @@ void CheckBackward(
             }
             testing::RunThreads(
                     concurrent_check_thread_count,
-                    [&func, &broadcasted_inputs, &grad_outputs, &eps, &atol, &rtol, &backprop_id, &context, &device](size_t thread_index) {
+                    [&func, &broadcasted_inputs, &grad_outputs, &eps, &atol, &rtol, &backprop_id, elementwise, parallel, &context, &device](
+                            size_t thread_index) {
                         chainerx::SetDefaultContext(&context);
                         chainerx::SetDefaultDevice(&device);
-                        CheckBackwardComputation(func, broadcasted_inputs[thread_index], grad_outputs, eps, atol, rtol, backprop_id);
+                        CheckBackwardComputation(
+                                func, broadcasted_inputs[thread_index], grad_outputs, eps, atol, rtol, backprop_id, elementwise, parallel);
                     });
         }
         CheckAllArrayBodiesFreed(tracker);
@@ -342,7 +348,9 @@ void CheckDoubleBackwardComputationImpl(
         const std::vector<Array>& eps,
         double atol,
         double rtol,
-        const nonstd::optional<BackpropId>& backprop_id) {
+        const nonstd::optional<BackpropId>& backprop_id,
+        bool elementwise,
+        bool parallel) {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(inputs.front(), backprop_id);
     const std::size_t nin = inputs.size();
     const std::size_t nout = grad_outputs.size();
@@ -430,7 +438,8 @@ void CheckDoubleBackwardComputationImpl(
     std::copy(inputs.begin(), inputs.end(), std::back_inserter(inputs_and_grad_outputs));
     std::copy(grad_outputs.begin(), grad_outputs.end(), std::back_inserter(inputs_and_grad_outputs));
 
-    CheckBackwardComputation(first_order_grad_func, inputs_and_grad_outputs, grad_grad_inputs, eps, atol, rtol, backprop_id);
+    CheckBackwardComputation(
+            first_order_grad_func, inputs_and_grad_outputs, grad_grad_inputs, eps, atol, rtol, backprop_id, elementwise, parallel);
 }
 
 }  // namespace
@@ -444,7 +453,9 @@ void CheckDoubleBackwardComputation(
         size_t concurrent_check_thread_count,
         double atol,
         double rtol,
-        const nonstd::optional<BackpropId>& backprop_id) {
+        const nonstd::optional<BackpropId>& backprop_id,
+        bool elementwise,
+        bool parallel) {
     if (CHAINERX_DEBUG) {
         CHAINERX_ASSERT(!inputs.empty());
         CHAINERX_ASSERT(
@@ -488,7 +499,9 @@ void CheckDoubleBackwardComputation(
                     eps,
                     atol,
                     rtol,
-                    backprop_id);
+                    backprop_id,
+                    elementwise,
+                    parallel);
         }
         CheckAllArrayBodiesFreed(tracker);
     }
@@ -523,6 +536,8 @@ void CheckDoubleBackwardComputation(
                      &atol,
                      &rtol,
                      &backprop_id,
+                     elementwise,
+                     parallel,
                      &context,
                      &device](size_t thread_index) {
                         chainerx::SetDefaultContext(&context);
@@ -535,7 +550,9 @@ void CheckDoubleBackwardComputation(
                                 eps,
                                 atol,
                                 rtol,
-                                backprop_id);
+                                backprop_id,
+                                elementwise,
+                                parallel);
                     });
         }
         CheckAllArrayBodiesFreed(tracker);
@@ -16,6 +16,10 @@ namespace chainerx {
 // correctly implemented, starting from the initial gradient given by `grad_outputs`.
 //
 // It throws GradientCheckError when the test fails.
+//
+// `elementwise` and `parallel` are passed to `CalculateNumericalGradient`. If `func` is an elementwise function, `elementwise` can be
+// set to compute the numerical gradients with only two evaluations for each input. If `parallel` is set, `func` is called concurrently
+// from the native thread pool and must therefore be thread safe.
 void CheckBackward(
         const std::function<std::vector<Array>(const std::vector<Array>&)>& func,
         const std::vector<Array>& inputs,
@@ -24,7 +28,9 @@ void CheckBackward(
         size_t concurrent_check_thread_count = 2U,
         double atol = 1e-5,
         double rtol = 1e-4,
-        const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt);
+        const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt,
+        bool elementwise = false,
+        bool parallel = false);
 
 // Tests twice differentiation of a given procedure.
 //
@@ -44,6 +50,8 @@ void CheckBackward(
 // by the usual `Backward` is correct. The implementation of each differentiable
 // function should be tested by `CheckBackwardComputation` first, and then should be
 // tested by this function if neccessary.
+//
+// `elementwise` and `parallel` are the same as those of `CheckBackward`.
 void CheckDoubleBackwardComputation(
         const std::function<std::vector<Array>(const std::vector<Array>&)>& func,
         const std::vector<Array>& inputs,
@@ -53,6 +61,8 @@ void CheckDoubleBackwardComputation(
         size_t concurrent_check_thread_count = 2U,
         double atol = 1e-5,
         double rtol = 1e-4,
-        const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt);
+        const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt,
+        bool elementwise = false,
+        bool parallel = false);
 
 }  // namespace chainerx
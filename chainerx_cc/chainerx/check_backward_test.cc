@@ -77,7 +77,9 @@ protected:
             const std::vector<T>& eps_data,
             double atol,
             double rtol,
-            const std::string& backprop_name) {
+            const std::string& backprop_name,
+            bool elementwise = false,
+            bool parallel = false) {
         Array input = testing::BuildArray(shape).WithData(input_data);
         BackpropScope backprop_scope{backprop_name};
 
@@ -87,9 +89,11 @@ protected:
         Arrays eps{testing::BuildArray(shape).WithData(eps_data)};
 
         if (expect_correct) {
-            CheckBackward(fprop, {input}, grad_outputs, eps, 2, atol, rtol, backprop_scope.backprop_id());
+            CheckBackward(fprop, {input}, grad_outputs, eps, 2, atol, rtol, backprop_scope.backprop_id(), elementwise, parallel);
         } else {
-            EXPECT_THROW(CheckBackward(fprop, {input}, grad_outputs, eps, 2, atol, rtol, backprop_scope.backprop_id()), GradientCheckError);
+            EXPECT_THROW(
+                    CheckBackward(fprop, {input}, grad_outputs, eps, 2, atol, rtol, backprop_scope.backprop_id(), elementwise, parallel),
+                    GradientCheckError);
         }
     }
 
@@ -115,7 +119,9 @@ protected:
             const std::vector<T>& eps_grad_output_data,
             double atol,
             double rtol,
-            const std::string& backprop_name) {
+            const std::string& backprop_name,
+            bool elementwise = false,
+            bool parallel = false) {
         Arrays inputs{testing::BuildArray(shape).WithData(input_data)};
         Arrays grad_outputs{testing::BuildArray(shape).WithData(grad_output_data)};
         Arrays grad_grad_inputs{testing::BuildArray(shape).WithData(grad_grad_input_data)};
@@ -130,7 +136,8 @@ protected:
         }
 
         // A failure occurs if backward computation and numerical gradients have differences
-        CheckDoubleBackwardComputation(fprop, inputs, grad_outputs, grad_grad_inputs, eps, 2, atol, rtol, backprop_scope.backprop_id());
+        CheckDoubleBackwardComputation(
+                fprop, inputs, grad_outputs, grad_grad_inputs, eps, 2, atol, rtol, backprop_scope.backprop_id(), elementwise, parallel);
     }
 
 private:
@@ -155,12 +162,23 @@ TEST_F(CheckBackwardTest, CorrectBackwardWithNonDoubleDifferentiableFunction) {
     CheckCheckBackward(true, fprop, {1, 3}, input_data, grad_output_data, eps_data, 1e-5, 1e-4, "bp1");
 }
 
+TEST_F(CheckBackwardTest, CorrectBackwardElementwiseOrParallel) {
+    using T = float;
+    std::vector<T> input_data{1.f, 2.f, 1.f};
+    std::vector<T> grad_output_data{0.f, -2.f, 1.f};
+    std::vector<T> eps_data{1e-3f, 1e-3f, 1e-3f};
+    Fprop fprop = [](const Arrays& inputs) -> Arrays { return {inputs[0] * inputs[0]}; };
+    CheckCheckBackward(true, fprop, {1, 3}, input_data, grad_output_data, eps_data, 1e-5, 1e-4, "bp1", true, false);
+    CheckCheckBackward(true, fprop, {1, 3}, input_data, grad_output_data, eps_data, 1e-5, 1e-4, "bp1", false, true);
+}
+
 TEST_F(CheckBackwardTest, IncorrectBackward) {
     using T = float;
     std::vector<T> input_data{-2.f, 3.f, 1.f};
     std::vector<T> grad_output_data{0.f, -2.f, 1.f};
     std::vector<T> eps_data{1e-3f, 1e-3f, 1e-3f};
     CheckCheckBackward(false, &ForwardWithIncorrectBackward, {1, 3}, input_data, grad_output_data, eps_data, 1e-5, 1e-4, "bp1");
+    CheckCheckBackward(false, &ForwardWithIncorrectBackward, {1, 3}, input_data, grad_output_data, eps_data, 1e-5, 1e-4, "bp1", true);
 }
 
 TEST_F(CheckBackwardTest, IncorrectBackwardIdenticalInputOutput) {
@@ -192,5 +210,41 @@ TEST_F(CheckDoubleBackwardTest, CorrectBackward) {
             fprop, {1, 3}, input_data, grad_output_data, grad_grad_input_data, eps_input_data, eps_grad_output_data, 1e-4, 1e-3, "bp1");
 }
 
+TEST_F(CheckDoubleBackwardTest, CorrectBackwardElementwiseOrParallel) {
+    using T = float;
+    std::vector<T> input_data{1.f, 2.f, 3.f};
+    std::vector<T> grad_output_data{1.f, -1.f, 2.f};
+    std::vector<T> grad_grad_input_data{1.f, 0.5f, 1.f};
+    std::vector<T> eps_input_data{1e-3f, 1e-3f, 1e-3f};
+    std::vector<T> eps_grad_output_data{1e-3f, 1e-3f, 1e-3f};
+    Fprop fprop = [](const Arrays& inputs) -> Arrays { return {inputs[0] * inputs[0] * inputs[0]}; };
+    CheckCheckDoubleBackward(
+            fprop,
+            {1, 3},
+            input_data,
+            grad_output_data,
+            grad_grad_input_data,
+            eps_input_data,
+            eps_grad_output_data,
+            1e-3,
+            1e-3,
+            "bp1",
+            true,
+            false);
+    CheckCheckDoubleBackward(
+            fprop,
+            {1, 3},
+            input_data,
+            grad_output_data,
+            grad_grad_input_data,
+            eps_input_data,
+            eps_grad_output_data,
+            1e-3,
+            1e-3,
+            "bp1",
+            false,
+            true);
+}
+
 }  // namespace
 }  // namespace chainerx
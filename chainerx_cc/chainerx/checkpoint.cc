@@ -0,0 +1,364 @@
+#include "chainerx/checkpoint.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/constant.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/platform.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace {
+
+// File layout (all integers are in the host byte order):
+//
+//   header:   magic (8 bytes), format version (uint32), flags (uint32), number of arrays (uint64)
+//   array:    name length (uint32), name, dtype name length (uint32), dtype name, ndim (uint32), dims (int64 * ndim),
+//             data size in bytes (uint64), data, [CRC-32 of data (uint32), if kFlagChecksum is set]
+constexpr std::array<char, 8> kMagic{{'C', 'H', 'X', 'C', 'K', 'P', 'T', '\0'}};
+constexpr uint32_t kFormatVersion = 1;
+constexpr uint32_t kFlagChecksum = 1U << 0;
+
+// Lower bound of the size of an array record: that of a 0-dim array with empty names and no data.
+constexpr uint64_t kMinArrayRecordSize = sizeof(uint32_t) * 3 + sizeof(uint64_t);
+
+// Standard CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320).
+class Crc32 {
+public:
+    void Update(const void* data, size_t size) {
+        static const std::array<uint32_t, 256> table = MakeTable();
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        uint32_t crc = ~value_;
+        for (size_t i = 0; i < size; ++i) {
+            crc = table[(crc ^ bytes[i]) & 0xFFU] ^ (crc >> 8);
+        }
+        value_ = ~crc;
+    }
+
+    uint32_t value() const { return value_; }
+
+private:
+    static std::array<uint32_t, 256> MakeTable() {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1U) != 0 ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        return table;
+    }
+
+    uint32_t value_{0};
+};
+
+// A host-side copy of an array, taken when a checkpoint is requested.
+struct ArraySnapshot {
+    std::string name;
+    Shape shape;
+    Dtype dtype;
+    std::shared_ptr<void> data;
+    size_t nbytes;
+};
+
+ArraySnapshot TakeSnapshot(std::string name, const Array& array) {
+    // The staging buffer is always contiguous. Non-contiguous arrays are packed on their own device first.
+    Array a = [&array]() {
+        NoBackpropModeScope scope{};
+        return AsContiguous(array.AsGradStopped());
+    }();
+
+    size_t nbytes = static_cast<size_t>(a.GetNBytes());
+    std::shared_ptr<void> data{};
+    if (nbytes > 0) {
+        data = std::shared_ptr<uint8_t>{new uint8_t[nbytes], std::default_delete<uint8_t[]>()};
+        Device& native_device = a.context().GetNativeBackend().GetDevice(0);
+        a.device().MemoryCopyTo(data.get(), static_cast<const uint8_t*>(a.raw_data()) + a.offset(), nbytes, native_device);
+    }
+    return ArraySnapshot{std::move(name), a.shape(), a.dtype(), std::move(data), nbytes};
+}
+
+class FileWriter {
+public:
+    explicit FileWriter(std::string path) : path_{std::move(path)}, file_{std::fopen(path_.c_str(), "wb")} {
+        if (file_ == nullptr) {
+            throw ChainerxError{"Failed to open file '", path_, "' for writing: ", std::strerror(errno)};
+        }
+    }
+
+    ~FileWriter() {
+        if (file_ != nullptr) {
+            std::fclose(file_);
+        }
+    }
+
+    FileWriter(const FileWriter&) = delete;
+    FileWriter(FileWriter&&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+    FileWriter& operator=(FileWriter&&) = delete;
+
+    void Write(const void* data, size_t size) {
+        if (size > 0 && std::fwrite(data, 1, size, file_) != size) {
+            throw ChainerxError{"Failed to write to file '", path_, "': ", std::strerror(errno)};
+        }
+    }
+
+    template <typename T>
+    void WriteValue(T value) {
+        Write(&value, sizeof(T));
+    }
+
+    void WriteString(const std::string& str) {
+        WriteValue(static_cast<uint32_t>(str.size()));
+        Write(str.data(), str.size());
+    }
+
+    void Sync() { platform::SyncFile(file_); }
+
+    void Close() {
+        gsl::owner<std::FILE*> file = file_;
+        file_ = nullptr;
+        if (0 != std::fclose(file)) {
+            throw ChainerxError{"Failed to close file '", path_, "': ", std::strerror(errno)};
+        }
+    }
+
+private:
+    std::string path_;
+    gsl::owner<std::FILE*> file_;
+};
+
+class FileReader {
+public:
+    explicit FileReader(std::string path) : path_{std::move(path)}, file_{std::fopen(path_.c_str(), "rb")} {
+        if (file_ == nullptr) {
+            throw ChainerxError{"Failed to open file '", path_, "' for reading: ", std::strerror(errno)};
+        }
+        long size = -1;  // NOLINT(google-runtime-int)
+        if (0 == std::fseek(file_, 0, SEEK_END)) {
+            size = std::ftell(file_);
+        }
+        if (size < 0 || 0 != std::fseek(file_, 0, SEEK_SET)) {
+            int error = errno;
+            std::fclose(file_);
+            throw ChainerxError{"Failed to get the size of file '", path_, "': ", std::strerror(error)};
+        }
+        remaining_ = static_cast<uint64_t>(size);
+    }
+
+    ~FileReader() { std::fclose(file_); }
+
+    FileReader(const FileReader&) = delete;
+    FileReader(FileReader&&) = delete;
+    FileReader& operator=(const FileReader&) = delete;
+    FileReader& operator=(FileReader&&) = delete;
+
+    // Throws if fewer than size bytes are left in the file.
+    // Sizes read from the file are checked with this before anything of that size is allocated.
+    void CheckRemaining(uint64_t size) const {
+        if (size > remaining_) {
+            throw ChainerxError{"Unexpected end of checkpoint file '", path_, "'."};
+        }
+    }
+
+    uint64_t remaining() const { return remaining_; }
+
+    void Read(void* data, size_t size) {
+        CheckRemaining(size);
+        if (size > 0 && std::fread(data, 1, size, file_) != size) {
+            throw ChainerxError{"Unexpected end of checkpoint file '", path_, "'."};
+        }
+        remaining_ -= size;
+    }
+
+    template <typename T>
+    T ReadValue() {
+        T value{};
+        Read(&value, sizeof(T));
+        return value;
+    }
+
+    std::string ReadString() {
+        uint32_t size = ReadValue<uint32_t>();
+        CheckRemaining(size);
+        std::string str(size, '\0');
+        Read(&str[0], str.size());
+        return str;
+    }
+
+private:
+    std::string path_;
+    gsl::owner<std::FILE*> file_;
+    uint64_t remaining_{};
+};
+
+void WriteSnapshots(const std::string& path, std::vector<ArraySnapshot> snapshots, const CheckpointOptions& options) {
+    std::string tmp_path = path + ".tmp";
+    auto remove_tmp = gsl::finally([&tmp_path]() { std::remove(tmp_path.c_str()); });
+    {
+        FileWriter writer{tmp_path};
+        writer.Write(kMagic.data(), kMagic.size());
+        writer.WriteValue(kFormatVersion);
+        writer.WriteValue(options.checksum ? kFlagChecksum : uint32_t{0});
+        writer.WriteValue(static_cast<uint64_t>(snapshots.size()));
+
+        size_t chunk_size = std::max(options.chunk_size, size_t{1});
+        for (ArraySnapshot& snapshot : snapshots) {
+            writer.WriteString(snapshot.name);
+            writer.WriteString(GetDtypeName(snapshot.dtype));
+            writer.WriteValue(static_cast<uint32_t>(snapshot.shape.ndim()));
+            for (int64_t dim : snapshot.shape) {
+                writer.WriteValue(dim);
+            }
+            writer.WriteValue(static_cast<uint64_t>(snapshot.nbytes));
+
+            Crc32 crc{};
+            const auto* data = static_cast<const uint8_t*>(snapshot.data.get());
+            for (size_t offset = 0; offset < snapshot.nbytes; offset += chunk_size) {
+                size_t size = std::min(chunk_size, snapshot.nbytes - offset);
+                writer.Write(data + offset, size);
+                if (options.checksum) {
+                    crc.Update(data + offset, size);
+                }
+            }
+            if (options.checksum) {
+                writer.WriteValue(crc.value());
+            }
+
+            // Release the staging buffer as soon as it is written to keep the peak memory low.
+            snapshot.data.reset();
+        }
+
+        if (options.sync) {
+            writer.Sync();
+        }
+        writer.Close();
+    }
+    platform::RenameFile(tmp_path, path);
+}
+
+}  // namespace
+
+CheckpointWriter::~CheckpointWriter() {
+    if (pending_.valid()) {
+        pending_.wait();
+    }
+}
+
+void CheckpointWriter::Save(std::string path, const std::vector<std::pair<std::string, Array>>& arrays) {
+    Wait();
+
+    std::vector<ArraySnapshot> snapshots;
+    snapshots.reserve(arrays.size());
+    for (const std::pair<std::string, Array>& named_array : arrays) {
+        snapshots.emplace_back(TakeSnapshot(named_array.first, named_array.second));
+    }
+
+    pending_ = std::async(
+            std::launch::async,
+            [path = std::move(path), snapshots = std::move(snapshots), options = options_]() mutable {
+                WriteSnapshots(path, std::move(snapshots), options);
+            });
+}
+
+void CheckpointWriter::Wait() {
+    if (pending_.valid()) {
+        // Invalidates the future even if it throws.
+        pending_.get();
+    }
+}
+
+std::vector<std::pair<std::string, Array>> LoadCheckpoint(const std::string& path, Device& device) {
+    FileReader reader{path};
+
+    std::array<char, 8> magic{};
+    reader.Read(magic.data(), magic.size());
+    if (magic != kMagic) {
+        throw ChainerxError{"'", path, "' is not a ChainerX checkpoint file."};
+    }
+    uint32_t version = reader.ReadValue<uint32_t>();
+    if (version != kFormatVersion) {
+        throw ChainerxError{"Unsupported checkpoint format version: ", version, " (expected ", kFormatVersion, ")."};
+    }
+    bool has_checksum = (reader.ReadValue<uint32_t>() & kFlagChecksum) != 0;
+    uint64_t count = reader.ReadValue<uint64_t>();
+    if (count > reader.remaining() / kMinArrayRecordSize) {
+        throw ChainerxError{"Invalid number of arrays in checkpoint '", path, "': ", count};
+    }
+
+    std::vector<std::pair<std::string, Array>> arrays;
+    arrays.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        std::string name = reader.ReadString();
+        Dtype dtype = GetDtype(reader.ReadString());
+        uint32_t ndim = reader.ReadValue<uint32_t>();
+        if (ndim > static_cast<uint32_t>(kMaxNdim)) {
+            throw ChainerxError{"Invalid number of dimensions of array '", name, "' in checkpoint: ", ndim};
+        }
+        Shape shape{};
+        // The data size is computed in uint64_t, with overflows rejected, as the dims are not to be trusted.
+        uint64_t expected_nbytes = static_cast<uint64_t>(GetItemSize(dtype));
+        for (uint32_t k = 0; k < ndim; ++k) {
+            int64_t dim = reader.ReadValue<int64_t>();
+            if (dim < 0) {
+                throw ChainerxError{"Negative dimension of array '", name, "' in checkpoint: ", dim};
+            }
+            if (dim != 0 && expected_nbytes > std::numeric_limits<uint64_t>::max() / static_cast<uint64_t>(dim)) {
+                throw ChainerxError{"Data size of array '", name, "' in checkpoint is too large."};
+            }
+            expected_nbytes *= static_cast<uint64_t>(dim);
+            shape.emplace_back(dim);
+        }
+        uint64_t nbytes = reader.ReadValue<uint64_t>();
+        if (nbytes != expected_nbytes) {
+            throw ChainerxError{"Data size of array '", name, "' in checkpoint does not match its shape and dtype."};
+        }
+        reader.CheckRemaining(nbytes);
+
+        std::shared_ptr<void> data{};
+        if (nbytes > 0) {
+            data = std::shared_ptr<uint8_t>{new uint8_t[nbytes], std::default_delete<uint8_t[]>()};
+            reader.Read(data.get(), nbytes);
+        }
+        if (has_checksum) {
+            Crc32 crc{};
+            crc.Update(data.get(), nbytes);
+            if (crc.value() != reader.ReadValue<uint32_t>()) {
+                throw ChainerxError{"Checksum mismatch of array '", name, "' in checkpoint '", path, "'."};
+            }
+        }
+
+        arrays.emplace_back(std::move(name), FromContiguousHostData(shape, dtype, data, device));
+    }
+    return arrays;
+}
+
+void SaveCheckpoint(const std::string& path, const std::vector<std::pair<std::string, Array>>& arrays, const CheckpointOptions& options) {
+    CheckpointWriter writer{options};
+    writer.Save(path, arrays);
+    writer.Wait();
+}
+
+}  // namespace chainerx
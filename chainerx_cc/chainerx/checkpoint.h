@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+
+namespace chainerx {
+
+struct CheckpointOptions {
+    // Number of bytes passed to a single write call by the background writer.
+    size_t chunk_size{size_t{4} << 20};
+
+    // If true, the file is flushed to the storage (fsync) before the write is reported as completed.
+    bool sync{true};
+
+    // If true, a CRC-32 checksum is stored after the data of each array and verified on load.
+    bool checksum{true};
+};
+
+// Writes named arrays to a file on a background thread.
+//
+// Save() takes a snapshot of the arrays into host staging buffers on the calling thread and returns immediately. The arrays may be
+// modified (e.g. by optimizer updates) as soon as Save() returns. The snapshot is then streamed to the file in chunks by a background
+// thread. The data is first written to a temporary file next to the destination, which is renamed to the destination path only after
+// the whole checkpoint has been written, so that an interrupted write never leaves a truncated checkpoint behind.
+//
+// At most one write is in flight per writer; Save() waits for the preceding write to finish before taking a new snapshot.
+// This class is not thread-safe; a single writer instance must not be used concurrently from multiple threads.
+class CheckpointWriter {
+public:
+    explicit CheckpointWriter(CheckpointOptions options = {}) : options_{options} {}
+
+    // Waits for the pending write, if any. Errors of the pending write are discarded. Call Wait() beforehand to handle them.
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter(CheckpointWriter&&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(CheckpointWriter&&) = delete;
+
+    // Takes a snapshot of the given arrays and starts writing them to the specified path in the background.
+    //
+    // Arrays may reside on any device. Gradients and graph information are not saved.
+    // If the preceding write has failed, its error is rethrown from this function and no new write is started.
+    void Save(std::string path, const std::vector<std::pair<std::string, Array>>& arrays);
+
+    // Blocks until the pending write, if any, is completed.
+    // ChainerxError is thrown if the write has failed.
+    void Wait();
+
+    // Returns true if a write has been started and not yet been waited for, regardless of whether it has already completed.
+    bool has_pending_write() const { return pending_.valid(); }
+
+    const CheckpointOptions& options() const { return options_; }
+
+private:
+    CheckpointOptions options_;
+    std::future<void> pending_;
+};
+
+// Loads arrays written by CheckpointWriter onto the specified device, in the order they were saved.
+//
+// ChainerxError is thrown if the file is malformed or a checksum does not match.
+std::vector<std::pair<std::string, Array>> LoadCheckpoint(const std::string& path, Device& device);
+
+// Synchronously saves named arrays. Equivalent to CheckpointWriter::Save() followed by CheckpointWriter::Wait().
+void SaveCheckpoint(const std::string& path, const std::vector<std::pair<std::string, Array>>& arrays, const CheckpointOptions& options = {});
+
+}  // namespace chainerx
@@ -0,0 +1,206 @@
+#include "chainerx/checkpoint.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/context_session.h"
+
+namespace chainerx {
+namespace {
+
+std::string GetTestFilePath(const std::string& name) { return CHAINERX_TEST_DIR "/" + name; }
+
+bool FileExists(const std::string& path) { return std::ifstream{path}.good(); }
+
+class CheckpointTest : public ::testing::Test {
+protected:
+    void SetUp() override { context_session_.emplace(); }
+
+    void TearDown() override { context_session_.reset(); }
+
+private:
+    nonstd::optional<testing::ContextSession> context_session_;
+};
+
+TEST_F(CheckpointTest, SaveAndLoad) {
+    std::string path = GetTestFilePath("checkpoint_test_save_and_load.ckpt");
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array b = testing::BuildArray({4}).WithData<int32_t>({1, -2, 3, -4}).WithPadding(1);
+    Array c = testing::BuildArray({3, 2}).WithLinearData<double>().Build().Transpose();
+    Array d = testing::BuildArray({0, 2}).WithData<float>({});
+    Array e = testing::BuildArray({}).WithData<bool>({true});
+
+    CheckpointWriter writer{};
+    writer.Save(path, {{"a", a}, {"b", b}, {"c", c}, {"d", d}, {"e", e}});
+    EXPECT_TRUE(writer.has_pending_write());
+    writer.Wait();
+    EXPECT_FALSE(writer.has_pending_write());
+    EXPECT_FALSE(FileExists(path + ".tmp"));
+
+    std::vector<std::pair<std::string, Array>> loaded = LoadCheckpoint(path, GetDefaultDevice());
+    ASSERT_EQ(size_t{5}, loaded.size());
+    EXPECT_EQ("a", loaded[0].first);
+    EXPECT_EQ("b", loaded[1].first);
+    EXPECT_EQ("c", loaded[2].first);
+    EXPECT_EQ("d", loaded[3].first);
+    EXPECT_EQ("e", loaded[4].first);
+    EXPECT_ARRAY_EQ(a, loaded[0].second);
+    EXPECT_ARRAY_EQ(b, loaded[1].second);
+    EXPECT_ARRAY_EQ(c, loaded[2].second);
+    EXPECT_ARRAY_EQ(d, loaded[3].second);
+    EXPECT_ARRAY_EQ(e, loaded[4].second);
+    EXPECT_TRUE(loaded[2].second.IsContiguous());
+
+    std::remove(path.c_str());
+}
+
+TEST_F(CheckpointTest, SnapshotIsTakenOnSave) {
+    std::string path = GetTestFilePath("checkpoint_test_snapshot.ckpt");
+    Array a = testing::BuildArray({3}).WithData<float>({1.f, 2.f, 3.f});
+    Array e = testing::BuildArray({3}).WithData<float>({1.f, 2.f, 3.f});
+
+    CheckpointWriter writer{};
+    writer.Save(path, {{"a", a}});
+    // Modifications after Save() must not affect the checkpoint.
+    a.Fill(42);
+    writer.Wait();
+
+    std::vector<std::pair<std::string, Array>> loaded = LoadCheckpoint(path, GetDefaultDevice());
+    ASSERT_EQ(size_t{1}, loaded.size());
+    EXPECT_ARRAY_EQ(e, loaded[0].second);
+
+    std::remove(path.c_str());
+}
+
+TEST_F(CheckpointTest, SmallChunksWithoutChecksum) {
+    std::string path = GetTestFilePath("checkpoint_test_small_chunks.ckpt");
+    Array a = testing::BuildArray({5, 7}).WithLinearData<float>();
+
+    CheckpointOptions options{};
+    options.chunk_size = 3;
+    options.sync = false;
+    options.checksum = false;
+    SaveCheckpoint(path, {{"a", a}}, options);
+
+    std::vector<std::pair<std::string, Array>> loaded = LoadCheckpoint(path, GetDefaultDevice());
+    ASSERT_EQ(size_t{1}, loaded.size());
+    EXPECT_ARRAY_EQ(a, loaded[0].second);
+
+    std::remove(path.c_str());
+}
+
+TEST_F(CheckpointTest, ChecksumMismatch) {
+    std::string path = GetTestFilePath("checkpoint_test_checksum_mismatch.ckpt");
+    Array a = testing::BuildArray({4}).WithLinearData<int64_t>();
+    SaveCheckpoint(path, {{"a", a}});
+
+    // Corrupt the last byte of the data, which immediately precedes the 4-byte checksum.
+    {
+        std::fstream file{path, std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(-5, std::ios::end);
+        file.put('\x7f');
+    }
+
+    EXPECT_THROW(LoadCheckpoint(path, GetDefaultDevice()), ChainerxError);
+
+    std::remove(path.c_str());
+}
+
+TEST_F(CheckpointTest, WriteError) {
+    std::string path = GetTestFilePath("nonexistent_directory/checkpoint.ckpt");
+    Array a = testing::BuildArray({2}).WithLinearData<float>();
+
+    CheckpointWriter writer{};
+    writer.Save(path, {{"a", a}});
+    EXPECT_THROW(writer.Wait(), ChainerxError);
+    EXPECT_FALSE(writer.has_pending_write());
+}
+
+TEST_F(CheckpointTest, LoadInvalidFile) {
+    std::string path = GetTestFilePath("checkpoint_test_invalid.ckpt");
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "not a checkpoint";
+    }
+
+    EXPECT_THROW(LoadCheckpoint(path, GetDefaultDevice()), ChainerxError);
+    EXPECT_THROW(LoadCheckpoint(GetTestFilePath("checkpoint_test_nonexistent.ckpt"), GetDefaultDevice()), ChainerxError);
+
+    std::remove(path.c_str());
+}
+
+// Writes the header of a checkpoint without checksums, followed by the given array records.
+void WriteCheckpointFile(const std::string& path, uint64_t count, const std::vector<std::string>& records) {
+    std::ofstream file{path, std::ios::binary};
+    uint32_t version = 1;
+    uint32_t flags = 0;
+    file.write("CHXCKPT", 8);
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(reinterpret_cast<const char*>(&flags), sizeof(flags));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    for (const std::string& record : records) {
+        file.write(record.data(), record.size());
+    }
+}
+
+// Builds an array record of a float32 array named "a" with the given dims, followed by the given data size.
+std::string MakeArrayRecord(const std::vector<int64_t>& dims, uint64_t nbytes) {
+    std::string record{};
+    auto append = [&record](const auto& value) {
+        record.append(reinterpret_cast<const char*>(&value), sizeof(value));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    };
+    append(uint32_t{1});
+    record += "a";
+    append(uint32_t{7});
+    record += "float32";
+    append(static_cast<uint32_t>(dims.size()));
+    for (int64_t dim : dims) {
+        append(dim);
+    }
+    append(nbytes);
+    return record;
+}
+
+TEST_F(CheckpointTest, LoadMalformedFile) {
+    std::string path = GetTestFilePath("checkpoint_test_malformed.ckpt");
+    auto expect_load_error = [&path](uint64_t count, const std::vector<std::string>& records) {
+        WriteCheckpointFile(path, count, records);
+        EXPECT_THROW(LoadCheckpoint(path, GetDefaultDevice()), ChainerxError);
+    };
+
+    // The well-formed file is loaded.
+    WriteCheckpointFile(path, 1, {MakeArrayRecord({2}, 8) + std::string(8, '\0')});
+    EXPECT_EQ(size_t{1}, LoadCheckpoint(path, GetDefaultDevice()).size());
+
+    // Number of arrays that the file cannot hold
+    expect_load_error(uint64_t{1} << 60U, {});
+    // Name longer than the file
+    expect_load_error(1, {std::string{"\xff\xff\xff\xff"}});
+    // Negative dimension
+    expect_load_error(1, {MakeArrayRecord({-1, -8}, 32) + std::string(32, '\0')});
+    // Data size overflowing uint64
+    expect_load_error(1, {MakeArrayRecord({int64_t{1} << 40, int64_t{1} << 40}, 0)});
+    // Data size larger than the file
+    expect_load_error(1, {MakeArrayRecord({int64_t{1} << 40}, uint64_t{4} << 40U)});
+
+    std::remove(path.c_str());
+}
+
+}  // namespace
+}  // namespace chainerx
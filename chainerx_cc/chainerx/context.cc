@@ -40,7 +40,8 @@ std::string GetChainerxPath() {
 Context::Context() {
     // Register the default backprop ID
     static constexpr const char* kDefaultBackpropName = "<default>";
-    MakeBackpropId(kDefaultBackpropName);
+    BackpropId default_backprop_id = MakeBackpropId(kDefaultBackpropName);
+    CHAINERX_ASSERT(default_backprop_id.ordinal() == kDefaultBackpropOrdinal);
 }
 
 Context::~Context() {
@@ -129,7 +130,7 @@ BackpropId Context::MakeBackpropId(std::string backprop_name) {
 void Context::ReleaseBackpropId(const BackpropId& backprop_id) {
     CheckValidBackpropId(backprop_id);
 
-    if (backprop_id.ordinal() == 0) {
+    if (backprop_id.ordinal() == kDefaultBackpropOrdinal) {
         throw ChainerxError{"The default backprop ID cannot be released."};
     }
 
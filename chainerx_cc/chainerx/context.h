@@ -114,12 +114,8 @@ public:
     // TODO(sonots): Hide from users
     std::vector<BackpropId> GetInnerBackpropIds(const BackpropId& backprop_id);
 
-    BackpropId default_backprop_id() {
-        // The first entry is always the default backprop ID.
-        std::lock_guard<std::mutex> lock{mutex_};
-        CHAINERX_ASSERT(!backprop_set_.empty());
-        return BackpropId{*this, backprop_set_.front().ordinal};
-    }
+    // The default backprop ID is created on construction and is never released, so no lock is needed.
+    BackpropId default_backprop_id() { return BackpropId{*this, kDefaultBackpropOrdinal}; }
 
 private:
     // If a backend associated with backend_name is already registered, returns a pair of the a reference to the backend already registered
@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <future>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,8 @@
 
 #include "chainerx/backend.h"
 #include "chainerx/device.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
 #include "chainerx/native/native_backend.h"
 #include "chainerx/native/native_device.h"
 #include "chainerx/testing/threading.h"
@@ -85,6 +88,20 @@ TEST(ContextTest, GetDeviceThreadSafe) {
     }
 }
 
+TEST(ContextTest, DefaultBackpropId) {
+    Context ctx{};
+    BackpropId default_backprop_id = ctx.default_backprop_id();
+    EXPECT_EQ(&ctx, &default_backprop_id.context());
+    EXPECT_EQ(kDefaultBackpropOrdinal, default_backprop_id.ordinal());
+    EXPECT_EQ("<default>", default_backprop_id.GetName());
+    default_backprop_id.CheckValid();
+    EXPECT_THROW(ctx.ReleaseBackpropId(default_backprop_id), ChainerxError);
+
+    // Backprop IDs of other contexts are not equal even if their ordinals are the same.
+    Context ctx2{};
+    EXPECT_NE(default_backprop_id, ctx2.default_backprop_id());
+}
+
 TEST(ContextTest, BackpropIdThreadSafe) {
     Context ctx{};
 
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+
+#include "chainerx/bfloat16.h"
+#include "chainerx/cuda/float16.cuh"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace cuda {
+
+// BFloat16 for CUDA devices.
+// Used from the device, it supports full arithmetics just like other C++ numerical types, computed in single precision.
+// Used from the host, it's only a 16-bit data storage.
+//
+// The conversions are implemented with bit operations rather than cuda_bf16, which is not available in all supported CUDA versions.
+class BFloat16 {
+private:
+    struct FromDataTag {};
+
+public:
+    __device__ BFloat16() : data_{0} {}
+    explicit __device__ BFloat16(float v) : data_{FloatToData(v)} {}
+    explicit __device__ BFloat16(cuda::Float16 v) : BFloat16{static_cast<float>(v)} {}
+    template <typename T>
+    explicit __device__ BFloat16(T v) : BFloat16{static_cast<float>(v)} {}
+    // It is assumed that chainerx::BFloat16 and cuda::BFloat16 have commmon representaiton.
+    explicit __host__ BFloat16(Scalar v) : BFloat16{static_cast<chainerx::BFloat16>(v)} {}
+    explicit __host__ BFloat16(chainerx::BFloat16 v) : BFloat16{v.data(), FromDataTag{}} {}
+
+    explicit __device__ operator bool() const { return static_cast<float>(*this) != 0.0f; }
+    explicit __device__ operator int8_t() const { return static_cast<int8_t>(static_cast<float>(*this)); }
+    explicit __device__ operator uint8_t() const { return static_cast<uint8_t>(static_cast<float>(*this)); }
+    explicit __device__ operator int16_t() const { return static_cast<int16_t>(static_cast<float>(*this)); }
+    explicit __device__ operator uint16_t() const { return static_cast<uint16_t>(static_cast<float>(*this)); }
+    explicit __device__ operator int32_t() const { return static_cast<int32_t>(static_cast<float>(*this)); }
+    explicit __device__ operator uint32_t() const { return static_cast<uint32_t>(static_cast<float>(*this)); }
+    explicit __device__ operator int64_t() const { return static_cast<int64_t>(static_cast<float>(*this)); }
+    explicit __device__ operator uint64_t() const { return static_cast<uint64_t>(static_cast<float>(*this)); }
+    explicit __device__ operator float() const { return __uint_as_float(static_cast<uint32_t>(data_) << 16); }
+    explicit __device__ operator double() const { return static_cast<float>(*this); }
+    explicit __device__ operator cuda::Float16() const { return cuda::Float16{static_cast<float>(*this)}; }
+
+    __device__ BFloat16 operator-() const { return FromData(data_ ^ 0x8000U); }
+    __device__ bool operator!() const { return !static_cast<float>(*this); }
+    __device__ BFloat16 operator+(BFloat16 r) const { return BFloat16{static_cast<float>(*this) + static_cast<float>(r)}; }
+    __device__ BFloat16 operator-(BFloat16 r) const { return BFloat16{static_cast<float>(*this) - static_cast<float>(r)}; }
+    __device__ BFloat16 operator*(BFloat16 r) const { return BFloat16{static_cast<float>(*this) * static_cast<float>(r)}; }
+    __device__ BFloat16 operator/(BFloat16 r) const { return BFloat16{static_cast<float>(*this) / static_cast<float>(r)}; }
+    __device__ BFloat16 operator+=(BFloat16 r) { return *this = BFloat16{*this + r}; }
+    __device__ BFloat16 operator-=(BFloat16 r) { return *this = BFloat16{*this - r}; }
+    __device__ BFloat16 operator*=(BFloat16 r) { return *this = BFloat16{*this * r}; }
+    __device__ BFloat16 operator/=(BFloat16 r) { return *this = BFloat16{*this / r}; }
+    __device__ bool operator==(BFloat16 r) const { return static_cast<float>(*this) == static_cast<float>(r); }
+    __device__ bool operator!=(BFloat16 r) const { return !(*this == r); }
+    __device__ bool operator<(BFloat16 r) const { return static_cast<float>(*this) < static_cast<float>(r); }
+    __device__ bool operator>(BFloat16 r) const { return static_cast<float>(*this) > static_cast<float>(r); }
+    __device__ bool operator<=(BFloat16 r) const { return static_cast<float>(*this) <= static_cast<float>(r); }
+    __device__ bool operator>=(BFloat16 r) const { return static_cast<float>(*this) >= static_cast<float>(r); }
+
+    __host__ __device__ static constexpr BFloat16 FromData(uint16_t data) { return cuda::BFloat16{data, FromDataTag{}}; }
+
+    __host__ __device__ static constexpr BFloat16 Inf() { return FromData(0x7f80U); }
+    __host__ __device__ static constexpr BFloat16 NegInf() { return FromData(0xff80U); }
+
+    __device__ bool IsNan() const { return (data_ & 0x7f80U) == 0x7f80U && (data_ & 0x007fU) != 0; }
+    __device__ bool IsInf() const { return (data_ & 0x7f80U) == 0x7f80U && (data_ & 0x007fU) == 0; }
+    __device__ BFloat16 Exp() const { return BFloat16{std::exp(static_cast<float>(*this))}; }
+    __device__ BFloat16 Log() const { return BFloat16{std::log(static_cast<float>(*this))}; }
+    __device__ BFloat16 Log10() const { return BFloat16{std::log10(static_cast<float>(*this))}; }
+    __device__ BFloat16 Log2() const { return BFloat16{std::log2f(static_cast<float>(*this))}; }
+    __device__ BFloat16 Log1p() const { return BFloat16{std::log1pf(static_cast<float>(*this))}; }
+    __device__ BFloat16 Sqrt() const { return BFloat16{std::sqrt(static_cast<float>(*this))}; }
+    __device__ BFloat16 Floor() const { return BFloat16{std::floor(static_cast<float>(*this))}; }
+
+private:
+    explicit __host__ __device__ constexpr BFloat16(uint16_t data, FromDataTag) : data_{data} {}
+
+    // Rounds to the upper 16 bits of the single-precision representation, half to even, keeping NaNs quiet NaNs.
+    __device__ static uint16_t FloatToData(float v) {
+        uint32_t bits = __float_as_uint(v);
+        if ((bits & 0x7fffffffU) > 0x7f800000U) {
+            return static_cast<uint16_t>((bits >> 16) | 0x0040U);
+        }
+        return static_cast<uint16_t>((bits + 0x7fffU + ((bits >> 16) & 1U)) >> 16);
+    }
+
+    uint16_t data_;
+};
+
+// Defined here since it requires the complete BFloat16.
+__device__ inline Float16::Float16(BFloat16 v) : Float16{static_cast<float>(v)} {}
+
+template <typename T>
+__device__ inline bool operator==(const T& l, BFloat16 r) {
+    return l == static_cast<float>(r);
+}
+
+template <typename T>
+__device__ inline bool operator==(BFloat16 l, const T& r) {
+    return static_cast<float>(l) == r;
+}
+
+template <typename T>
+__device__ inline bool operator!=(const T& l, BFloat16 r) {
+    return !(l == r);
+}
+
+template <typename T>
+__device__ inline bool operator!=(BFloat16 l, const T& r) {
+    return !(l == r);
+}
+
+}  // namespace cuda
+}  // namespace chainerx
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "chainerx/cuda/bfloat16.cuh"
 #include "chainerx/cuda/float16.cuh"
 
 namespace chainerx {
@@ -10,7 +11,8 @@ namespace cuda {
 namespace cast_detail {
 
 template <typename T>
-constexpr bool IsFloatingPointV = std::is_floating_point<T>::value || std::is_same<std::remove_const_t<T>, cuda::Float16>::value;
+constexpr bool IsFloatingPointV = std::is_floating_point<T>::value || std::is_same<std::remove_const_t<T>, cuda::Float16>::value ||
+                                  std::is_same<std::remove_const_t<T>, cuda::BFloat16>::value;
 }
 
 // If float value is directly casted to unsigned, it's representation would be different from that of native.
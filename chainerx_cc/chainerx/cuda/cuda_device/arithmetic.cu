@@ -6,6 +6,7 @@
 
 #include "chainerx/arithmetic_ops.h"
 #include "chainerx/array.h"
+#include "chainerx/cuda/bfloat16.cuh"
 #include "chainerx/cuda/cuda_runtime.h"
 #include "chainerx/cuda/cuda_set_device_scope.h"
 #include "chainerx/cuda/elementwise.cuh"
@@ -130,6 +131,9 @@ __device__ double FloorDivide(double x, double y) {
 __device__ cuda::Float16 FloorDivide(cuda::Float16 x, cuda::Float16 y) {
     return cuda::Float16{FloorDivide(static_cast<float>(x), static_cast<float>(y))};
 }
+__device__ cuda::BFloat16 FloorDivide(cuda::BFloat16 x, cuda::BFloat16 y) {
+    return cuda::BFloat16{FloorDivide(static_cast<float>(x), static_cast<float>(y))};
+}
 
 CHAINERX_CUDA_REGISTER_ELTWISE_DTYPE_BINARY_KERNEL(FloorDivideKernel, { out = cuda::FloorDivide(x1, x2); }, VisitNumericDtype);
 
@@ -1,6 +1,7 @@
 #include "chainerx/cuda/cuda_device.h"
 
 #include <cstdint>
+#include <vector>
 
 #include <cuda_runtime.h>
 
@@ -12,6 +13,7 @@
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/kernels/creation.h"
+#include "chainerx/macro.h"
 
 namespace chainerx {
 namespace cuda {
@@ -24,23 +26,46 @@ struct CopyImpl {
     __device__ void operator()(int64_t /*i*/, InCudaType a, OutCudaType& out) { out = static_cast<OutCudaType>(a); }
 };
 
+void CopyElementwise(const Array& a, const Array& out) {
+    auto do_astype = [&](auto in_pt, auto out_pt) {
+        using InT = typename decltype(in_pt)::type;
+        using OutT = typename decltype(out_pt)::type;
+        Elementwise<const InT, OutT>(CopyImpl<InT, OutT>{}, a, out);
+    };
+    VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_astype, out_pt); });
+}
+
 class CudaCopyKernel : public CopyKernel {
 public:
     void Call(const Array& a, const Array& out) override {
         Device& device = a.device();
         device.CheckDevicesCompatible(a, out);
         CudaSetDeviceScope scope{device.index()};
-        auto do_astype = [&](auto in_pt, auto out_pt) {
-            using InT = typename decltype(in_pt)::type;
-            using OutT = typename decltype(out_pt)::type;
-            Elementwise<const InT, OutT>(CopyImpl<InT, OutT>{}, a, out);
-        };
-        VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_astype, out_pt); });
+        CopyElementwise(a, out);
     }
 };
 
 CHAINERX_CUDA_REGISTER_KERNEL(CopyKernel, CudaCopyKernel);
 
+// Kernel launches are asynchronous, so the copies are simply launched one by one.
+class CudaBatchCopyKernel : public BatchCopyKernel {
+public:
+    void Call(const std::vector<Array>& srcs, const std::vector<Array>& outs) override {
+        CHAINERX_ASSERT(srcs.size() == outs.size());
+        if (srcs.empty()) {
+            return;
+        }
+        Device& device = srcs.front().device();
+        CudaSetDeviceScope scope{device.index()};
+        for (size_t i = 0; i < srcs.size(); ++i) {
+            device.CheckDevicesCompatible(srcs[i], outs[i]);
+            CopyElementwise(srcs[i], outs[i]);
+        }
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(BatchCopyKernel, CudaBatchCopyKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
@@ -95,6 +95,14 @@ public:
             return;
         }
 
+        if (out.dtype() == Dtype::kBFloat16) {
+            // cuBLAS of the supported CUDA versions has no bfloat16 GEMM. Compute in float32, which has the same exponent range.
+            Array out32 = Empty(out.shape(), Dtype::kFloat32, device);
+            Call(a.AsType(Dtype::kFloat32, false), b.AsType(Dtype::kFloat32, false), out32);
+            device.backend().CallKernel<CopyKernel>(out32, out);
+            return;
+        }
+
         bool is_out_contiguous = out.IsContiguous();
         Array out_contiguous = is_out_contiguous ? out : EmptyLike(out, device);
 
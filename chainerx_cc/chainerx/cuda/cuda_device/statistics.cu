@@ -84,6 +84,10 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(AMinKernel, CudaAMinKernel);
 
+// The variance is computed from the mean in multiple passes of other kernels.
+CHAINERX_CUDA_REGISTER_KERNEL(VarKernel, GenericVarKernel);
+CHAINERX_CUDA_REGISTER_KERNEL(MeanVarKernel, GenericMeanVarKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "chainerx/bfloat16.h"
+#include "chainerx/cuda/bfloat16.cuh"
 #include "chainerx/cuda/float16.cuh"
 #include "chainerx/dtype.h"
 #include "chainerx/float16.h"
@@ -23,6 +25,16 @@ struct DataTypeSpec<const chainerx::Float16> {
     using DataType = const cuda::Float16;
 };
 
+template <>
+struct DataTypeSpec<chainerx::BFloat16> {
+    using DataType = cuda::BFloat16;
+};
+
+template <>
+struct DataTypeSpec<const chainerx::BFloat16> {
+    using DataType = const cuda::BFloat16;
+};
+
 }  // namespace data_type_detail
 
 namespace cuda_internal {
@@ -8,6 +8,8 @@
 namespace chainerx {
 namespace cuda {
 
+class BFloat16;
+
 // Float16 for CUDA devices.
 // Used from the device, it supports full arithmetics just like other C++ numerical types.
 // Used from the host, it's only a 16-bit data storage.
@@ -22,6 +24,8 @@ public:
     explicit __device__ Float16(uint8_t v) : Float16{static_cast<uint16_t>(v)} {}
     explicit __device__ Float16(int64_t v) : Float16{static_cast<int16_t>(v)} {}
     explicit __device__ Float16(uint64_t v) : Float16{static_cast<uint16_t>(v)} {}
+    // Defined in bfloat16.cuh.
+    explicit __device__ Float16(BFloat16 v);
     template <typename T>
     explicit __device__ Float16(T v) : Float16{::__half{v}} {}
     // It is assumed that chainerx::Float16 and cuda::Float16 have commmon representaiton.
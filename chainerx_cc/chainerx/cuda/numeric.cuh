@@ -1,6 +1,7 @@
 #pragma once
 #include <type_traits>
 
+#include "chainerx/cuda/bfloat16.cuh"
 #include "chainerx/cuda/float16.cuh"
 #include "chainerx/numeric.h"
 
@@ -12,6 +13,7 @@ __device__ inline bool IsNan(T /*value*/) {
     return false;
 }
 __device__ inline bool IsNan(cuda::Float16 value) { return value.IsNan(); }
+__device__ inline bool IsNan(cuda::BFloat16 value) { return value.IsNan(); }
 __device__ inline bool IsNan(double value) { return isnan(value); }
 __device__ inline bool IsNan(float value) { return isnan(value); }
 
@@ -20,6 +22,7 @@ __device__ inline bool IsInf(T /*value*/) {
     return false;
 }
 __device__ inline bool IsInf(cuda::Float16 value) { return value.IsInf(); }
+__device__ inline bool IsInf(cuda::BFloat16 value) { return value.IsInf(); }
 __device__ inline bool IsInf(double value) { return isinf(value); }
 __device__ inline bool IsInf(float value) { return isinf(value); }
 
@@ -31,6 +34,10 @@ template <>
 __device__ inline cuda::Float16 Arctan2<cuda::Float16>(cuda::Float16 x1, cuda::Float16 x2) {
     return cuda::Float16{std::atan2(static_cast<float>(x1), static_cast<float>(x2))};
 }
+template <>
+__device__ inline cuda::BFloat16 Arctan2<cuda::BFloat16>(cuda::BFloat16 x1, cuda::BFloat16 x2) {
+    return cuda::BFloat16{std::atan2(static_cast<float>(x1), static_cast<float>(x2))};
+}
 
 __device__ inline double Arcsinh(double x) { return std::asinh(x); }
 
@@ -38,24 +45,32 @@ __device__ inline float Arcsinh(float x) { return std::asinhf(x); }
 
 __device__ inline cuda::Float16 Arcsinh(cuda::Float16 x) { return cuda::Float16{std::asinhf(static_cast<float>(x))}; }
 
+__device__ inline cuda::BFloat16 Arcsinh(cuda::BFloat16 x) { return cuda::BFloat16{std::asinhf(static_cast<float>(x))}; }
+
 __device__ inline double Arccosh(double x) { return std::acosh(x); }
 
 __device__ inline float Arccosh(float x) { return std::acoshf(x); }
 
 __device__ inline cuda::Float16 Arccosh(cuda::Float16 x) { return cuda::Float16{std::acoshf(static_cast<float>(x))}; }
 
+__device__ inline cuda::BFloat16 Arccosh(cuda::BFloat16 x) { return cuda::BFloat16{std::acoshf(static_cast<float>(x))}; }
+
 __device__ inline double Log2(double x) { return std::log2(x); }
 
 __device__ inline float Log2(float x) { return std::log2f(x); }
 
 __device__ inline cuda::Float16 Log2(cuda::Float16 x) { return cuda::Float16{std::log2f(static_cast<float>(x))}; }
 
+__device__ inline cuda::BFloat16 Log2(cuda::BFloat16 x) { return cuda::BFloat16{std::log2f(static_cast<float>(x))}; }
+
 __device__ inline double Log1p(double x) { return std::log1p(x); }
 
 __device__ inline float Log1p(float x) { return std::log1pf(x); }
 
 __device__ inline cuda::Float16 Log1p(cuda::Float16 x) { return cuda::Float16{std::log1pf(static_cast<float>(x))}; }
 
+__device__ inline cuda::BFloat16 Log1p(cuda::BFloat16 x) { return cuda::BFloat16{std::log1pf(static_cast<float>(x))}; }
+
 template <typename T>
 __device__ inline T Sign(T x) {
     return IsNan(x) ? x : static_cast<T>(static_cast<int>(T{0} < x) - static_cast<int>(x < T{0}));
@@ -69,6 +84,10 @@ template <>
 __device__ inline cuda::Float16 Sign(cuda::Float16 x) {
     return IsNan(x) ? x : cuda::Float16{static_cast<int>(cuda::Float16{0} < x) - static_cast<int>(x < cuda::Float16{0})};
 }
+template <>
+__device__ inline cuda::BFloat16 Sign(cuda::BFloat16 x) {
+    return IsNan(x) ? x : cuda::BFloat16{static_cast<int>(cuda::BFloat16{0} < x) - static_cast<int>(x < cuda::BFloat16{0})};
+}
 
 __device__ inline double Erf(double x) { return std::erf(x); }
 
@@ -76,24 +95,31 @@ __device__ inline float Erf(float x) { return std::erff(x); }
 
 __device__ inline cuda::Float16 Erf(cuda::Float16 x) { return cuda::Float16{std::erff(static_cast<float>(x))}; }
 
+__device__ inline cuda::BFloat16 Erf(cuda::BFloat16 x) { return cuda::BFloat16{std::erff(static_cast<float>(x))}; }
+
 __device__ inline double Expm1(double x) { return std::expm1(x); }
 
 __device__ inline float Expm1(float x) { return std::expm1f(x); }
 
 __device__ inline cuda::Float16 Expm1(cuda::Float16 x) { return cuda::Float16{std::expm1f(static_cast<float>(x))}; }
 
+__device__ inline cuda::BFloat16 Expm1(cuda::BFloat16 x) { return cuda::BFloat16{std::expm1f(static_cast<float>(x))}; }
+
 __device__ inline double Exp2(double x) { return std::exp2(x); }
 
 __device__ inline float Exp2(float x) { return std::exp2f(x); }
 
 __device__ inline cuda::Float16 Exp2(cuda::Float16 x) { return cuda::Float16{std::exp2f(static_cast<float>(x))}; }
 
-#define CHAINERX_DEFINE_CUDA_FLOAT16_FALLBACK_UNARY(name, func) \
-    template <typename T>                                       \
-    __device__ inline T name(T x) {                             \
-        return func(x);                                         \
-    }                                                           \
-    __device__ inline cuda::Float16 name(cuda::Float16 x) { return cuda::Float16{func(static_cast<float>(x))}; }
+__device__ inline cuda::BFloat16 Exp2(cuda::BFloat16 x) { return cuda::BFloat16{std::exp2f(static_cast<float>(x))}; }
+
+#define CHAINERX_DEFINE_CUDA_FLOAT16_FALLBACK_UNARY(name, func)                                                   \
+    template <typename T>                                                                                         \
+    __device__ inline T name(T x) {                                                                               \
+        return func(x);                                                                                           \
+    }                                                                                                             \
+    __device__ inline cuda::Float16 name(cuda::Float16 x) { return cuda::Float16{func(static_cast<float>(x))}; } \
+    __device__ inline cuda::BFloat16 name(cuda::BFloat16 x) { return cuda::BFloat16{func(static_cast<float>(x))}; }
 
 CHAINERX_DEFINE_CUDA_FLOAT16_FALLBACK_UNARY(Ceil, std::ceil)
 CHAINERX_DEFINE_CUDA_FLOAT16_FALLBACK_UNARY(Floor, std::floor)
@@ -159,6 +185,10 @@ __device__ inline cuda::Float16 Power(cuda::Float16 x1, cuda::Float16 x2) {
     return cuda::Float16{powf(static_cast<float>(x1), static_cast<float>(x2))};
 }
 template <>
+__device__ inline cuda::BFloat16 Power(cuda::BFloat16 x1, cuda::BFloat16 x2) {
+    return cuda::BFloat16{powf(static_cast<float>(x1), static_cast<float>(x2))};
+}
+template <>
 __device__ inline float Power(float x1, float x2) {
     return powf(x1, x2);
 }
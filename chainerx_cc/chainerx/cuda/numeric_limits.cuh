@@ -1,5 +1,6 @@
 #pragma once
 
+#include "chainerx/cuda/bfloat16.cuh"
 #include "chainerx/cuda/float16.cuh"
 #include "chainerx/numeric_limits.h"
 
@@ -19,5 +20,11 @@ struct NumericLimits<cuda::Float16> {
     __host__ __device__ static constexpr cuda::Float16 MaxOrInf() noexcept { return cuda::Float16::Inf(); }
 };
 
+template <>
+struct NumericLimits<cuda::BFloat16> {
+    __host__ __device__ static constexpr cuda::BFloat16 LowestOrInf() noexcept { return cuda::BFloat16::NegInf(); }
+    __host__ __device__ static constexpr cuda::BFloat16 MaxOrInf() noexcept { return cuda::BFloat16::Inf(); }
+};
+
 }  // namespace cuda
 }  // namespace chainerx
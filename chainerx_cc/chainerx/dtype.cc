@@ -19,6 +19,10 @@ Dtype PromoteTypes(Dtype dt1, Dtype dt2) {
     if (kind2 == DtypeKind::kBool) {
         return dt1;
     }
+    // float16 and bfloat16 cannot represent each other -> return float32, which can represent both
+    if ((dt1 == Dtype::kFloat16 && dt2 == Dtype::kBFloat16) || (dt1 == Dtype::kBFloat16 && dt2 == Dtype::kFloat16)) {
+        return Dtype::kFloat32;
+    }
     // Same kinds -> return the wider one
     if (kind1 == kind2) {
         if (GetItemSize(dt1) >= GetItemSize(dt2)) {
@@ -73,6 +77,7 @@ Dtype GetDtype(const std::string& name) {
             {"float16", Dtype::kFloat16},
             {"float32", Dtype::kFloat32},
             {"float64", Dtype::kFloat64},
+            {"bfloat16", Dtype::kBFloat16},
             // character code
             {"?", Dtype::kBool},
             {"b", Dtype::kInt8},
@@ -83,6 +88,7 @@ Dtype GetDtype(const std::string& name) {
             {"e", Dtype::kFloat16},
             {"f", Dtype::kFloat32},
             {"d", Dtype::kFloat64},
+            {"E", Dtype::kBFloat16},
     };
     static_assert(std::is_pod<decltype(kMapping)>::value, "static variable must be POD to comply with the coding guideline");
 
@@ -106,6 +112,7 @@ std::vector<Dtype> GetAllDtypes() {
             Dtype::kFloat16,
             Dtype::kFloat32,
             Dtype::kFloat64,
+            Dtype::kBFloat16,
     };
 }
 
@@ -10,6 +10,7 @@
 
 #include <gsl/gsl>
 
+#include "chainerx/bfloat16.h"
 #include "chainerx/error.h"
 #include "chainerx/float16.h"
 
@@ -26,12 +27,13 @@ enum class Dtype {
     kFloat16,
     kFloat32,
     kFloat64,
+    kBFloat16,
 };
 
 inline bool IsValidDtype(Dtype dtype) {
     using Underlying = std::underlying_type_t<Dtype>;
     auto value = static_cast<Underlying>(dtype);
-    return 1 <= value && value <= static_cast<Underlying>(Dtype::kFloat64);
+    return 1 <= value && value <= static_cast<Underlying>(Dtype::kBFloat16);
 }
 
 std::ostream& operator<<(std::ostream& os, Dtype dtype);
@@ -77,7 +79,8 @@ inline char GetDtypeKindChar(DtypeKind kind) {
 }
 
 template <typename T>
-constexpr bool IsFloatingPointV = std::is_floating_point<T>::value || std::is_same<std::remove_const_t<T>, Float16>::value;
+constexpr bool IsFloatingPointV = std::is_floating_point<T>::value || std::is_same<std::remove_const_t<T>, Float16>::value ||
+                                  std::is_same<std::remove_const_t<T>, BFloat16>::value;
 
 // Tag type used for dynamic dispatching with dtype value.
 //
@@ -108,6 +111,8 @@ CHAINERX_DEFINE_PRIMITIVE_TYPE("uint8", 'B', Dtype::kUInt8, DtypeKind::kUInt, ui
 CHAINERX_DEFINE_PRIMITIVE_TYPE("float16", 'e', Dtype::kFloat16, DtypeKind::kFloat, chainerx::Float16, uint16_t);
 CHAINERX_DEFINE_PRIMITIVE_TYPE("float32", 'f', Dtype::kFloat32, DtypeKind::kFloat, float, float);
 CHAINERX_DEFINE_PRIMITIVE_TYPE("float64", 'd', Dtype::kFloat64, DtypeKind::kFloat, double, double);
+// NumPy has no bfloat16. The char code follows the one registered by ml_dtypes.
+CHAINERX_DEFINE_PRIMITIVE_TYPE("bfloat16", 'E', Dtype::kBFloat16, DtypeKind::kFloat, chainerx::BFloat16, uint16_t);
 
 #undef CHAINERX_DEFINE_PRIMITIVE_TYPE
 
@@ -154,6 +159,8 @@ auto VisitDtype(Dtype dtype, F&& f, Args&&... args) {
             return std::forward<F>(f)(PrimitiveType<float>{}, std::forward<Args>(args)...);
         case Dtype::kFloat64:
             return std::forward<F>(f)(PrimitiveType<double>{}, std::forward<Args>(args)...);
+        case Dtype::kBFloat16:
+            return std::forward<F>(f)(PrimitiveType<chainerx::BFloat16>{}, std::forward<Args>(args)...);
         default:
             throw DtypeError{"invalid dtype: ", static_cast<std::underlying_type_t<Dtype>>(dtype)};
     }
@@ -180,6 +187,8 @@ auto VisitNumericDtype(Dtype dtype, F&& f, Args&&... args) {
             return std::forward<F>(f)(PrimitiveType<float>{}, std::forward<Args>(args)...);
         case Dtype::kFloat64:
             return std::forward<F>(f)(PrimitiveType<double>{}, std::forward<Args>(args)...);
+        case Dtype::kBFloat16:
+            return std::forward<F>(f)(PrimitiveType<chainerx::BFloat16>{}, std::forward<Args>(args)...);
         default:
             throw DtypeError{"invalid dtype"};
     }
@@ -218,6 +227,8 @@ auto VisitFloatingPointDtype(Dtype dtype, F&& f, Args&&... args) {
             return std::forward<F>(f)(PrimitiveType<float>{}, std::forward<Args>(args)...);
         case Dtype::kFloat64:
             return std::forward<F>(f)(PrimitiveType<double>{}, std::forward<Args>(args)...);
+        case Dtype::kBFloat16:
+            return std::forward<F>(f)(PrimitiveType<chainerx::BFloat16>{}, std::forward<Args>(args)...);
         default:
             throw DtypeError{"invalid dtype"};
     }
@@ -30,6 +30,14 @@ TEST_P(AllDtypeTest, GetDtypeAndGetCharCode) {
 
 INSTANTIATE_TEST_CASE_P(TestWithAllDtypes, AllDtypeTest, ::testing::ValuesIn(GetAllDtypes()));
 
+TEST(DtypeTest, PromoteTypes) {
+    EXPECT_EQ(Dtype::kBFloat16, PromoteTypes(Dtype::kBFloat16, Dtype::kBFloat16));
+    EXPECT_EQ(Dtype::kBFloat16, PromoteTypes(Dtype::kBFloat16, Dtype::kInt64));
+    EXPECT_EQ(Dtype::kFloat32, PromoteTypes(Dtype::kBFloat16, Dtype::kFloat32));
+    EXPECT_EQ(Dtype::kFloat32, PromoteTypes(Dtype::kBFloat16, Dtype::kFloat16));
+    EXPECT_EQ(Dtype::kFloat32, PromoteTypes(Dtype::kFloat16, Dtype::kBFloat16));
+}
+
 TEST(DtypeTest, WrongDtypeName) { EXPECT_THROW(GetDtype("wrong"), DtypeError); }
 
 TEST(DtypeTest, CheckEqual) {
@@ -47,9 +55,10 @@ TEST(DtypeTest, IsValidDtype) {
     EXPECT_TRUE(IsValidDtype(Dtype::kFloat16));
     EXPECT_TRUE(IsValidDtype(Dtype::kFloat32));
     EXPECT_TRUE(IsValidDtype(Dtype::kFloat64));
+    EXPECT_TRUE(IsValidDtype(Dtype::kBFloat16));
     EXPECT_FALSE(IsValidDtype(static_cast<Dtype>(0)));
     EXPECT_FALSE(IsValidDtype(static_cast<Dtype>(-1)));
-    EXPECT_FALSE(IsValidDtype(static_cast<Dtype>(static_cast<int>(Dtype::kFloat64) + 1)));
+    EXPECT_FALSE(IsValidDtype(static_cast<Dtype>(static_cast<int>(Dtype::kBFloat16) + 1)));
 }
 
 TEST(DtypeTest, NumericDtypeMapping) {
@@ -70,6 +79,7 @@ TEST(DtypeTest, FloatingPointDtypeMapping) {
             case Dtype::kFloat16:
             case Dtype::kFloat32:
             case Dtype::kFloat64:
+            case Dtype::kBFloat16:
                 EXPECT_EQ(dtype, VisitFloatingPointDtype(dtype, [](auto pt) { return decltype(pt)::kDtype; }));
                 break;
             default:
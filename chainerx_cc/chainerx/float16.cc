@@ -2,6 +2,11 @@
 
 #include <cstdint>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CHAINERX_FLOAT16_ENABLE_F16C 1
+#endif  // (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+
 namespace chainerx {
 namespace {
 
@@ -62,8 +67,11 @@ uint16_t FloatbitsToHalfbits(uint32_t f) {
         f_exp >>= 23;
         uint32_t f_sig = (0x00800000U + (f & 0x007fffffU)) >> (113 - f_exp);
 
-        // Handle rounding by adding 1 to the bit beyond half precision
-        f_sig += 0x00001000U;
+        // Handle rounding by adding 1 to the bit beyond half precision, unless it is a tie and the last bit of the half significand is
+        // already even. The shift above may lose up to 11 bits, which are checked in the original value.
+        if ((f_sig & 0x00003fffU) != 0x00001000U || (f & 0x000007ffU) != 0) {
+            f_sig += 0x00001000U;
+        }
         uint16_t h_sig = static_cast<uint16_t>(f_sig >> 13);
 
         // If the rounding causes a bit to spill into h_exp, it will increment h_exp from zero to one and h_sig will be zero. This is the
@@ -74,8 +82,12 @@ uint16_t FloatbitsToHalfbits(uint32_t f) {
     // Regular case with no overflow or underflow
     uint16_t h_exp = static_cast<uint16_t>((f_exp - 0x38000000U) >> 13);
 
-    // Handle rounding by adding 1 to the bit beyond half precision
-    uint32_t f_sig = (f & 0x007fffffU) + 0x00001000U;
+    // Handle rounding by adding 1 to the bit beyond half precision, unless it is a tie and the last bit of the half significand is already
+    // even (round half to even, as IEEE 754 and the hardware conversion instructions do).
+    uint32_t f_sig = (f & 0x007fffffU);
+    if ((f_sig & 0x00003fffU) != 0x00001000U) {
+        f_sig += 0x00001000U;
+    }
     uint16_t h_sig = static_cast<uint16_t>(f_sig >> 13);
 
     // If the rounding causes a bit to spill into h_exp, it will increment h_exp by one and h_sig will be zero. This is the correct result.
@@ -124,8 +136,11 @@ uint16_t DoublebitsToHalfbits(uint64_t d) {
         d_exp >>= 52;
         uint64_t d_sig = (0x0010000000000000ULL + (d & 0x000fffffffffffffULL)) >> (1009 - d_exp);
 
-        // Handle rounding by adding 1 to the bit beyond half precision
-        d_sig += 0x0000020000000000ULL;
+        // Handle rounding by adding 1 to the bit beyond half precision, unless it is a tie and the last bit of the half significand is
+        // already even. The shift above may lose up to 11 bits, which are checked in the original value.
+        if ((d_sig & 0x000007ffffffffffULL) != 0x0000020000000000ULL || (d & 0x00000000000007ffULL) != 0) {
+            d_sig += 0x0000020000000000ULL;
+        }
         uint16_t h_sig = static_cast<uint16_t>(d_sig >> 42);
 
         // If the rounding causes a bit to spill into h_exp, it will increment h_exp from zero to one and h_sig will be zero. This is the
@@ -136,8 +151,12 @@ uint16_t DoublebitsToHalfbits(uint64_t d) {
     // Regular case with no overflow or underflow
     uint16_t h_exp = static_cast<uint16_t>((d_exp - 0x3f00000000000000ULL) >> 42);
 
-    // Handle rounding by adding 1 to the bit beyond half precision
-    uint64_t d_sig = (d & 0x000fffffffffffffULL) + 0x0000020000000000ULL;
+    // Handle rounding by adding 1 to the bit beyond half precision, unless it is a tie and the last bit of the half significand is already
+    // even.
+    uint64_t d_sig = (d & 0x000fffffffffffffULL);
+    if ((d_sig & 0x000007ffffffffffULL) != 0x0000020000000000ULL) {
+        d_sig += 0x0000020000000000ULL;
+    }
     uint16_t h_sig = static_cast<uint16_t>(d_sig >> 42);
 
     // If the rounding causes a bit to spill into h_exp, it will increment h_exp by one and h_sig will be zero. This is the correct result.
@@ -232,12 +251,72 @@ double HalfToDouble(uint16_t v) {
     return UnionDoubleUint(HalfbitsToDoublebits(v)).f;  // NOLINT(cppcoreguidelines-pro-type-union-access)
 }
 
+#ifdef CHAINERX_FLOAT16_ENABLE_F16C
+
+// The functions below are compiled for processors with F16C regardless of the compiler flags, and are only called if the processor at
+// runtime supports it.
+
+bool IsF16cSupported() {
+    static const bool kSupported = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    return kSupported;
+}
+
+__attribute__((target("avx,f16c"))) void ConvertFloat16ToFloatF16c(const Float16* src, float* dst, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    for (; i < n; ++i) {
+        dst[i] = HalfToFloat(src[i].data());
+    }
+}
+
+__attribute__((target("avx,f16c"))) void ConvertFloatToFloat16F16c(const float* src, Float16* dst, int64_t n) {
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    for (; i < n; ++i) {
+        dst[i] = Float16::FromData(FloatToHalf(src[i]));
+    }
+}
+
+#endif  // CHAINERX_FLOAT16_ENABLE_F16C
+
 }  // namespace
 
+static_assert(sizeof(Float16) == sizeof(uint16_t), "Float16 must be laid out as uint16_t for the bulk conversions.");
+
 Float16::Float16(float v) : data_{FloatToHalf(v)} {}
 Float16::Float16(double v) : data_{DoubleToHalf(v)} {}
 
 Float16::operator float() const { return HalfToFloat(data_); }
 Float16::operator double() const { return HalfToDouble(data_); }
 
+void ConvertFloat16ToFloat(const Float16* src, float* dst, int64_t n) {
+#ifdef CHAINERX_FLOAT16_ENABLE_F16C
+    if (IsF16cSupported()) {
+        ConvertFloat16ToFloatF16c(src, dst, n);
+        return;
+    }
+#endif  // CHAINERX_FLOAT16_ENABLE_F16C
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = HalfToFloat(src[i].data());
+    }
+}
+
+void ConvertFloatToFloat16(const float* src, Float16* dst, int64_t n) {
+#ifdef CHAINERX_FLOAT16_ENABLE_F16C
+    if (IsF16cSupported()) {
+        ConvertFloatToFloat16F16c(src, dst, n);
+        return;
+    }
+#endif  // CHAINERX_FLOAT16_ENABLE_F16C
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = Float16::FromData(FloatToHalf(src[i]));
+    }
+}
+
 }  // namespace chainerx
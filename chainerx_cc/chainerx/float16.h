@@ -65,6 +65,16 @@ private:
     uint16_t data_{};
 };
 
+// Converts `n` contiguous half-precision values to single precision.
+// Conversion instructions of the processor are used if available. The results are identical to the scalar conversions except for NaN
+// payloads.
+void ConvertFloat16ToFloat(const Float16* src, float* dst, int64_t n);
+
+// Converts `n` contiguous single-precision values to half precision, rounding half to even.
+// Conversion instructions of the processor are used if available. The results are identical to the scalar conversions except for NaN
+// payloads.
+void ConvertFloatToFloat16(const float* src, Float16* dst, int64_t n);
+
 template <typename T>
 CHAINERX_HOST_DEVICE inline bool operator==(const T& l, Float16 r) {
     return l == static_cast<float>(r);
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -110,6 +111,24 @@ TEST(NativeFloat16Test, Float16Inf) {
     EXPECT_EQ(-std::numeric_limits<double>::infinity(), static_cast<double>(Float16::FromData(0xfc00)));
 }
 
+TEST(NativeFloat16Test, Float16RoundHalfToEven) {
+    // Ties are rounded to the value with the even significand.
+    EXPECT_EQ(0x3c00, Float16{1.0f + std::ldexp(1.0f, -11)}.data());
+    EXPECT_EQ(0x3c02, Float16{1.0f + 3 * std::ldexp(1.0f, -11)}.data());
+    EXPECT_EQ(0x3c00, Float16{1.0 + std::ldexp(1.0, -11)}.data());
+    EXPECT_EQ(0x3c02, Float16{1.0 + 3 * std::ldexp(1.0, -11)}.data());
+    // Values above ties are rounded up.
+    EXPECT_EQ(0x3c01, Float16{1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)}.data());
+    EXPECT_EQ(0x3c01, Float16{1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40)}.data());
+    // Subnormals.
+    EXPECT_EQ(0x0000, Float16{std::ldexp(1.0f, -25)}.data());
+    EXPECT_EQ(0x0002, Float16{3 * std::ldexp(1.0f, -25)}.data());
+    EXPECT_EQ(0x0001, Float16{std::ldexp(1.0f, -25) + std::ldexp(1.0f, -35)}.data());
+    EXPECT_EQ(0x0000, Float16{std::ldexp(1.0, -25)}.data());
+    EXPECT_EQ(0x0002, Float16{3 * std::ldexp(1.0, -25)}.data());
+    EXPECT_EQ(0x0001, Float16{std::ldexp(1.0, -25) + std::ldexp(1.0, -35)}.data());
+}
+
 TEST(NativeFloat16Test, Float16Nan) {
     for (uint16_t bit = 0x7c01; bit < 0x8000; ++bit) {
         EXPECT_TRUE(std::isnan(static_cast<float>(Float16::FromData(bit | 0x0000))));
@@ -235,6 +254,46 @@ TEST(NativeFloat16Test, Float16DivideI) {
     }
 }
 
+TEST(NativeFloat16Test, ConvertFloat16ToFloat) {
+    // All the values, in a length which is not a multiple of the vector width.
+    std::vector<Float16> src;
+    for (uint32_t bit = 0x0000; bit <= 0xffff; ++bit) {
+        src.emplace_back(Float16::FromData(static_cast<uint16_t>(bit)));
+    }
+    src.emplace_back(Float16::FromData(0x3c00));
+    std::vector<float> dst(src.size());
+    ConvertFloat16ToFloat(src.data(), dst.data(), static_cast<int64_t>(src.size()));
+    for (size_t i = 0; i < src.size(); ++i) {
+        if (src[i].IsNan()) {
+            EXPECT_TRUE(std::isnan(dst[i]));
+        } else {
+            EXPECT_EQ(static_cast<float>(src[i]), dst[i]);
+        }
+    }
+}
+
+TEST(NativeFloat16Test, ConvertFloatToFloat16) {
+    std::vector<float> src;
+    for (float x = 1e-8f; x < 1e5f; x *= 1.001f) {  // NOLINT(clang-analyzer-security.FloatLoopCounter,cert-flp30-c)
+        src.emplace_back(x);
+        src.emplace_back(-x);
+    }
+    // Ties, infinities and NaN.
+    src.emplace_back(1.0f + std::ldexp(1.0f, -11));
+    src.emplace_back(1.0f + 3 * std::ldexp(1.0f, -11));
+    src.emplace_back(3 * std::ldexp(1.0f, -25));
+    src.emplace_back(0.0f);
+    src.emplace_back(-0.0f);
+    src.emplace_back(std::numeric_limits<float>::infinity());
+    src.emplace_back(-std::numeric_limits<float>::infinity());
+    src.emplace_back(std::numeric_limits<float>::quiet_NaN());
+    std::vector<Float16> dst(src.size());
+    ConvertFloatToFloat16(src.data(), dst.data(), static_cast<int64_t>(src.size()));
+    for (size_t i = 0; i < src.size(); ++i) {
+        ExpectEqFloat16(Float16{src[i]}, dst[i]);
+    }
+}
+
 TEST(NativeFloat16Test, FloatComparison) {
     for (Float16 x : GetFloat16Values()) {
         for (Float16 y : GetFloat16Values()) {
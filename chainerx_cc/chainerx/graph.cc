@@ -11,6 +11,6 @@ std::ostream& operator<<(std::ostream& os, const BackpropId& backprop_id) { retu
 
 std::string BackpropId::GetName() const { return context_.get().GetBackpropName(*this); }
 
-void BackpropId::CheckValid() const { context_.get().CheckValidBackpropId(*this); }
+void BackpropId::CheckValidImpl() const { context_.get().CheckValidBackpropId(*this); }
 
 }  // namespace chainerx
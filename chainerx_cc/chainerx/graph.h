@@ -13,6 +13,9 @@ namespace chainerx {
 
 using BackpropOrdinal = uint64_t;
 
+// Ordinal of the default backprop ID, which every context creates first and never releases.
+constexpr BackpropOrdinal kDefaultBackpropOrdinal = 0;
+
 class Context;
 
 class BackpropId {
@@ -45,7 +48,12 @@ public:
     std::string GetName() const;
 
     // Throws ChainerxError if this backprop ID has already been released.
-    void CheckValid() const;
+    void CheckValid() const {
+        // The default backprop ID is always valid, which avoids locking the context in the most common case.
+        if (ordinal_ != kDefaultBackpropOrdinal) {
+            CheckValidImpl();
+        }
+    }
 
 private:
     // A BackpropId is always constructed by a Context.
@@ -53,6 +61,8 @@ private:
 
     BackpropId(Context& context, BackpropOrdinal ordinal) : context_{context}, ordinal_{ordinal} {}
 
+    void CheckValidImpl() const;
+
     template <typename Compare>
     bool CompareImpl(const BackpropId& other) const {
         if (&context_.get() != &other.context_.get()) {
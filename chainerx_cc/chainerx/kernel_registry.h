@@ -35,21 +35,36 @@ public:
     // Looks up a kernel.
     template <typename KeyKernelType>
     Kernel& GetKernel() {
+        if (Kernel* kernel = FindKernel<KeyKernelType>()) {
+            return *kernel;
+        }
+        throw ChainerxError{"Kernel not found: ", KeyKernelType::name()};
+    }
+
+    // Returns whether a kernel is registered in this instance or its ancestors.
+    template <typename KeyKernelType>
+    bool HasKernel() {
+        return FindKernel<KeyKernelType>() != nullptr;
+    }
+
+private:
+    // Looks up a kernel, returning nullptr if not found.
+    template <typename KeyKernelType>
+    Kernel* FindKernel() {
         std::type_index key{typeid(KeyKernelType)};
         {
             std::lock_guard<std::mutex> lock{*mutex_};
             auto it = kernels_.find(key);
             if (it != kernels_.end()) {
-                return *it->second;
+                return it->second.get();
             }
         }
         if (parent_ != nullptr) {
-            return parent_->GetKernel<KeyKernelType>();
+            return parent_->FindKernel<KeyKernelType>();
         }
-        throw ChainerxError{"Kernel not found: ", KeyKernelType::name()};
+        return nullptr;
     }
 
-private:
     std::unique_ptr<std::mutex> mutex_{std::make_unique<std::mutex>()};
 
     KernelRegistry* parent_{};
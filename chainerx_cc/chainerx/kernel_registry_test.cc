@@ -58,6 +58,9 @@ TEST(KernelRegistryTest, KernelRegistryHierarchy) {
 
     EXPECT_THROW({ kernel_registry2.GetKernel<MyKernel1>(); }, ChainerxError);
     EXPECT_THROW({ parent_kernel_registry.GetKernel<MyKernel1>(); }, ChainerxError);
+    EXPECT_TRUE(kernel_registry1.HasKernel<MyKernel1>());
+    EXPECT_FALSE(kernel_registry2.HasKernel<MyKernel1>());
+    EXPECT_TRUE(kernel_registry2.HasKernel<MyParentKernel>());
     // no throw
     Kernel& kernel1p = kernel_registry1.GetKernel<MyParentKernel>();
     Kernel& kernel2p = kernel_registry2.GetKernel<MyParentKernel>();
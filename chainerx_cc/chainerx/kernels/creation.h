@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/kernel.h"
@@ -25,6 +26,17 @@ public:
     virtual void Call(const Array& a, const Array& out) = 0;
 };
 
+class BatchCopyKernel : public Kernel {
+public:
+    static const char* name() { return "BatchCopy"; }
+
+    // Copies the elements from each of srcs to the corresponding array in outs.
+    //
+    // It is equivalent to calling CopyKernel for each pair, but the copies may be planned together and run concurrently.
+    // The output arrays must not overlap with each other nor with the source arrays.
+    virtual void Call(const std::vector<Array>& srcs, const std::vector<Array>& outs) = 0;
+};
+
 class IdentityKernel : public Kernel {
 public:
     static const char* name() { return "Identity"; }
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+
+namespace chainerx {
+
+// Computes the softmax cross entropy of each row, without materializing the log-softmax.
+//
+//     out[i] = class_weight[t[i]] * (logsumexp(x[i, :]) - x[i, t[i]])
+//
+// Rows whose label is ignore_label have zero loss. Other labels out of the range [0, C) are errors.
+//
+// x: floating point, of shape (N, C)
+// t: integral, of shape (N,)
+// class_weight: of the dtype of x and of shape (C,), or treated as ones if not given
+// out: of the dtype of x and of shape (N,)
+class SoftmaxCrossEntropyKernel : public Kernel {
+public:
+    static const char* name() { return "SoftmaxCrossEntropy"; }
+
+    virtual void Call(
+            const Array& x, const Array& t, const nonstd::optional<Array>& class_weight, int64_t ignore_label, const Array& out) = 0;
+};
+
+// Computes the gradient of SoftmaxCrossEntropyKernel with respect to x, recomputing the softmax from x.
+//
+//     gx[i, c] = gout[i] * class_weight[t[i]] * (softmax(x[i, :])[c] - (c == t[i]))
+//
+// Rows whose label is ignore_label have zero gradients.
+//
+// gout: of the dtype of x and of shape (N,)
+// gx: of the dtype and shape of x
+class SoftmaxCrossEntropyGradKernel : public Kernel {
+public:
+    static const char* name() { return "SoftmaxCrossEntropyGrad"; }
+
+    virtual void Call(
+            const Array& x,
+            const Array& t,
+            const nonstd::optional<Array>& class_weight,
+            int64_t ignore_label,
+            const Array& gout,
+            const Array& gx) = 0;
+};
+
+}  // namespace chainerx
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+
+// Kernels updating lists of parameters in-place for optimizers.
+//
+// All the arrays are on the same device. The i-th parameter and the i-th elements of the other lists have the same floating point dtype
+// and shape.
+
+// param -= lr * grad
+class SgdUpdateKernel : public Kernel {
+public:
+    static const char* name() { return "SgdUpdate"; }
+
+    virtual void Call(const std::vector<Array>& params, const std::vector<Array>& grads, Scalar lr) = 0;
+};
+
+// v = momentum * v - lr * grad
+// param += v
+class MomentumSgdUpdateKernel : public Kernel {
+public:
+    static const char* name() { return "MomentumSgdUpdate"; }
+
+    virtual void Call(
+            const std::vector<Array>& params,
+            const std::vector<Array>& grads,
+            const std::vector<Array>& velocities,
+            Scalar lr,
+            Scalar momentum) = 0;
+};
+
+// m += (1 - beta1) * (grad - m)
+// v += (1 - beta2) * (grad * grad - v)
+// param -= alpha_t * m / (sqrt(v) + eps) + weight_decay_rate * param
+//
+// alpha_t is the step size with the bias correction applied.
+class AdamUpdateKernel : public Kernel {
+public:
+    static const char* name() { return "AdamUpdate"; }
+
+    virtual void Call(
+            const std::vector<Array>& params,
+            const std::vector<Array>& grads,
+            const std::vector<Array>& ms,
+            const std::vector<Array>& vs,
+            Scalar alpha_t,
+            Scalar beta1,
+            Scalar beta2,
+            Scalar eps,
+            Scalar weight_decay_rate) = 0;
+};
+
+}  // namespace chainerx
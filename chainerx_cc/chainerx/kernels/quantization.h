@@ -0,0 +1,98 @@
+#pragma once
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/dims.h"
+#include "chainerx/kernel.h"
+
+namespace chainerx {
+
+// Quantizes the elements with the affine mapping out = clip(round(x / scale) + zero_point), where round is half to even and clip saturates
+// to the range of the dtype of `out`.
+//
+// x: any numeric dtype
+// scale: float32, broadcast to the shape of x
+// zero_point: int32, broadcast to the shape of x
+// out: int8 or uint8, of the shape of x
+class QuantizeKernel : public Kernel {
+public:
+    static const char* name() { return "Quantize"; }
+
+    virtual void Call(const Array& x, const Array& scale, const Array& zero_point, const Array& out) = 0;
+};
+
+// Maps quantized elements back with out = (q - zero_point) * scale.
+//
+// q: int8 or uint8
+// scale: float32, broadcast to the shape of q
+// zero_point: int32, broadcast to the shape of q
+// out: float32, of the shape of q
+class DequantizeKernel : public Kernel {
+public:
+    static const char* name() { return "Dequantize"; }
+
+    virtual void Call(const Array& q, const Array& scale, const Array& zero_point, const Array& out) = 0;
+};
+
+// Matrix multiplication of quantized matrices with 32-bit integer accumulation.
+//
+//     acc[i, j] = sum_k (a[i, k] - a_zero_point) * (b[k, j] - b_zero_point[j]) + bias[j]
+//
+// If `out` is int32, acc is stored as it is. If `out` is int8 or uint8, acc is requantized as
+//
+//     out[i, j] = clip(round(acc[i, j] * multiplier[j]) + out_zero_point)
+//
+// a: (M, K), int8 or uint8
+// a_zero_point: (), int32
+// b: (K, N), int8
+// b_zero_point: (N), int32
+// bias: (N), int32
+// multiplier: (N), float32. Required if and only if `out` is not int32.
+// out_zero_point: (), int32. Required if and only if `out` is not int32.
+// out: (M, N), int32, int8 or uint8
+class QuantizedGemmKernel : public Kernel {
+public:
+    static const char* name() { return "QuantizedGemm"; }
+
+    virtual void Call(
+            const Array& a,
+            const Array& a_zero_point,
+            const Array& b,
+            const Array& b_zero_point,
+            const nonstd::optional<Array>& bias,
+            const nonstd::optional<Array>& multiplier,
+            const nonstd::optional<Array>& out_zero_point,
+            const Array& out) = 0;
+};
+
+// Computes the n-dimensional convolution of quantized arrays with 32-bit integer accumulation, requantized in the same way as
+// QuantizedGemmKernel if `out_dtype` is not int32.
+//
+// x: (batch_size, in_channels, in_1, in_2, ..., in_n), int8 or uint8
+// x_zero_point: (), int32
+// w: (out_channels, in_channels, k_1, k_2, ..., k_n), int8
+// w_zero_point: (out_channels), int32
+// bias: (out_channels), int32
+// multiplier: (out_channels), float32
+// out_zero_point: (), int32
+//
+// Returns an array of shape (batch_size, out_channels, out_1, out_2, ..., out_n).
+class QuantizedConvKernel : public Kernel {
+public:
+    static const char* name() { return "QuantizedConv"; }
+
+    virtual Array Call(
+            const Array& x,
+            const Array& x_zero_point,
+            const Array& w,
+            const Array& w_zero_point,
+            const nonstd::optional<Array>& bias,
+            const Dims& stride,
+            const Dims& pad,
+            const nonstd::optional<Array>& multiplier,
+            const nonstd::optional<Array>& out_zero_point,
+            Dtype out_dtype) = 0;
+};
+
+}  // namespace chainerx
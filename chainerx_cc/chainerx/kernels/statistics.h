@@ -26,4 +26,34 @@ public:
     virtual void Call(const Array& src, const Axes& axis, const Array& out) = 0;
 };
 
+// Calculates the variance along specified axes, normalized by the number of items (i.e. without Bessel's correction).
+// The output dtype is a floating point dtype. See Sum() for the explanation of the other arguments.
+class VarKernel : public Kernel {
+public:
+    static const char* name() { return "Var"; }
+
+    virtual void Call(const Array& a, const Axes& axis, const Array& out) = 0;
+};
+
+// Calculates the mean and the variance along specified axes together.
+// mean and var must be of the same shape, strides and floating point dtype.
+class MeanVarKernel : public Kernel {
+public:
+    static const char* name() { return "MeanVar"; }
+
+    virtual void Call(const Array& a, const Axes& axis, const Array& mean, const Array& var) = 0;
+};
+
+// Computes the variance from the mean of the squared deviations, using other kernels.
+// It is the implementation for devices that do not provide their own.
+class GenericVarKernel : public VarKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& out) override;
+};
+
+class GenericMeanVarKernel : public MeanVarKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& mean, const Array& var) override;
+};
+
 }  // namespace chainerx
@@ -50,3 +50,21 @@
 #define CHAINERX_VISIBILITY_HIDDEN __attribute__((visibility("hidden")))
 #endif  // defined(WIN32) || defined(_WIN32)
 #endif  // CHAINERX_VISIBILITY_HIDDEN
+
+// Hints the processor to fetch the cache line containing the address for a subsequent read.
+#ifndef CHAINERX_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define CHAINERX_PREFETCH(addr) __builtin_prefetch(addr)
+#else  // defined(__GNUC__) || defined(__clang__)
+#define CHAINERX_PREFETCH(addr) (void)(addr)
+#endif  // defined(__GNUC__) || defined(__clang__)
+#endif  // CHAINERX_PREFETCH
+
+// Qualifies a pointer so that the compiler assumes no other pointer accesses the same object, allowing it to vectorize loops.
+#ifndef CHAINERX_RESTRICT
+#if defined(_MSC_VER)
+#define CHAINERX_RESTRICT __restrict
+#else  // defined(_MSC_VER)
+#define CHAINERX_RESTRICT __restrict__
+#endif  // defined(_MSC_VER)
+#endif  // CHAINERX_RESTRICT
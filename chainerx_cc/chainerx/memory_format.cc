@@ -0,0 +1,44 @@
+#include "chainerx/memory_format.h"
+
+#include <cstdint>
+
+#include "chainerx/array.h"
+#include "chainerx/macro.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+namespace chainerx {
+
+Strides GetMemoryFormatStrides(const Shape& shape, int64_t item_size, MemoryFormat format) {
+    if (format == MemoryFormat::kChannelsFirst || shape.ndim() < 3) {
+        return Strides{shape, item_size};
+    }
+    CHAINERX_ASSERT(format == MemoryFormat::kChannelsLast);
+    Strides strides{};
+    strides.resize(shape.ndim());
+    int64_t stride = item_size;
+    strides[1] = stride;
+    stride *= shape[1];
+    for (int8_t i = shape.ndim() - 1; i >= 2; --i) {
+        strides[i] = stride;
+        stride *= shape[i];
+    }
+    strides[0] = stride;
+    return strides;
+}
+
+MemoryFormat GetMemoryFormat(const Array& a) {
+    if (a.ndim() < 3 || a.IsContiguous()) {
+        return MemoryFormat::kChannelsFirst;
+    }
+    Strides expected = GetMemoryFormatStrides(a.shape(), a.GetItemSize(), MemoryFormat::kChannelsLast);
+    for (int8_t i = 0; i < a.ndim(); ++i) {
+        // Strides of unit-length dimensions do not affect the layout.
+        if (a.shape()[i] != 1 && a.strides()[i] != expected[i]) {
+            return MemoryFormat::kChannelsFirst;
+        }
+    }
+    return MemoryFormat::kChannelsLast;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+#include "chainerx/array.h"
+#include "chainerx/dtype.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+namespace chainerx {
+
+// Physical layout of the elements of a dense array of shape (batch_size, channels, d_1, d_2, ..., d_n), such as the inputs and outputs of
+// convolutions, poolings and batch normalizations.
+//
+// The shape, and hence the user-visible layout, is the same in both formats. The format is only reflected in the strides, so that an array
+// in any format can be passed to any routine. Kernels that take images may however compute faster in one of the formats and produce their
+// outputs in the same format as their inputs, so that a sequence of such kernels never converts between the formats.
+enum class MemoryFormat {
+    // Row-major (batch_size, channels, d_1, d_2, ..., d_n), i.e. C-contiguous. Also known as NCHW.
+    kChannelsFirst,
+    // Row-major (batch_size, d_1, d_2, ..., d_n, channels). Also known as NHWC.
+    kChannelsLast,
+};
+
+// Returns the strides of a dense array of the shape in the memory format.
+// Arrays of less than 3 dimensions have no spatial dimensions and are always laid out as kChannelsFirst.
+Strides GetMemoryFormatStrides(const Shape& shape, int64_t item_size, MemoryFormat format);
+
+inline Strides GetMemoryFormatStrides(const Shape& shape, Dtype dtype, MemoryFormat format) {
+    return GetMemoryFormatStrides(shape, GetItemSize(dtype), format);
+}
+
+// Returns kChannelsLast if the array is densely laid out as channels-last but not C-contiguous, and kChannelsFirst otherwise.
+MemoryFormat GetMemoryFormat(const Array& a);
+
+}  // namespace chainerx
@@ -0,0 +1,48 @@
+#include "chainerx/memory_format.h"
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/array_index.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/slice.h"
+#include "chainerx/strides.h"
+#include "chainerx/testing/context_session.h"
+
+namespace chainerx {
+namespace {
+
+TEST(MemoryFormatTest, GetMemoryFormatStrides) {
+    EXPECT_EQ(Strides({240, 80, 20, 4}), GetMemoryFormatStrides({2, 3, 4, 5}, Dtype::kFloat32, MemoryFormat::kChannelsFirst));
+    EXPECT_EQ(Strides({240, 4, 60, 12}), GetMemoryFormatStrides({2, 3, 4, 5}, Dtype::kFloat32, MemoryFormat::kChannelsLast));
+    EXPECT_EQ(Strides({12, 2, 6}), GetMemoryFormatStrides({2, 3, 2}, Dtype::kInt16, MemoryFormat::kChannelsLast));
+    // Arrays without spatial dimensions are laid out in the same way in both formats.
+    EXPECT_EQ(Strides({24, 8}), GetMemoryFormatStrides({2, 3}, Dtype::kFloat64, MemoryFormat::kChannelsLast));
+}
+
+TEST(MemoryFormatTest, GetMemoryFormat) {
+    testing::ContextSession context_session;
+
+    Shape shape{2, 3, 4, 5};
+    Array a = Empty(shape, Dtype::kFloat32);
+    EXPECT_EQ(MemoryFormat::kChannelsFirst, GetMemoryFormat(a));
+
+    // (batch_size, d_1, d_2, channels) transposed to (batch_size, channels, d_1, d_2).
+    Array b = Empty({2, 4, 5, 3}, Dtype::kFloat32).Transpose({0, 3, 1, 2});
+    EXPECT_EQ(shape, b.shape());
+    EXPECT_EQ(MemoryFormat::kChannelsLast, GetMemoryFormat(b));
+
+    // Other permutations and non-dense arrays are not channels-last.
+    EXPECT_EQ(MemoryFormat::kChannelsFirst, GetMemoryFormat(Empty({2, 5, 4, 3}, Dtype::kFloat32).Transpose({0, 3, 2, 1})));
+    Array c = Empty({2, 4, 5, 6}, Dtype::kFloat32).Transpose({0, 3, 1, 2});
+    EXPECT_EQ(MemoryFormat::kChannelsFirst, GetMemoryFormat(c.At({Slice{}, Slice{0, 3}})));
+    EXPECT_EQ(MemoryFormat::kChannelsFirst, GetMemoryFormat(Empty({4, 3}, Dtype::kFloat32).Transpose()));
+
+    // Strides of unit-length dimensions are ignored.
+    EXPECT_EQ(MemoryFormat::kChannelsLast, GetMemoryFormat(Empty({1, 4, 5, 3}, Dtype::kFloat32).Transpose({0, 3, 1, 2})));
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -0,0 +1,166 @@
+#include "chainerx/native/bulk_memory.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
+
+#ifdef __linux__
+#include <unistd.h>
+#endif  // __linux__
+
+#include "chainerx/macro.h"
+#include "chainerx/native/parallel.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+// Used if the cache size cannot be queried.
+constexpr size_t kDefaultLastLevelCacheSize = size_t{8} << 20;
+
+// Number of bytes processed in a single task of the parallel loop. It is a multiple of any item size supported by BulkFill, so that every
+// chunk starts with a whole item.
+constexpr size_t kChunkSize = size_t{256} << 10;
+
+size_t QueryLastLevelCacheSize() {
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    for (int name : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE}) {
+        int64_t size = sysconf(name);
+        if (size > 0) {
+            return static_cast<size_t>(size);
+        }
+    }
+#endif  // defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    return kDefaultLastLevelCacheSize;
+}
+
+// Fills bytes of dst in [begin, end) with the item repeated from dst.
+void FillBytes(uint8_t* dst, size_t begin, size_t end, const uint8_t* item, size_t item_size) {
+    for (size_t i = begin; i < end; ++i) {
+        dst[i] = item[i % item_size];
+    }
+}
+
+void FillRegular(void* dst, size_t bytesize, const void* item, size_t item_size) {
+    auto dst_bytes = static_cast<uint8_t*>(dst);
+    auto item_bytes = static_cast<const uint8_t*>(item);
+    if (std::all_of(item_bytes + 1, item_bytes + item_size, [item_bytes](uint8_t b) { return b == item_bytes[0]; })) {
+        std::memset(dst, item_bytes[0], bytesize);
+        return;
+    }
+    // Doubles the filled range by copying it, which keeps the phase of the items since the range is always a multiple of the item size.
+    size_t filled = std::min(item_size, bytesize);
+    std::memcpy(dst_bytes, item_bytes, filled);
+    while (filled < bytesize) {
+        size_t n = std::min(filled, bytesize - filled);
+        std::memcpy(dst_bytes + filled, dst_bytes, n);
+        filled += n;
+    }
+}
+
+// Calls func(begin, end) for the chunks of the range [0, bytesize) in parallel.
+template <typename Func>
+void ForEachChunk(size_t bytesize, Func&& func) {
+    auto chunk_count = static_cast<int64_t>((bytesize + kChunkSize - 1) / kChunkSize);
+    ParallelFor(chunk_count, 1, [bytesize, &func](int64_t first, int64_t last) {
+        func(static_cast<size_t>(first) * kChunkSize, std::min(static_cast<size_t>(last) * kChunkSize, bytesize));
+    });
+}
+
+}  // namespace
+
+size_t GetLastLevelCacheSize() {
+    static const size_t size = QueryLastLevelCacheSize();
+    return size;
+}
+
+void BulkCopy(void* dst, const void* src, size_t bytesize) {
+    if (bytesize <= kChunkSize) {
+        std::memcpy(dst, src, bytesize);
+        return;
+    }
+    auto dst_bytes = static_cast<uint8_t*>(dst);
+    auto src_bytes = static_cast<const uint8_t*>(src);
+    bool non_temporal = bytesize > GetLastLevelCacheSize();
+    ForEachChunk(bytesize, [dst_bytes, src_bytes, non_temporal](size_t begin, size_t end) {
+        if (non_temporal) {
+            native_internal::CopyNonTemporal(dst_bytes + begin, src_bytes + begin, end - begin);
+        } else {
+            std::memcpy(dst_bytes + begin, src_bytes + begin, end - begin);
+        }
+    });
+}
+
+void BulkFill(void* dst, size_t bytesize, const void* item, size_t item_size) {
+    CHAINERX_ASSERT(item_size > 0 && 16 % item_size == 0);
+    CHAINERX_ASSERT(bytesize % item_size == 0);
+    if (bytesize <= kChunkSize) {
+        FillRegular(dst, bytesize, item, item_size);
+        return;
+    }
+    auto dst_bytes = static_cast<uint8_t*>(dst);
+    bool non_temporal = bytesize > GetLastLevelCacheSize();
+    ForEachChunk(bytesize, [dst_bytes, item, item_size, non_temporal](size_t begin, size_t end) {
+        if (non_temporal) {
+            native_internal::FillNonTemporal(dst_bytes + begin, end - begin, item, item_size);
+        } else {
+            FillRegular(dst_bytes + begin, end - begin, item, item_size);
+        }
+    });
+}
+
+namespace native_internal {
+
+void CopyNonTemporal(void* dst, const void* src, size_t bytesize) {
+#ifdef __SSE2__
+    auto dst_bytes = static_cast<uint8_t*>(dst);
+    auto src_bytes = static_cast<const uint8_t*>(src);
+    // Streaming stores require aligned destinations.
+    size_t head = std::min((16 - reinterpret_cast<uintptr_t>(dst_bytes) % 16) % 16, bytesize);
+    std::memcpy(dst_bytes, src_bytes, head);
+    size_t i = head;
+    for (; i + 16 <= bytesize; i += 16) {
+        __m128i v = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src_bytes + i));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst_bytes + i), v);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    std::memcpy(dst_bytes + i, src_bytes + i, bytesize - i);
+    // Makes the streaming stores visible to the other threads.
+    _mm_sfence();
+#else  // __SSE2__
+    std::memcpy(dst, src, bytesize);
+#endif  // __SSE2__
+}
+
+void FillNonTemporal(void* dst, size_t bytesize, const void* item, size_t item_size) {
+#ifdef __SSE2__
+    auto dst_bytes = static_cast<uint8_t*>(dst);
+    auto item_bytes = static_cast<const uint8_t*>(item);
+    size_t head = std::min((16 - reinterpret_cast<uintptr_t>(dst_bytes) % 16) % 16, bytesize);
+    FillBytes(dst_bytes, 0, head, item_bytes, item_size);
+
+    // The items repeated from the first aligned address. 16 bytes always consist of whole items.
+    alignas(16) uint8_t pattern[16];
+    for (size_t j = 0; j < 16; ++j) {
+        pattern[j] = item_bytes[(head + j) % item_size];
+    }
+    __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    size_t i = head;
+    for (; i + 16 <= bytesize; i += 16) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst_bytes + i), v);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    FillBytes(dst_bytes, i, bytesize, item_bytes, item_size);
+    _mm_sfence();
+#else  // __SSE2__
+    FillRegular(dst, bytesize, item, item_size);
+#endif  // __SSE2__
+}
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+namespace chainerx {
+namespace native {
+
+// Returns the size in bytes of the last level cache of the host.
+// Buffers larger than this are written with non-temporal stores by BulkCopy and BulkFill.
+size_t GetLastLevelCacheSize();
+
+// Copies bytesize bytes from src to dst, which must not overlap.
+// Large copies are split into chunks processed in parallel. Copies larger than the last level cache bypass the cache.
+void BulkCopy(void* dst, const void* src, size_t bytesize);
+
+// Fills the bytesize bytes at dst with repetitions of the item_size bytes at item. item_size must be a divisor of 16 and bytesize must be
+// a multiple of item_size.
+// Large fills are split into chunks processed in parallel. Fills larger than the last level cache bypass the cache.
+void BulkFill(void* dst, size_t bytesize, const void* item, size_t item_size);
+
+namespace native_internal {
+
+// Sequential copy and fill with non-temporal stores, falling back to the regular ones if not supported.
+void CopyNonTemporal(void* dst, const void* src, size_t bytesize);
+void FillNonTemporal(void* dst, size_t bytesize, const void* item, size_t item_size);
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,109 @@
+#include "chainerx/native/bulk_memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace native {
+namespace {
+
+std::vector<uint8_t> MakeSequence(size_t size) {
+    std::vector<uint8_t> v(size);
+    for (size_t i = 0; i < size; ++i) {
+        v[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return v;
+}
+
+// Checks that the copy writes exactly the range, for unaligned addresses and sizes.
+template <typename CopyFunc>
+void CheckCopy(CopyFunc copy, size_t bytesize) {
+    for (size_t offset : {0, 1, 8, 15}) {
+        std::vector<uint8_t> src = MakeSequence(bytesize + offset);
+        std::vector<uint8_t> dst(bytesize + offset + 32, 0xff);
+        copy(dst.data() + offset, src.data() + offset, bytesize);
+        for (size_t i = 0; i < offset; ++i) {
+            ASSERT_EQ(0xff, dst[i]);
+        }
+        for (size_t i = offset; i < offset + bytesize; ++i) {
+            ASSERT_EQ(src[i], dst[i]) << "offset: " << offset << " index: " << i;
+        }
+        for (size_t i = offset + bytesize; i < dst.size(); ++i) {
+            ASSERT_EQ(0xff, dst[i]);
+        }
+    }
+}
+
+template <typename FillFunc>
+void CheckFill(FillFunc fill, size_t bytesize) {
+    const uint8_t item[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    for (size_t item_size : {1, 2, 4, 8}) {
+        size_t n = bytesize / item_size * item_size;
+        for (size_t offset : {0, 2, 8}) {
+            std::vector<uint8_t> dst(n + offset + 32, 0xff);
+            fill(dst.data() + offset, n, item, item_size);
+            for (size_t i = 0; i < offset; ++i) {
+                ASSERT_EQ(0xff, dst[i]);
+            }
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(item[i % item_size], dst[offset + i]) << "item_size: " << item_size << " offset: " << offset << " index: " << i;
+            }
+            for (size_t i = offset + n; i < dst.size(); ++i) {
+                ASSERT_EQ(0xff, dst[i]);
+            }
+        }
+    }
+}
+
+TEST(BulkMemoryTest, BulkCopy) {
+    for (size_t bytesize : {0, 1, 100, 1 << 20, (1 << 20) + 13}) {
+        CheckCopy(&BulkCopy, bytesize);
+    }
+}
+
+TEST(BulkMemoryTest, BulkCopyLargerThanCache) {
+    size_t bytesize = GetLastLevelCacheSize() + 1000;
+    if (bytesize > (size_t{256} << 20)) {
+        return;
+    }
+    std::vector<uint8_t> src = MakeSequence(bytesize);
+    std::vector<uint8_t> dst(bytesize);
+    BulkCopy(dst.data(), src.data(), bytesize);
+    EXPECT_EQ(src, dst);
+}
+
+TEST(BulkMemoryTest, CopyNonTemporal) {
+    for (size_t bytesize : {0, 1, 15, 16, 17, 100, 4096 + 5}) {
+        CheckCopy(&native_internal::CopyNonTemporal, bytesize);
+    }
+}
+
+TEST(BulkMemoryTest, BulkFill) {
+    for (size_t bytesize : {0, 8, 100, 1 << 20, (1 << 20) + 24}) {
+        CheckFill(&BulkFill, bytesize);
+    }
+}
+
+TEST(BulkMemoryTest, BulkFillLargerThanCache) {
+    size_t bytesize = (GetLastLevelCacheSize() + 1000) / 4 * 4;
+    if (bytesize > (size_t{256} << 20)) {
+        return;
+    }
+    const float item = 1.5f;
+    std::vector<float> dst(bytesize / sizeof(float));
+    BulkFill(dst.data(), bytesize, &item, sizeof(float));
+    EXPECT_EQ(std::vector<float>(dst.size(), item), dst);
+}
+
+TEST(BulkMemoryTest, FillNonTemporal) {
+    for (size_t bytesize : {0, 8, 16, 24, 104, 4096 + 8}) {
+        CheckFill(&native_internal::FillNonTemporal, bytesize);
+    }
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -3,7 +3,9 @@
 #include <cstdint>
 #include <type_traits>
 
+#include "chainerx/bfloat16.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
 
 namespace chainerx {
 namespace native {
@@ -29,6 +31,10 @@ StorageType<T> DataToStorageType(T&& x) {
     return *reinterpret_cast<StorageType<T>*>(&x);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
 }
 
+// Type in which arithmetic on values of T is computed in kernels, where the 16-bit floating point types are promoted to float.
+template <typename T>
+using ComputeType = std::conditional_t<std::is_same<T, Float16>{} || std::is_same<T, BFloat16>{}, float, T>;
+
 }  // namespace native_internal
 
 // This function is used from outside of native namespace.
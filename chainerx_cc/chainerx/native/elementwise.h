@@ -1,10 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <initializer_list>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "chainerx/constant.h"
+#include "chainerx/float16.h"
 #include "chainerx/index_iterator.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
@@ -14,25 +19,102 @@
 
 namespace chainerx {
 namespace native {
+// Type in which the kernels run by ElementwiseInComputeType compute values of T.
+template <typename T>
+using ElementwiseComputeType = std::conditional_t<std::is_same<std::remove_const_t<T>, Float16>::value, float, T>;
+
 namespace elementwise_detail {
 
+// Number of float16 elements converted to float32 at once.
+constexpr int64_t kFloat16BlockSize = 256;
+
+// Float32 values of a block of elements of a float16 array.
+// Elements of inputs are gathered and converted before the computation, and those of outputs are converted and scattered after it.
+template <typename T, int8_t Ndim>
+class Float16Block {
+public:
+    explicit Float16Block(const IndexableArray<T, Ndim>& array) : array_{array} {}
+
+    void Gather(const IndexIterator<Ndim>& it, int64_t j) { Gather(it, j, std::is_const<T>{}); }
+
+    void Load(int64_t n) { Load(n, std::is_const<T>{}); }
+
+    void Store(int64_t n) { Store(n, std::is_const<T>{}); }
+
+    void Scatter(const IndexIterator<Ndim>& it, int64_t j) { Scatter(it, j, std::is_const<T>{}); }
+
+    float& operator[](int64_t j) { return values_[j]; }  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+private:
+    void Gather(const IndexIterator<Ndim>& it, int64_t j, std::true_type /*is_input*/) {
+        halves_[j] = native_internal::StorageToDataType<T>(array_[it]);  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+    void Gather(const IndexIterator<Ndim>& /*it*/, int64_t /*j*/, std::false_type /*is_input*/) {}
+
+    void Load(int64_t n, std::true_type /*is_input*/) { ConvertFloat16ToFloat(halves_.data(), values_.data(), n); }
+    void Load(int64_t /*n*/, std::false_type /*is_input*/) {}
+
+    void Store(int64_t /*n*/, std::true_type /*is_input*/) {}
+    void Store(int64_t n, std::false_type /*is_input*/) { ConvertFloatToFloat16(values_.data(), halves_.data(), n); }
+
+    void Scatter(const IndexIterator<Ndim>& /*it*/, int64_t /*j*/, std::true_type /*is_input*/) {}
+    void Scatter(const IndexIterator<Ndim>& it, int64_t j, std::false_type /*is_input*/) {
+        native_internal::StorageToDataType<T>(array_[it]) = halves_[j];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    IndexableArray<T, Ndim> array_;
+    std::array<Float16, kFloat16BlockSize> halves_{};
+    std::array<float, kFloat16BlockSize> values_{};
+};
+
+template <typename... Ts>
+using AllFloat16 = std::is_same<std::tuple<std::remove_const_t<Ts>...>, std::tuple<std::conditional_t<true, Float16, Ts>...>>;
+
 template <int8_t Ndim, typename Op, typename... Ts>
-void ElementwiseKernel(Op op, const Indexer<Ndim>& indexer, const IndexableArray<Ts, Ndim>&... args) {
+void ElementwiseKernel(std::false_type /*in_float16_blocks*/, Op op, const Indexer<Ndim>& indexer, const IndexableArray<Ts, Ndim>&... args) {
     for (auto it = indexer.It(0, 1); it; ++it) {
         op(it.raw_index(), native_internal::StorageToDataType<Ts>(args[it])...);
     }
 }
 
-template <int8_t Ndim, typename Op, typename... Ts, typename... Arrays>
+template <int8_t Ndim, typename Op, typename... Ts, size_t... Is>
+void Float16BlockKernel(Op op, const Indexer<Ndim>& indexer, std::index_sequence<Is...> /*indices*/, const IndexableArray<Ts, Ndim>&... args) {
+    std::tuple<Float16Block<Ts, Ndim>...> blocks{Float16Block<Ts, Ndim>{args}...};
+    int64_t total_size = indexer.total_size();
+    for (int64_t start = 0; start < total_size; start += kFloat16BlockSize) {
+        int64_t n = std::min(kFloat16BlockSize, total_size - start);
+        auto it = indexer.It(start, 1);
+        for (int64_t j = 0; j < n; ++j, ++it) {
+            (void)std::initializer_list<int>{(std::get<Is>(blocks).Gather(it, j), 0)...};
+        }
+        (void)std::initializer_list<int>{(std::get<Is>(blocks).Load(n), 0)...};
+        for (int64_t j = 0; j < n; ++j) {
+            op(start + j, std::get<Is>(blocks)[j]...);
+        }
+        (void)std::initializer_list<int>{(std::get<Is>(blocks).Store(n), 0)...};
+        it.Restart(start);
+        for (int64_t j = 0; j < n; ++j, ++it) {
+            (void)std::initializer_list<int>{(std::get<Is>(blocks).Scatter(it, j), 0)...};
+        }
+    }
+}
+
+template <int8_t Ndim, typename Op, typename... Ts>
+void ElementwiseKernel(std::true_type /*in_float16_blocks*/, Op op, const Indexer<Ndim>& indexer, const IndexableArray<Ts, Ndim>&... args) {
+    Float16BlockKernel<Ndim, Op, Ts...>(op, indexer, std::index_sequence_for<Ts...>{}, args...);
+}
+
+template <int8_t Ndim, bool InComputeType, typename Op, typename... Ts, typename... Arrays>
 void LaunchElementwiseKernel(Op&& op, const Shape& shape, const Axes& keep, const Arrays&... args) {
     ElementwiseKernel<Ndim, Op, Ts...>(
-            op, Indexer<Ndim>{shape}, IndexableArray<Ts, Ndim>{args, GetSquashedStrides(args.strides(), keep)}...);
+            std::integral_constant<bool, InComputeType && AllFloat16<Ts...>::value>{},
+            op,
+            Indexer<Ndim>{shape},
+            IndexableArray<Ts, Ndim>{args, GetSquashedStrides(args.strides(), keep)}...);
 }
 
-}  // namespace elementwise_detail
-
-template <typename... Ts, typename... Arrays, typename Op>
-void Elementwise(Op&& op, const Arrays&... args) {
+template <bool InComputeType, typename... Ts, typename... Arrays, typename Op>
+void ElementwiseImpl(Op&& op, const Arrays&... args) {
     static_assert(sizeof...(Ts) == sizeof...(Arrays), "Data types must be specified per Array. ");
 
     std::tuple<Shape, Axes> squashed_result = SquashShape(args...);
@@ -42,22 +124,38 @@ void Elementwise(Op&& op, const Arrays&... args) {
     // TODO(hvy): Reconsider the number of statically-optimized kernels in terms of speed and binary size trade-offs.
     switch (squashed.ndim()) {
         case 1:
-            elementwise_detail::LaunchElementwiseKernel<1, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
+            LaunchElementwiseKernel<1, InComputeType, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
             break;
         case 2:
-            elementwise_detail::LaunchElementwiseKernel<2, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
+            LaunchElementwiseKernel<2, InComputeType, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
             break;
         case 3:
-            elementwise_detail::LaunchElementwiseKernel<3, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
+            LaunchElementwiseKernel<3, InComputeType, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
             break;
         case 4:
-            elementwise_detail::LaunchElementwiseKernel<4, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
+            LaunchElementwiseKernel<4, InComputeType, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
             break;
         default:
-            elementwise_detail::LaunchElementwiseKernel<kDynamicNdim, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
+            LaunchElementwiseKernel<kDynamicNdim, InComputeType, Op, Ts...>(std::forward<Op>(op), squashed, keep, args...);
             break;
     }
 }
 
+}  // namespace elementwise_detail
+
+template <typename... Ts, typename... Arrays, typename Op>
+void Elementwise(Op&& op, const Arrays&... args) {
+    elementwise_detail::ElementwiseImpl<false, Ts...>(std::forward<Op>(op), args...);
+}
+
+// Same as Elementwise, except that `op` takes the values as ElementwiseComputeType.
+// Kernels on float16 arrays load blocks of elements, compute them in float32 and store the results back, so that the values are
+// converted in bulk rather than on every arithmetic operation.
+// `op` must not read the outputs.
+template <typename... Ts, typename... Arrays, typename Op>
+void ElementwiseInComputeType(Op&& op, const Arrays&... args) {
+    elementwise_detail::ElementwiseImpl<true, Ts...>(std::forward<Op>(op), args...);
+}
+
 }  // namespace native
 }  // namespace chainerx
@@ -2,23 +2,32 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
 #include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/array_index.h"
+#include "chainerx/axes.h"
 #include "chainerx/backend.h"
+#include "chainerx/backend_util.h"
 #include "chainerx/constant.h"
 #include "chainerx/device.h"
 #include "chainerx/dims.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/kernels/creation.h"
+#include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
+#include "chainerx/memory_format.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
@@ -148,6 +157,110 @@ Array Im2Col(const Array& x, const Dims& kernel_size, const Dims& stride, const
     return out;
 }
 
+Array Im2ColChannelsLast(const Array& x, const Dims& kernel_size, const Dims& stride, const Dims& pad, bool cover_all, Scalar pad_value) {
+    auto ndim = static_cast<int8_t>(kernel_size.size());  // Number of input image dimensions.
+    CHAINERX_ASSERT(ndim == static_cast<int8_t>(stride.size()));
+    CHAINERX_ASSERT(ndim == static_cast<int8_t>(pad.size()));
+    CHAINERX_ASSERT(ndim + 2 == x.ndim());  // Batch and channel dimensions.
+
+    Device& device = x.device();
+    int64_t item_size = GetItemSize(x.dtype());
+
+    // Create a padded channels-last copy of the input image, so that the channels of each pixel are contiguous.
+    // Unpadded inputs whose channels are already contiguous are read in place.
+    Shape padded_shape = x.shape();
+    std::vector<ArrayIndex> unpadded_slice{ArrayIndex{Slice{}}, ArrayIndex{Slice{}}};  // All batch and channel dimensions.
+    for (int64_t i = 0; i < ndim; ++i) {
+        padded_shape[i + 2] += pad[i] * 2 + (cover_all ? stride[i] - 1 : 0);  // Pad on both sides.
+        unpadded_slice.emplace_back(Slice{pad[i], pad[i] + x.shape()[i + 2]});
+    }
+    bool padded = cover_all || std::any_of(pad.begin(), pad.end(), [](int64_t p) { return p != 0; });
+    Array padded_x = x;
+    if (padded || x.strides()[1] != item_size) {
+        padded_x = internal::Empty(
+                padded_shape, x.dtype(), GetMemoryFormatStrides(padded_shape, item_size, MemoryFormat::kChannelsLast), device);
+        if (padded) {
+            device.backend().CallKernel<FillKernel>(padded_x, pad_value);
+        }
+        device.backend().CallKernel<CopyKernel>(x, padded ? padded_x.At(unpadded_slice) : padded_x);
+    }
+
+    Dims out_dims;  // Number of patches along each axis
+    for (int8_t i = 0; i < ndim; ++i) {
+        out_dims.emplace_back(internal::GetConvOutDim(x.shape()[i + 2], kernel_size[i], stride[i], pad[i], cover_all));
+        CHAINERX_ASSERT(out_dims.back() > 0);
+    }
+
+    int64_t batch_size = x.shape()[0];
+    int64_t channels = x.shape()[1];
+
+    Shape out_shape{batch_size};
+    std::copy(out_dims.begin(), out_dims.end(), std::back_inserter(out_shape));
+    std::copy(kernel_size.begin(), kernel_size.end(), std::back_inserter(out_shape));
+    out_shape.emplace_back(channels);
+    Array out = Empty(out_shape, x.dtype(), device);
+    if (out.GetTotalSize() == 0) {
+        return out;
+    }
+
+    int64_t out_total_size = std::accumulate(out_dims.begin(), out_dims.end(), int64_t{1}, std::multiplies<>());
+    int64_t kernel_total_size = std::accumulate(kernel_size.begin(), kernel_size.end(), int64_t{1}, std::multiplies<>());
+    int64_t patch_bytes = channels * item_size;
+    const Strides& padded_strides = padded_x.strides();
+    const auto* padded_ptr = static_cast<const uint8_t*>(internal::GetRawOffsetData(padded_x));
+    auto* out_ptr = static_cast<uint8_t*>(internal::GetRawOffsetData(out));
+
+    // Each row of the output is a patch, which consists of kernel_total_size runs of channels.
+    int64_t grain_size = std::max(int64_t{1}, int64_t{4096} / std::max(int64_t{1}, kernel_total_size * channels));
+    ParallelFor(batch_size * out_total_size, grain_size, [&](int64_t first, int64_t last) {
+        std::vector<int64_t> out_index(ndim);
+        std::vector<int64_t> kernel_index(ndim);
+        for (int64_t row = first; row < last; ++row) {
+            int64_t rest = row;
+            for (int8_t i = ndim - 1; i >= 0; --i) {
+                out_index[i] = rest % out_dims[i];
+                rest /= out_dims[i];
+            }
+            int64_t row_offset = rest * padded_strides[0];
+            for (int8_t i = 0; i < ndim; ++i) {
+                row_offset += out_index[i] * stride[i] * padded_strides[i + 2];
+            }
+
+            uint8_t* dst = out_ptr + row * kernel_total_size * patch_bytes;
+            std::fill(kernel_index.begin(), kernel_index.end(), int64_t{0});
+            for (int64_t k = 0; k < kernel_total_size; ++k) {
+                int64_t offset = row_offset;
+                for (int8_t i = 0; i < ndim; ++i) {
+                    offset += kernel_index[i] * padded_strides[i + 2];
+                }
+                std::memcpy(dst, padded_ptr + offset, patch_bytes);
+                dst += patch_bytes;
+                for (int8_t i = ndim - 1; i >= 0; --i) {
+                    if (++kernel_index[i] < kernel_size[i]) {
+                        break;
+                    }
+                    kernel_index[i] = 0;
+                }
+            }
+        }
+    });
+
+    return out;
+}
+
+Array ChannelsLastColToChannelsFirst(const Array& col) {
+    CHAINERX_ASSERT(col.ndim() % 2 == 0);
+    auto ndim = static_cast<int8_t>((col.ndim() - 2) / 2);  // Number of input image dimensions.
+    Axes axes{0, static_cast<int8_t>(2 * ndim + 1)};
+    for (int8_t i = 0; i < ndim; ++i) {
+        axes.emplace_back(static_cast<int8_t>(ndim + 1 + i));
+    }
+    for (int8_t i = 0; i < ndim; ++i) {
+        axes.emplace_back(static_cast<int8_t>(1 + i));
+    }
+    return col.Transpose(axes);
+}
+
 }  // namespace native_internal
 }  // namespace native
 }  // namespace chainerx
@@ -13,6 +13,18 @@ namespace native_internal {
 
 Array Im2Col(const Array& x, const Dims& kernel_size, const Dims& stride, const Dims& pad, bool cover_all, Scalar pad_value = 0);
 
+// Returns the column representation in channels-last order, i.e. of shape (batch_size, out_1, ..., out_n, k_1, ..., k_n, channel) where
+// each patch is contiguous, so that it can be used as a row-major matrix of (batch_size * out_1 * ... * out_n, k_1 * ... * k_n * channel)
+// without copying.
+//
+// The input may be in any memory format, but it is read in contiguous runs of channels if it is channels-last.
+Array Im2ColChannelsLast(
+        const Array& x, const Dims& kernel_size, const Dims& stride, const Dims& pad, bool cover_all, Scalar pad_value = 0);
+
+// Returns a view of a column array returned by Im2ColChannelsLast with the axes in the order of the one returned by Im2Col, i.e.
+// (batch_size, channel, k_1, ..., k_n, out_1, ..., out_n).
+Array ChannelsLastColToChannelsFirst(const Array& col);
+
 }  // namespace native_internal
 }  // namespace native
 }  // namespace chainerx
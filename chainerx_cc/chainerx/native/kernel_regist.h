@@ -1,6 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nonstd/optional.hpp>
 
 #include "chainerx/array.h"
 #include "chainerx/device.h"
@@ -8,34 +15,186 @@
 #include "chainerx/kernel_registry.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/native_device.h"
+#include "chainerx/native/numa.h"
+#include "chainerx/native/stream.h"
+
+namespace chainerx {
+namespace native {
+namespace kernel_regist_detail {
+
+// Returns the device of the first array argument or list of arrays, or nullptr if there is none.
+inline NativeDevice* FindNativeDevice() { return nullptr; }
+
+template <typename... Rest>
+NativeDevice* FindNativeDevice(const Array& arg, const Rest&... /*rest*/) {
+    return dynamic_cast<NativeDevice*>(&arg.device());
+}
+
+template <typename T, typename... Rest>
+NativeDevice* FindNativeDevice(const T& arg, const Rest&... rest);
+
+template <typename... Rest>
+NativeDevice* FindNativeDevice(const std::vector<Array>& arg, const Rest&... rest) {
+    if (arg.empty()) {
+        return FindNativeDevice(rest...);
+    }
+    return dynamic_cast<NativeDevice*>(&arg.front().device());
+}
+
+template <typename T, typename... Rest>
+NativeDevice* FindNativeDevice(const T& /*arg*/, const Rest&... rest) {
+    return FindNativeDevice(rest...);
+}
+
+// Checks the devices of the array arguments eagerly, since errors raised in the stream are only reported on synchronization.
+inline void CheckArgDevices(Device& /*device*/) {}
+
+template <typename... Rest>
+void CheckArgDevices(Device& device, const Array& arg, const Rest&... rest);
+
+template <typename... Rest>
+void CheckArgDevices(Device& device, const nonstd::optional<Array>& arg, const Rest&... rest);
+
+template <typename... Rest>
+void CheckArgDevices(Device& device, const std::vector<Array>& arg, const Rest&... rest);
+
+template <typename T, typename... Rest>
+void CheckArgDevices(Device& device, const T& /*arg*/, const Rest&... rest) {
+    CheckArgDevices(device, rest...);
+}
+
+template <typename... Rest>
+void CheckArgDevices(Device& device, const Array& arg, const Rest&... rest) {
+    device.CheckDevicesCompatible(arg);
+    CheckArgDevices(device, rest...);
+}
+
+template <typename... Rest>
+void CheckArgDevices(Device& device, const nonstd::optional<Array>& arg, const Rest&... rest) {
+    if (arg.has_value()) {
+        device.CheckDevicesCompatible(*arg);
+    }
+    CheckArgDevices(device, rest...);
+}
+
+template <typename... Rest>
+void CheckArgDevices(Device& device, const std::vector<Array>& arg, const Rest&... rest) {
+    for (const Array& a : arg) {
+        device.CheckDevicesCompatible(a);
+    }
+    CheckArgDevices(device, rest...);
+}
+
+// Returns the argument to be bound to a pending kernel.
+// Arrays are replaced with views sharing only the data, so that the array bodies and the graphs are not kept alive by the stream.
+inline Array ToTaskArg(const Array& arg) {
+    return internal::MakeArray(arg.shape(), arg.strides(), arg.dtype(), arg.device(), arg.data(), arg.offset());
+}
+
+inline nonstd::optional<Array> ToTaskArg(const nonstd::optional<Array>& arg) {
+    if (!arg.has_value()) {
+        return nonstd::nullopt;
+    }
+    return ToTaskArg(*arg);
+}
+
+inline std::vector<Array> ToTaskArg(const std::vector<Array>& arg) {
+    std::vector<Array> task_arg{};
+    task_arg.reserve(arg.size());
+    for (const Array& a : arg) {
+        task_arg.emplace_back(ToTaskArg(a));
+    }
+    return task_arg;
+}
+
+template <typename T>
+std::decay_t<T> ToTaskArg(const T& arg) {
+    return arg;
+}
+
+// Wraps a native kernel so that it is executed in the stream of the device if the asynchronous execution is enabled.
+// Kernels returning values are executed in the calling thread after the pending kernels are finished.
+// In either case, ParallelFor in the kernel uses the thread pool of the NUMA node of the device.
+template <typename KernelType, typename CallType>
+class AsyncKernel;
+
+template <typename KernelType, typename R, typename KeyKernelType, typename... Args>
+class AsyncKernel<KernelType, R (KeyKernelType::*)(Args...)> : public KernelType {
+public:
+    R Call(Args... args) override {
+        NativeDevice* device = FindNativeDevice(args...);
+        if (device == nullptr) {
+            return KernelType::Call(std::forward<Args>(args)...);
+        }
+        if (!device->is_async() || IsInKernelExecution()) {
+            // A kernel called from another kernel is executed immediately. It still waits for the pending kernels of its device, unless it
+            // is called from the stream of the device, which has finished them.
+            device->Synchronize();
+            NumaNodeScope numa_node_scope{device->numa_node_index()};
+            return KernelType::Call(std::forward<Args>(args)...);
+        }
+        return CallAsync(*device, std::is_void<R>{}, std::forward<Args>(args)...);
+    }
+
+private:
+    void CallAsync(NativeDevice& device, std::true_type /*is_void*/, Args... args) {
+        CheckArgDevices(device, args...);
+        // The arguments are copied so that the data of the arrays are kept alive until the kernel is executed.
+        device.Enqueue([this, node_index = device.numa_node_index(), args_tuple = std::make_tuple(ToTaskArg(args)...)]() mutable {
+            NumaNodeScope numa_node_scope{node_index};
+            CallWithTuple(args_tuple, std::index_sequence_for<Args...>{});
+        });
+    }
+
+    R CallAsync(NativeDevice& device, std::false_type /*is_void*/, Args... args) {
+        device.Synchronize();
+        KernelExecutionScope scope{};
+        NumaNodeScope numa_node_scope{device.numa_node_index()};
+        return KernelType::Call(std::forward<Args>(args)...);
+    }
+
+    template <typename Tuple, size_t... Is>
+    void CallWithTuple(Tuple& args_tuple, std::index_sequence<Is...> /*indices*/) {
+        KernelType::Call(std::get<Is>(args_tuple)...);
+    }
+};
+
+}  // namespace kernel_regist_detail
+}  // namespace native
+}  // namespace chainerx
 
 // Register an kernel statically in NativeBackend.
 #define CHAINERX_NATIVE_REGISTER_KERNEL(key_kernel_cls, kernel_cls)                                             \
-    static ::chainerx::internal::KernelRegistrar<::chainerx::native::NativeBackend, key_kernel_cls, kernel_cls> \
+    static ::chainerx::internal::KernelRegistrar<                                                               \
+            ::chainerx::native::NativeBackend,                                                                  \
+            key_kernel_cls,                                                                                     \
+            ::chainerx::native::kernel_regist_detail::AsyncKernel<kernel_cls, decltype(&key_kernel_cls::Call)>> \
             s_native_backend_kernel_##kernel_cls{};  // NOLINT(cert-err58-cpp)
 
-#define CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_UNARY_KERNEL(key_kernel_cls, kernel_body, visit_dtype) \
-                                                                                                      \
-    /* NOLINTNEXTLINE(misc-macro-parentheses) */                                                      \
-    class Native##key_kernel_cls : public key_kernel_cls {                                            \
-    public:                                                                                           \
-        void Call(const ::chainerx::Array& x, const ::chainerx::Array& out) override {                \
-            ::chainerx::Device& device = x.device();                                                  \
-            device.CheckDevicesCompatible(x, out);                                                    \
-            const ::chainerx::Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());   \
-            visit_dtype(out.dtype(), [&](auto pt) {                                                   \
-                using T = typename decltype(pt)::type;                                                \
-                struct Impl {                                                                         \
-                    void operator()(int64_t i, T x, T& out) {                                         \
-                        (void)i;                                                                      \
-                        kernel_body                                                                   \
-                    }                                                                                 \
-                };                                                                                    \
-                ::chainerx::native::Elementwise<const T, T>(Impl{}, x_cast, out);                     \
-            });                                                                                       \
-        }                                                                                             \
-    };                                                                                                \
-                                                                                                      \
+#define CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_UNARY_KERNEL(key_kernel_cls, kernel_body, visit_dtype)    \
+                                                                                                         \
+    /* NOLINTNEXTLINE(misc-macro-parentheses) */                                                         \
+    class Native##key_kernel_cls : public key_kernel_cls {                                               \
+    public:                                                                                              \
+        void Call(const ::chainerx::Array& x, const ::chainerx::Array& out) override {                   \
+            ::chainerx::Device& device = x.device();                                                     \
+            device.CheckDevicesCompatible(x, out);                                                       \
+            const ::chainerx::Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());      \
+            visit_dtype(out.dtype(), [&](auto pt) {                                                      \
+                using ArrayT = typename decltype(pt)::type;                                              \
+                using T = ::chainerx::native::ElementwiseComputeType<ArrayT>;                            \
+                struct Impl {                                                                            \
+                    void operator()(int64_t i, T x, T& out) {                                            \
+                        (void)i;                                                                         \
+                        kernel_body                                                                      \
+                    }                                                                                    \
+                };                                                                                       \
+                ::chainerx::native::ElementwiseInComputeType<const ArrayT, ArrayT>(Impl{}, x_cast, out); \
+            });                                                                                          \
+        }                                                                                                \
+    };                                                                                                   \
+                                                                                                         \
     CHAINERX_NATIVE_REGISTER_KERNEL(key_kernel_cls, Native##key_kernel_cls);
 
 #define CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(key_kernel_cls, kernel_body) \
@@ -44,29 +203,30 @@
 #define CHAINERX_NATIVE_REGISTER_ELTWISE_UNARY_KERNEL(key_kernel_cls, kernel_body) \
     CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_UNARY_KERNEL(key_kernel_cls, kernel_body, ::chainerx::VisitDtype)
 
-#define CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_BINARY_KERNEL(key_kernel_cls, kernel_body, visit_dtype)               \
-                                                                                                                     \
-    /* NOLINTNEXTLINE(misc-macro-parentheses) */                                                                     \
-    class Native##key_kernel_cls : public key_kernel_cls {                                                           \
-    public:                                                                                                          \
-        void Call(const ::chainerx::Array& x1, const ::chainerx::Array& x2, const ::chainerx::Array& out) override { \
-            ::chainerx::Device& device = x1.device();                                                                \
-            device.CheckDevicesCompatible(x1, x2, out);                                                              \
-            const ::chainerx::Array& x1_cast = x1.dtype() == out.dtype() ? x1 : x1.AsType(out.dtype());              \
-            const ::chainerx::Array& x2_cast = x2.dtype() == out.dtype() ? x2 : x2.AsType(out.dtype());              \
-            visit_dtype(out.dtype(), [&](auto pt) {                                                                  \
-                using T = typename decltype(pt)::type;                                                               \
-                struct Impl {                                                                                        \
-                    void operator()(int64_t i, T x1, T x2, T& out) {                                                 \
-                        (void)i;                                                                                     \
-                        kernel_body                                                                                  \
-                    }                                                                                                \
-                };                                                                                                   \
-                ::chainerx::native::Elementwise<const T, const T, T>(Impl{}, x1_cast, x2_cast, out);                 \
-            });                                                                                                      \
-        }                                                                                                            \
-    };                                                                                                               \
-                                                                                                                     \
+#define CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_BINARY_KERNEL(key_kernel_cls, kernel_body, visit_dtype)                           \
+                                                                                                                                 \
+    /* NOLINTNEXTLINE(misc-macro-parentheses) */                                                                                 \
+    class Native##key_kernel_cls : public key_kernel_cls {                                                                       \
+    public:                                                                                                                      \
+        void Call(const ::chainerx::Array& x1, const ::chainerx::Array& x2, const ::chainerx::Array& out) override {             \
+            ::chainerx::Device& device = x1.device();                                                                            \
+            device.CheckDevicesCompatible(x1, x2, out);                                                                          \
+            const ::chainerx::Array& x1_cast = x1.dtype() == out.dtype() ? x1 : x1.AsType(out.dtype());                          \
+            const ::chainerx::Array& x2_cast = x2.dtype() == out.dtype() ? x2 : x2.AsType(out.dtype());                          \
+            visit_dtype(out.dtype(), [&](auto pt) {                                                                              \
+                using ArrayT = typename decltype(pt)::type;                                                                      \
+                using T = ::chainerx::native::ElementwiseComputeType<ArrayT>;                                                    \
+                struct Impl {                                                                                                    \
+                    void operator()(int64_t i, T x1, T x2, T& out) {                                                             \
+                        (void)i;                                                                                                 \
+                        kernel_body                                                                                              \
+                    }                                                                                                            \
+                };                                                                                                               \
+                ::chainerx::native::ElementwiseInComputeType<const ArrayT, const ArrayT, ArrayT>(Impl{}, x1_cast, x2_cast, out); \
+            });                                                                                                                  \
+        }                                                                                                                        \
+    };                                                                                                                           \
+                                                                                                                                 \
     CHAINERX_NATIVE_REGISTER_KERNEL(key_kernel_cls, Native##key_kernel_cls);
 
 #define CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(key_kernel_cls, kernel_body) \
@@ -1,5 +1,6 @@
 #include "chainerx/native/native_backend.h"
 
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -7,6 +8,7 @@
 #include <gsl/gsl>
 
 #include "chainerx/native/native_device.h"
+#include "chainerx/native/numa.h"
 
 namespace chainerx {
 namespace native {
@@ -22,7 +24,8 @@ gsl::owner<NativeDevice*> CreateDevice(NativeBackend& backend, int index) { retu
 std::string NativeBackend::GetName() const { return kDefaultName; }
 
 // TODO(sonots): Returns number of CPU cores
-int NativeBackend::GetDeviceCount() const { return 4; }
+// At least one device is available for each NUMA node.
+int NativeBackend::GetDeviceCount() const { return std::max(4, static_cast<int>(GetNumaNodes().size())); }
 
 std::unique_ptr<Device> NativeBackend::CreateDevice(int index) {
     int device_count = GetDeviceCount();
@@ -1,9 +1,80 @@
 #include "chainerx/native/native_device.h"
 
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/native/numa.h"
+#include "chainerx/native/stream.h"
+#include "chainerx/util.h"
+
 namespace chainerx {
 namespace native {
+namespace {
+
+// Parses the value of the environment variable, which must be an integer.
+bool ParseAsyncEnv(const std::string& value) {
+    size_t pos = 0;
+    int async = 0;
+    try {
+        async = std::stoi(value, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (pos == 0 || pos != value.size()) {
+        throw ChainerxError{kNativeAsyncEnvVarName, " must be an integer: ", value};
+    }
+    return async != 0;
+}
+
+}  // namespace
+
+NativeDevice::NativeDevice(NativeBackend& backend, int index)
+    : Device(backend, index), numa_node_index_{static_cast<size_t>(index) % GetNumaNodes().size()} {
+    if (nonstd::optional<std::string> env = GetEnv(kNativeAsyncEnvVarName)) {
+        SetAsync(ParseAsyncEnv(*env));
+    }
+}
+
+NativeDevice::~NativeDevice() {
+    // The stream finishes the remaining kernels before it is destroyed.
+    stream_.reset();
+}
+
+void NativeDevice::Synchronize() {
+    if (stream_ != nullptr) {
+        stream_->Synchronize();
+    }
+}
+
+void NativeDevice::SetAsync(bool async) {
+    if (async == is_async()) {
+        return;
+    }
+    if (async) {
+        stream_ = std::make_unique<Stream>();
+        if (GetNumaNodes().size() > 1) {
+            const NumaNode& node = numa_node();
+            stream_->Enqueue([&node]() { PinCurrentThreadToNumaNode(node); });
+        }
+    } else {
+        Synchronize();
+        stream_.reset();
+    }
+}
 
-void NativeDevice::Synchronize() {}
+void NativeDevice::Enqueue(std::function<void()> task) {
+    CHAINERX_ASSERT(stream_ != nullptr);
+    stream_->Enqueue(std::move(task));
+}
 
 }  // namespace native
 }  // namespace chainerx
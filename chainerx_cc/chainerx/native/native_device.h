@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -15,6 +16,8 @@
 #include "chainerx/indexer.h"
 #include "chainerx/kernels/pooling.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/numa.h"
+#include "chainerx/native/stream.h"
 #include "chainerx/routines/pooling.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -69,8 +72,39 @@ private:
 
 class NativeDevice : public Device {
 public:
+    ~NativeDevice() override;
+
+    NativeDevice(const NativeDevice&) = delete;
+    NativeDevice(NativeDevice&&) = delete;
+    NativeDevice& operator=(const NativeDevice&) = delete;
+    NativeDevice& operator=(NativeDevice&&) = delete;
+
+    // Returns the index in GetNumaNodes() of the NUMA node this device is bound to.
+    // Devices are assigned to the nodes in a round-robin manner by their indices. Memory is allocated on the node and the kernels of this
+    // device run on the thread pool pinned to the node.
+    size_t numa_node_index() const { return numa_node_index_; }
+
+    const NumaNode& numa_node() const { return GetNumaNodes()[numa_node_index_]; }
+
+    // Blocks until all the kernels enqueued to this device are finished, and rethrows the first exception thrown by them, if any.
     void Synchronize() override;
 
+    // Returns true if kernels on this device are executed asynchronously.
+    bool is_async() const { return stream_ != nullptr; }
+
+    // Enables or disables the asynchronous execution of kernels on this device.
+    //
+    // If enabled, kernels not returning values are enqueued to a stream of this device and executed in its worker thread in the order they
+    // are called. Other kernels are executed in the calling thread after the pending kernels are finished. Reading the data of arrays on
+    // the host must be preceded by Synchronize(), which is implicitly done by ToNative, AsScalar and memory copies from this device.
+    //
+    // Pending kernels are finished before disabling. This function must not be called concurrently with kernels on this device.
+    void SetAsync(bool async);
+
+    // Enqueues a task to the stream of this device.
+    // The asynchronous execution must be enabled.
+    void Enqueue(std::function<void()> task);
+
     // memory.cc
 
     std::shared_ptr<void> Allocate(size_t bytesize) override;
@@ -87,10 +121,14 @@ public:
     std::shared_ptr<void> FromHostMemory(const std::shared_ptr<void>& src_ptr, size_t bytesize) override;
 
 protected:
-    NativeDevice(NativeBackend& backend, int index) : Device(backend, index) {}
+    NativeDevice(NativeBackend& backend, int index);
 
 private:
     friend NativeDevice* native_internal::CreateDevice(NativeBackend& backend, int index);
+
+    size_t numa_node_index_;
+
+    std::unique_ptr<Stream> stream_{};
 };
 
 }  // namespace native
@@ -4,6 +4,7 @@
 
 #include "chainerx/arithmetic_ops.h"
 #include "chainerx/array.h"
+#include "chainerx/bfloat16.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/float16.h"
@@ -114,6 +115,9 @@ double FloorDivide(double x, double y) {
 chainerx::Float16 FloorDivide(chainerx::Float16 x, chainerx::Float16 y) {
     return chainerx::Float16{FloorDivide(static_cast<float>(x), static_cast<float>(y))};
 }
+chainerx::BFloat16 FloorDivide(chainerx::BFloat16 x, chainerx::BFloat16 y) {
+    return chainerx::BFloat16{FloorDivide(static_cast<float>(x), static_cast<float>(y))};
+}
 
 CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_BINARY_KERNEL(FloorDivideKernel, { out = native::FloorDivide(x1, x2); }, VisitNumericDtype);
 
@@ -53,14 +53,26 @@ public:
         Dims kernel_size;
         std::copy_n(w.shape().begin() + 2, ndim, std::back_inserter(kernel_size));
 
-        // Convert to colum representation of shape (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n).
-        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, 0);
+        // Convert to column representation of shape (batch_size, out_1, out_2, ..., out_n, k_1, k_2, ..., k_n, channel), which is a
+        // row-major matrix of patches that can be multiplied without rearranging it.
+        Array col = native_internal::Im2ColChannelsLast(x, kernel_size, stride, pad, cover_all, 0);
 
-        // Compute the tensor dot product of col and w, reducing (channel, k_1, k_2, ..., k_n).
-        Axes axes;
-        axes.resize(ndim + 1);
-        std::iota(axes.begin(), axes.end(), 1);
-        Array y = TensorDot(col, w, axes, axes, out_dtype);  // (batch_size, out_1, out_2, ..., out_n, out_channel)
+        // Move the channel axis of w to the last to match col.
+        Axes w_axes{0};
+        for (int8_t i = 0; i < ndim; ++i) {
+            w_axes.emplace_back(int8_t{2} + i);
+        }
+        w_axes.emplace_back(int8_t{1});
+        Array w_channels_last = w.Transpose(w_axes);  // (out_channel, k_1, k_2, ..., k_n, channel)
+
+        // Compute the tensor dot product of col and w, reducing (k_1, k_2, ..., k_n, channel).
+        Axes col_axes;
+        col_axes.resize(ndim + 1);
+        std::iota(col_axes.begin(), col_axes.end(), ndim + 1);
+        Axes w_reduce_axes;
+        w_reduce_axes.resize(ndim + 1);
+        std::iota(w_reduce_axes.begin(), w_reduce_axes.end(), 1);
+        Array y = TensorDot(col, w_channels_last, col_axes, w_reduce_axes, out_dtype);  // (batch_size, out_1, ..., out_n, out_channel)
 
         // Add bias, if given.
         if (b.has_value()) {
@@ -68,7 +80,7 @@ public:
             y += b->AsType(y.dtype(), false);
         }
 
-        // Move the out channel axis to the second
+        // Move the out channel axis to the second, which makes the output channels-last.
         Axes roll_axes;
         roll_axes.resize(y.ndim());
         roll_axes[0] = 0;
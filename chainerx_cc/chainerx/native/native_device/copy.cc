@@ -1,36 +1,476 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif  // __SSE2__
 
 #include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/bfloat16.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
 #include "chainerx/kernels/creation.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/bulk_memory.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/shape.h"
+#include "chainerx/squash_dims.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
 namespace {
 
+void CopyElementwise(const Array& a, const Array& out) {
+    auto do_astype = [&](auto in_pt, auto out_pt) {
+        using InT = typename decltype(in_pt)::type;
+        using OutT = typename decltype(out_pt)::type;
+        struct Impl {
+            void operator()(int64_t /*i*/, InT a, OutT& out) { out = static_cast<OutT>(a); }
+        };
+        Elementwise<const InT, OutT>(Impl{}, a, out);
+    };
+    VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_astype, out_pt); });
+}
+
+// Converts `n` contiguous elements of a block into another dtype.
+using BlockConvertFunction = void (*)(const uint8_t* src, uint8_t* dst, int64_t n);
+
+void ConvertFloat16BlockToFloat(const uint8_t* src, uint8_t* dst, int64_t n) {
+    ConvertFloat16ToFloat(
+            reinterpret_cast<const Float16*>(src), reinterpret_cast<float*>(dst), n);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+void ConvertFloatBlockToFloat16(const uint8_t* src, uint8_t* dst, int64_t n) {
+    ConvertFloatToFloat16(
+            reinterpret_cast<const float*>(src), reinterpret_cast<Float16*>(dst), n);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+void ConvertBFloat16BlockToFloat(const uint8_t* src, uint8_t* dst, int64_t n) {
+    ConvertBFloat16ToFloat(
+            reinterpret_cast<const BFloat16*>(src), reinterpret_cast<float*>(dst), n);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+void ConvertFloatBlockToBFloat16(const uint8_t* src, uint8_t* dst, int64_t n) {
+    ConvertFloatToBFloat16(
+            reinterpret_cast<const float*>(src), reinterpret_cast<BFloat16*>(dst), n);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+// Returns the function to convert contiguous blocks between the dtypes in bulk, or nullptr if the conversion is only supported
+// elementwise.
+BlockConvertFunction GetBlockConvertFunction(Dtype src_dtype, Dtype dst_dtype) {
+    if (src_dtype == Dtype::kFloat16 && dst_dtype == Dtype::kFloat32) {
+        return &ConvertFloat16BlockToFloat;
+    }
+    if (src_dtype == Dtype::kFloat32 && dst_dtype == Dtype::kFloat16) {
+        return &ConvertFloatBlockToFloat16;
+    }
+    if (src_dtype == Dtype::kBFloat16 && dst_dtype == Dtype::kFloat32) {
+        return &ConvertBFloat16BlockToFloat;
+    }
+    if (src_dtype == Dtype::kFloat32 && dst_dtype == Dtype::kBFloat16) {
+        return &ConvertFloatBlockToBFloat16;
+    }
+    return nullptr;
+}
+
+// A copy from an array to another, decomposed into equally-sized contiguous memory blocks.
+struct BlockCopyPlan {
+    const uint8_t* src;
+    uint8_t* dst;
+    // Shape and byte strides of the grid of blocks.
+    Shape grid_shape;
+    Strides src_strides;
+    Strides dst_strides;
+    int64_t block_size;  // in bytes of the source
+    int64_t block_count;
+    // Function to convert the elements of a block, or nullptr if the blocks are copied as they are.
+    BlockConvertFunction convert;
+    int64_t block_length;  // in elements
+
+    void CopyBlocks(int64_t first, int64_t last) const {
+        int8_t ndim = grid_shape.ndim();
+        for (int64_t i = first; i < last; ++i) {
+            int64_t src_offset = 0;
+            int64_t dst_offset = 0;
+            int64_t rem = i;
+            for (int8_t dim = ndim - 1; dim >= 0; --dim) {
+                int64_t index = rem % grid_shape[dim];
+                rem /= grid_shape[dim];
+                src_offset += index * src_strides[dim];
+                dst_offset += index * dst_strides[dim];
+            }
+            if (convert == nullptr) {
+                // Large blocks, e.g. a whole contiguous array, are further split into parallel chunks.
+                BulkCopy(dst + dst_offset, src + src_offset, static_cast<size_t>(block_size));
+            } else {
+                convert(src + src_offset, dst + dst_offset, block_length);
+            }
+        }
+    }
+};
+
+// Returns a plan to copy the array with memcpy or bulk conversions, or nullopt if it requires an elementwise copy (i.e. casting other than
+// between float16 or bfloat16 and float32, or an innermost dimension which is non-contiguous).
+nonstd::optional<BlockCopyPlan> PlanBlockCopy(const Array& a, const Array& out) {
+    CHAINERX_ASSERT(a.shape() == out.shape());
+    BlockConvertFunction convert = nullptr;
+    if (a.dtype() != out.dtype()) {
+        convert = GetBlockConvertFunction(a.dtype(), out.dtype());
+        if (convert == nullptr) {
+            return nonstd::nullopt;
+        }
+    }
+
+    std::tuple<Shape, Axes> squashed_result = SquashShape(a.shape(), a.strides(), out.strides());
+    const Shape& squashed = std::get<0>(squashed_result);
+    const Axes& keep = std::get<1>(squashed_result);
+    Strides src_strides = GetSquashedStrides(a.strides(), keep);
+    Strides dst_strides = GetSquashedStrides(out.strides(), keep);
+
+    int64_t item_size = a.GetItemSize();
+    const uint8_t* src = static_cast<const uint8_t*>(a.raw_data()) + a.offset();
+    uint8_t* dst = static_cast<uint8_t*>(out.raw_data()) + out.offset();
+
+    if (squashed.ndim() == 0) {
+        return BlockCopyPlan{src, dst, Shape{}, Strides{}, Strides{}, item_size, 1, convert, 1};
+    }
+    if (src_strides.back() != item_size || dst_strides.back() != out.GetItemSize()) {
+        return nonstd::nullopt;
+    }
+    Shape grid_shape{squashed.begin(), squashed.end() - 1};
+    int64_t block_count = grid_shape.GetTotalSize();
+    return BlockCopyPlan{src,
+                         dst,
+                         std::move(grid_shape),
+                         Strides{src_strides.begin(), src_strides.end() - 1},
+                         Strides{dst_strides.begin(), dst_strides.end() - 1},
+                         squashed.back() * item_size,
+                         block_count,
+                         convert,
+                         squashed.back()};
+}
+
+// Number of bytes to be copied in a single task of the parallel loop.
+constexpr int64_t kMinBytesPerTask = int64_t{64} << 10;
+
+// Runs the planned copies in a single parallel loop.
+void CopyPlannedBlocks(const std::vector<BlockCopyPlan>& plans) {
+    // The block indices are concatenated across the plans so that the parallel loop can be balanced over all the blocks.
+    std::vector<int64_t> plan_offsets;
+    plan_offsets.reserve(plans.size());
+    int64_t total_block_count = 0;
+    int64_t total_bytes = 0;
+    for (const BlockCopyPlan& plan : plans) {
+        plan_offsets.emplace_back(total_block_count);
+        total_block_count += plan.block_count;
+        total_bytes += plan.block_count * plan.block_size;
+    }
+    if (total_block_count == 0) {
+        return;
+    }
+
+    int64_t average_block_size = std::max(int64_t{1}, total_bytes / total_block_count);
+    int64_t grain_size = std::max(int64_t{1}, kMinBytesPerTask / average_block_size);
+
+    ParallelFor(total_block_count, grain_size, [&plans, &plan_offsets](int64_t first, int64_t last) {
+        // Find the plan that contains the first block.
+        auto it = std::upper_bound(plan_offsets.begin(), plan_offsets.end(), first);
+        size_t i_plan = static_cast<size_t>(it - plan_offsets.begin()) - 1;
+        for (int64_t i = first; i < last; ++i_plan) {
+            const BlockCopyPlan& plan = plans[i_plan];
+            int64_t plan_first = i - plan_offsets[i_plan];
+            int64_t plan_last = std::min(plan.block_count, last - plan_offsets[i_plan]);
+            plan.CopyBlocks(plan_first, plan_last);
+            i = plan_offsets[i_plan] + plan_last;
+        }
+    });
+}
+
+// Side length in elements of the square tiles of transposing copies. A pair of source and destination tiles of 8-byte elements fits in the
+// L1 cache.
+constexpr int64_t kTransposeTileSize = 32;
+
+// Copies a tile of `rows` x `cols` elements of kItemSize bytes, where the source is contiguous along the rows and the destination is
+// contiguous along the columns.
+template <int64_t kItemSize>
+void TransposeTileScalar(const uint8_t* src, int64_t src_col_stride, uint8_t* dst, int64_t dst_row_stride, int64_t rows, int64_t cols) {
+    for (int64_t r = 0; r < rows; ++r) {
+        for (int64_t c = 0; c < cols; ++c) {
+            std::memcpy(dst + r * dst_row_stride + c * kItemSize, src + c * src_col_stride + r * kItemSize, kItemSize);
+        }
+    }
+}
+
+template <int64_t kItemSize>
+void TransposeTile(const uint8_t* src, int64_t src_col_stride, uint8_t* dst, int64_t dst_row_stride, int64_t rows, int64_t cols) {
+    TransposeTileScalar<kItemSize>(src, src_col_stride, dst, dst_row_stride, rows, cols);
+}
+
+#ifdef __SSE2__
+
+__m128i LoadUnaligned(const uint8_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+void StoreUnaligned(uint8_t* p, __m128i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+// 4-byte elements are transposed in registers in sub-tiles of 4x4.
+template <>
+void TransposeTile<4>(const uint8_t* src, int64_t src_col_stride, uint8_t* dst, int64_t dst_row_stride, int64_t rows, int64_t cols) {
+    int64_t r = 0;
+    for (; r + 4 <= rows; r += 4) {
+        int64_t c = 0;
+        for (; c + 4 <= cols; c += 4) {
+            // Each vector holds 4 rows of a column of the source.
+            const uint8_t* s = src + c * src_col_stride + r * 4;
+            __m128i v0 = LoadUnaligned(s);
+            __m128i v1 = LoadUnaligned(s + src_col_stride);
+            __m128i v2 = LoadUnaligned(s + 2 * src_col_stride);
+            __m128i v3 = LoadUnaligned(s + 3 * src_col_stride);
+            __m128i t0 = _mm_unpacklo_epi32(v0, v1);
+            __m128i t1 = _mm_unpacklo_epi32(v2, v3);
+            __m128i t2 = _mm_unpackhi_epi32(v0, v1);
+            __m128i t3 = _mm_unpackhi_epi32(v2, v3);
+            uint8_t* d = dst + r * dst_row_stride + c * 4;
+            StoreUnaligned(d, _mm_unpacklo_epi64(t0, t1));
+            StoreUnaligned(d + dst_row_stride, _mm_unpackhi_epi64(t0, t1));
+            StoreUnaligned(d + 2 * dst_row_stride, _mm_unpacklo_epi64(t2, t3));
+            StoreUnaligned(d + 3 * dst_row_stride, _mm_unpackhi_epi64(t2, t3));
+        }
+        TransposeTileScalar<4>(
+                src + c * src_col_stride + r * 4, src_col_stride, dst + r * dst_row_stride + c * 4, dst_row_stride, 4, cols - c);
+    }
+    TransposeTileScalar<4>(src + r * 4, src_col_stride, dst + r * dst_row_stride, dst_row_stride, rows - r, cols);
+}
+
+// 8-byte elements are transposed in registers in sub-tiles of 2x2.
+template <>
+void TransposeTile<8>(const uint8_t* src, int64_t src_col_stride, uint8_t* dst, int64_t dst_row_stride, int64_t rows, int64_t cols) {
+    int64_t r = 0;
+    for (; r + 2 <= rows; r += 2) {
+        int64_t c = 0;
+        for (; c + 2 <= cols; c += 2) {
+            const uint8_t* s = src + c * src_col_stride + r * 8;
+            __m128i v0 = LoadUnaligned(s);
+            __m128i v1 = LoadUnaligned(s + src_col_stride);
+            uint8_t* d = dst + r * dst_row_stride + c * 8;
+            StoreUnaligned(d, _mm_unpacklo_epi64(v0, v1));
+            StoreUnaligned(d + dst_row_stride, _mm_unpackhi_epi64(v0, v1));
+        }
+        TransposeTileScalar<8>(
+                src + c * src_col_stride + r * 8, src_col_stride, dst + r * dst_row_stride + c * 8, dst_row_stride, 2, cols - c);
+    }
+    TransposeTileScalar<8>(src + r * 8, src_col_stride, dst + r * dst_row_stride, dst_row_stride, rows - r, cols);
+}
+
+#endif  // __SSE2__
+
+// Copies a tile as TransposeTile does.
+using TransposeTileFunction =
+        void (*)(const uint8_t* src, int64_t src_col_stride, uint8_t* dst, int64_t dst_row_stride, int64_t rows, int64_t cols);
+
+// A copy between arrays of the same dtype whose contiguous axes differ, e.g. AsContiguous of a transposed view.
+//
+// Copying such arrays in the order of the destination reads a different cache line of the source for every element. Instead, the two
+// contiguous axes are copied in square tiles within which both the reads and the writes stay in the L1 cache, for every index of the
+// remaining axes.
+struct TransposeCopyPlan {
+    const uint8_t* src;
+    uint8_t* dst;
+    // Shape and byte strides of the grid of the other axes.
+    Shape grid_shape;
+    Strides src_strides;
+    Strides dst_strides;
+    int64_t rows;  // extent of the axis contiguous in the source
+    int64_t cols;  // extent of the axis contiguous in the destination
+    int64_t dst_row_stride;
+    int64_t src_col_stride;
+    int64_t item_size;
+    TransposeTileFunction transpose_tile;
+
+    int64_t row_tile_count() const { return (rows + kTransposeTileSize - 1) / kTransposeTileSize; }
+
+    // Copies the strips of tiles [first, last), where a strip is a row of tiles for an index of the grid.
+    void CopyStrips(int64_t first, int64_t last) const {
+        int8_t ndim = grid_shape.ndim();
+        int64_t row_tiles = row_tile_count();
+        for (int64_t i = first; i < last; ++i) {
+            int64_t src_offset = 0;
+            int64_t dst_offset = 0;
+            int64_t rem = i / row_tiles;
+            for (int8_t dim = ndim - 1; dim >= 0; --dim) {
+                int64_t index = rem % grid_shape[dim];
+                rem /= grid_shape[dim];
+                src_offset += index * src_strides[dim];
+                dst_offset += index * dst_strides[dim];
+            }
+            int64_t r = i % row_tiles * kTransposeTileSize;
+            int64_t tile_rows = std::min(kTransposeTileSize, rows - r);
+            const uint8_t* src_strip = src + src_offset + r * item_size;
+            uint8_t* dst_strip = dst + dst_offset + r * dst_row_stride;
+            for (int64_t c = 0; c < cols; c += kTransposeTileSize) {
+                int64_t tile_cols = std::min(kTransposeTileSize, cols - c);
+                transpose_tile(
+                        src_strip + c * src_col_stride, src_col_stride, dst_strip + c * item_size, dst_row_stride, tile_rows, tile_cols);
+            }
+        }
+    }
+};
+
+TransposeTileFunction GetTransposeTileFunction(int64_t item_size) {
+    switch (item_size) {
+        case 1:
+            return &TransposeTile<1>;
+        case 2:
+            return &TransposeTile<2>;
+        case 4:
+            return &TransposeTile<4>;
+        case 8:
+            return &TransposeTile<8>;
+        default:
+            return nullptr;
+    }
+}
+
+// Returns a plan to copy the array in transposed tiles, or nullopt if it requires an elementwise copy (i.e. casting, or either array
+// having no contiguous axis, or both having the same one).
+nonstd::optional<TransposeCopyPlan> PlanTransposeCopy(const Array& a, const Array& out) {
+    CHAINERX_ASSERT(a.shape() == out.shape());
+    if (a.dtype() != out.dtype()) {
+        return nonstd::nullopt;
+    }
+    int64_t item_size = a.GetItemSize();
+    TransposeTileFunction transpose_tile = GetTransposeTileFunction(item_size);
+    if (transpose_tile == nullptr) {
+        return nonstd::nullopt;
+    }
+
+    std::tuple<Shape, Axes> squashed_result = SquashShape(a.shape(), a.strides(), out.strides());
+    const Shape& squashed = std::get<0>(squashed_result);
+    const Axes& keep = std::get<1>(squashed_result);
+    Strides src_strides = GetSquashedStrides(a.strides(), keep);
+    Strides dst_strides = GetSquashedStrides(out.strides(), keep);
+
+    // Find the innermost axes along which the source and the destination are contiguous, respectively.
+    int8_t row_axis = -1;
+    int8_t col_axis = -1;
+    for (int8_t i = squashed.ndim() - 1; i >= 0; --i) {
+        if (row_axis < 0 && src_strides[i] == item_size) {
+            row_axis = i;
+        }
+        if (col_axis < 0 && dst_strides[i] == item_size) {
+            col_axis = i;
+        }
+    }
+    if (row_axis < 0 || col_axis < 0 || row_axis == col_axis) {
+        return nonstd::nullopt;
+    }
+
+    Shape grid_shape{};
+    Strides grid_src_strides{};
+    Strides grid_dst_strides{};
+    for (int8_t i = 0; i < squashed.ndim(); ++i) {
+        if (i != row_axis && i != col_axis) {
+            grid_shape.emplace_back(squashed[i]);
+            grid_src_strides.emplace_back(src_strides[i]);
+            grid_dst_strides.emplace_back(dst_strides[i]);
+        }
+    }
+    return TransposeCopyPlan{static_cast<const uint8_t*>(a.raw_data()) + a.offset(),
+                             static_cast<uint8_t*>(out.raw_data()) + out.offset(),
+                             std::move(grid_shape),
+                             std::move(grid_src_strides),
+                             std::move(grid_dst_strides),
+                             squashed[row_axis],
+                             squashed[col_axis],
+                             dst_strides[row_axis],
+                             src_strides[col_axis],
+                             item_size,
+                             transpose_tile};
+}
+
+void CopyTransposed(const TransposeCopyPlan& plan) {
+    int64_t strip_count = plan.grid_shape.GetTotalSize() * plan.row_tile_count();
+    int64_t strip_bytes = kTransposeTileSize * plan.cols * plan.item_size;
+    int64_t grain_size = std::max(int64_t{1}, kMinBytesPerTask / strip_bytes);
+    ParallelFor(strip_count, grain_size, [&plan](int64_t first, int64_t last) { plan.CopyStrips(first, last); });
+}
+
+// Copies an array which cannot be copied in contiguous blocks.
+void CopyStrided(const Array& a, const Array& out) {
+    if (nonstd::optional<TransposeCopyPlan> plan = PlanTransposeCopy(a, out)) {
+        CopyTransposed(*plan);
+    } else {
+        CopyElementwise(a, out);
+    }
+}
+
 class NativeCopyKernel : public CopyKernel {
 public:
     void Call(const Array& a, const Array& out) override {
         a.device().CheckDevicesCompatible(a, out);
-        auto do_astype = [&](auto in_pt, auto out_pt) {
-            using InT = typename decltype(in_pt)::type;
-            using OutT = typename decltype(out_pt)::type;
-            struct Impl {
-                void operator()(int64_t /*i*/, InT a, OutT& out) { out = static_cast<OutT>(a); }
-            };
-            Elementwise<const InT, OutT>(Impl{}, a, out);
-        };
-        VisitDtype(out.dtype(), [&](auto out_pt) { VisitDtype(a.dtype(), do_astype, out_pt); });
+        if (a.GetTotalSize() == 0) {
+            return;
+        }
+        if (nonstd::optional<BlockCopyPlan> plan = PlanBlockCopy(a, out)) {
+            CopyPlannedBlocks({std::move(*plan)});
+        } else {
+            CopyStrided(a, out);
+        }
     }
 };
 
 CHAINERX_NATIVE_REGISTER_KERNEL(CopyKernel, NativeCopyKernel);
 
+class NativeBatchCopyKernel : public BatchCopyKernel {
+public:
+    void Call(const std::vector<Array>& srcs, const std::vector<Array>& outs) override {
+        CHAINERX_ASSERT(srcs.size() == outs.size());
+
+        std::vector<BlockCopyPlan> plans;
+        std::vector<size_t> elementwise_indices;
+        for (size_t i = 0; i < srcs.size(); ++i) {
+            const Array& a = srcs[i];
+            const Array& out = outs[i];
+            a.device().CheckDevicesCompatible(a, out);
+            if (a.GetTotalSize() == 0) {
+                continue;
+            }
+            if (nonstd::optional<BlockCopyPlan> plan = PlanBlockCopy(a, out)) {
+                plans.emplace_back(std::move(*plan));
+            } else {
+                elementwise_indices.emplace_back(i);
+            }
+        }
+
+        CopyPlannedBlocks(plans);
+
+        // Arrays which need casting or strided access are copied one by one, but still in parallel with each other.
+        ParallelFor(static_cast<int64_t>(elementwise_indices.size()), 1, [&](int64_t first, int64_t last) {
+            for (int64_t i = first; i < last; ++i) {
+                size_t index = elementwise_indices[i];
+                CopyStrided(srcs[index], outs[index]);
+            }
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(BatchCopyKernel, NativeBatchCopyKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
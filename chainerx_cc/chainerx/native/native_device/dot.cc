@@ -135,6 +135,8 @@ bool MultiplyAdd(bool x, bool y, bool z) { return (x && y) || z; }
 
 float MultiplyAdd(Float16 x, Float16 y, float z) { return std::fmaf(static_cast<float>(x), static_cast<float>(y), z); }
 
+float MultiplyAdd(BFloat16 x, BFloat16 y, float z) { return std::fmaf(static_cast<float>(x), static_cast<float>(y), z); }
+
 float MultiplyAdd(float x, float y, float z) { return std::fmaf(x, y, z); }
 
 double MultiplyAdd(double x, double y, double z) { return std::fma(x, y, z); }
@@ -158,7 +160,7 @@ public:
             return;
         }
 
-        if (out.dtype() == Dtype::kFloat16) {
+        if (out.dtype() == Dtype::kFloat16 || out.dtype() == Dtype::kBFloat16) {
             Array a32 = a.AsType(Dtype::kFloat32, false);
             Array b32 = b.AsType(Dtype::kFloat32, false);
             Array acc = out.AsType(Dtype::kFloat32);
@@ -166,7 +168,7 @@ public:
 
             // TODO(gwtnb): Replace Fill(0) and += with CopyTo when CopyTo is added
             out.Fill(0);
-            out += acc.AsType(Dtype::kFloat16);
+            out += acc.AsType(out.dtype());
             return;
         }
 #endif  // CHAINERX_ENABLE_BLAS
@@ -192,7 +194,7 @@ public:
             CHAINERX_ASSERT(out.shape()[0] == m);
             CHAINERX_ASSERT(out.shape()[1] == n);
 
-            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+            using AccT = std::conditional_t<std::is_same<T, Float16>{} || std::is_same<T, BFloat16>{}, float, T>;
             constexpr auto acc_dtype = PrimitiveType<AccT>::kDtype;
 
             Array acc = out.AsType(acc_dtype, false);
@@ -10,6 +10,7 @@
 #include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/bulk_memory.h"
 #include "chainerx/native/data_type.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/kernel_regist.h"
@@ -148,6 +149,11 @@ public:
     void Call(const Array& out, Scalar value) override {
         VisitDtype(out.dtype(), [&](auto pt) {
             using T = typename decltype(pt)::type;
+            if (out.IsContiguous()) {
+                T item = static_cast<T>(value);
+                BulkFill(static_cast<uint8_t*>(out.raw_data()) + out.offset(), static_cast<size_t>(out.GetNBytes()), &item, sizeof(T));
+                return;
+            }
             struct Impl {
                 void operator()(int64_t /*i*/, T& out) { out = value; }
                 T value;
@@ -1,88 +1,320 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
+#include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/indexing.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/shape.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
 namespace {
 
+// Wraps an index into [0, axis_dim), as Take does not raise errors for out-of-bounds indices.
+int64_t WrapIndex(int64_t index, int64_t axis_dim) {
+    if (index < 0) {
+        index = axis_dim - ((-index + axis_dim - 1) % axis_dim + 1);
+    } else {
+        index = index % axis_dim;
+    }
+    CHAINERX_ASSERT(0 <= index);
+    CHAINERX_ASSERT(index < axis_dim);
+    return index;
+}
+
+// Returns true if the indices can be read directly by the kernels, without conversion to int64.
+bool IsDirectIndexDtype(Dtype dtype) { return dtype == Dtype::kInt32 || dtype == Dtype::kInt64; }
+
+// Returns true if Take can be performed by copying contiguous rows, i.e. the dimensions of the input after the axis are contiguous, and
+// the indices and the output are contiguous. This is typically the case for embedding lookups.
+bool CanTakeRows(const Array& a, const Array& indices, int8_t axis, const Array& out) {
+    if (!IsDirectIndexDtype(indices.dtype()) || !indices.IsContiguous() || !out.IsContiguous()) {
+        return false;
+    }
+    Shape right_shape{a.shape().begin() + (axis + 1), a.shape().end()};
+    Strides right_strides{a.strides().begin() + (axis + 1), a.strides().end()};
+    return internal::IsContiguous(right_shape, right_strides, a.GetItemSize());
+}
+
+// Takes rows with memcpy, in parallel over the rows.
+template <typename IndexType>
+void TakeRows(const Array& a, const Array& indices, int8_t axis, const Array& out) {
+    // Number of rows ahead whose source memory is prefetched.
+    // Rows are gathered from random locations, which hardware prefetchers cannot predict.
+    constexpr int64_t kPrefetchDistance = 4;
+    // Minimum number of bytes copied in a single task of the parallel loop.
+    constexpr int64_t kMinBytesPerTask = int64_t{32} << 10;
+
+    Shape left_shape{a.shape().begin(), a.shape().begin() + axis};
+    Strides left_strides{a.strides().begin(), a.strides().begin() + axis};
+    Shape right_shape{a.shape().begin() + (axis + 1), a.shape().end()};
+    int64_t row_size = right_shape.GetTotalSize() * a.GetItemSize();
+    int64_t index_count = indices.GetTotalSize();
+    int64_t row_count = left_shape.GetTotalSize() * index_count;
+    if (row_count == 0 || row_size == 0) {
+        return;
+    }
+
+    int64_t axis_dim = a.shape()[axis];
+    int64_t axis_stride = a.strides()[axis];
+    const uint8_t* a_ptr = static_cast<const uint8_t*>(a.raw_data()) + a.offset();
+    uint8_t* out_ptr = static_cast<uint8_t*>(out.raw_data()) + out.offset();
+    const IndexType* indices_ptr = reinterpret_cast<const IndexType*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<const uint8_t*>(indices.raw_data()) + indices.offset());
+
+    // Returns the pointer to the source of the i-th output row.
+    auto src_row = [&](int64_t i) {
+        int64_t i_left = i / index_count;
+        int64_t offset = WrapIndex(static_cast<int64_t>(indices_ptr[i % index_count]), axis_dim) * axis_stride;
+        for (int8_t dim = left_shape.ndim() - 1; dim >= 0; --dim) {
+            offset += i_left % left_shape[dim] * left_strides[dim];
+            i_left /= left_shape[dim];
+        }
+        return a_ptr + offset;
+    };
+
+    int64_t grain_size = std::max(int64_t{1}, kMinBytesPerTask / row_size);
+    ParallelFor(row_count, grain_size, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < std::min(first + kPrefetchDistance, last); ++i) {
+            CHAINERX_PREFETCH(src_row(i));
+        }
+        for (int64_t i = first; i < last; ++i) {
+            if (i + kPrefetchDistance < last) {
+                CHAINERX_PREFETCH(src_row(i + kPrefetchDistance));
+            }
+            std::memcpy(out_ptr + i * row_size, src_row(i), row_size);
+        }
+    });
+}
+
+template <typename IndexType>
+void TakeElementwise(const Array& a, const Array& indices, int8_t axis, const Array& out) {
+    VisitDtype(out.dtype(), [&a, &indices, axis, &out](auto pt) {
+        using T = typename decltype(pt)::type;
+
+        IndexableArray<const T> a_iarray{a};
+        IndexableArray<T> out_iarray{out};
+        IndexableArray<const IndexType> indices_iarray{indices};
+        Indexer<> a_indexer{a.shape()};
+        Indexer<> out_indexer{out.shape()};
+        Indexer<> indices_indexer{indices.shape()};
+
+        int64_t axis_dim = a.shape()[axis];
+
+        // left: set of input dimensions lower than the axis
+        // right: set of input dimensions higher than the axis
+        Shape left_shape{a.shape().begin(), a.shape().begin() + axis};
+        Shape right_shape{a.shape().begin() + (axis + 1), a.shape().end()};
+        Shape axis_shape{axis_dim};  // always ndim==1
+        Indexer<> left_indexer{left_shape};
+        Indexer<> right_indexer{right_shape};
+        Indexer<> axis_indexer{axis_shape};
+
+        auto it_left = left_indexer.It(0);
+        auto it_right = right_indexer.It(0);
+        auto it_axis = axis_indexer.It(0);
+        auto it_out = out_indexer.It(0);
+        auto it_a = a_indexer.It(0);
+
+        for (auto it = indices_indexer.It(0); it; ++it) {
+            int64_t index = WrapIndex(static_cast<int64_t>(indices_iarray[it]), axis_dim);
+            it_axis.Restart(index);
+
+            it_out.CopyIndex(it, it_left.ndim());
+            it_a.CopyIndex(it_axis, it_left.ndim());
+
+            for (it_left.Restart(); it_left; ++it_left) {
+                it_out.CopyIndex(it_left);
+                it_a.CopyIndex(it_left);
+
+                for (it_right.Restart(); it_right; ++it_right) {
+                    it_out.CopyIndex(it_right, it_left.ndim() + it.ndim());
+                    it_a.CopyIndex(it_right, it_left.ndim() + it_axis.ndim());
+                    out_iarray[it_out] = a_iarray[it_a];
+                }
+            }
+        }
+    });
+}
+
 class NativeTakeKernel : public TakeKernel {
 public:
     void Call(const Array& a, const Array& indices, int8_t axis, const Array& out) override {
         CHAINERX_ASSERT(GetKind(indices.dtype()) == DtypeKind::kInt || GetKind(indices.dtype()) == DtypeKind::kUInt);
+        CHAINERX_ASSERT(a.dtype() == out.dtype());
         a.device().CheckDevicesCompatible(a, indices, out);
 
-        const Array& indices_cast = indices.dtype() == Dtype::kInt64 ? indices : indices.AsType(Dtype::kInt64);
-
-        VisitDtype(out.dtype(), [&a, &indices_cast, axis, &out](auto pt) {
-            using T = typename decltype(pt)::type;
+        if (CanTakeRows(a, indices, axis, out)) {
+            if (indices.dtype() == Dtype::kInt32) {
+                TakeRows<int32_t>(a, indices, axis, out);
+            } else {
+                TakeRows<int64_t>(a, indices, axis, out);
+            }
+            return;
+        }
+
+        if (indices.dtype() == Dtype::kInt32) {
+            TakeElementwise<int32_t>(a, indices, axis, out);
+        } else {
+            const Array& indices_cast = indices.dtype() == Dtype::kInt64 ? indices : indices.AsType(Dtype::kInt64);
+            TakeElementwise<int64_t>(a, indices_cast, axis, out);
+        }
+    }
+};
 
-            IndexableArray<const T> a_iarray{a};
-            IndexableArray<T> out_iarray{out};
-            IndexableArray<const int64_t> indices_iarray{indices_cast};
-            Indexer<> a_indexer{a.shape()};
-            Indexer<> out_indexer{out.shape()};
-            Indexer<> indices_indexer{indices_cast.shape()};
-
-            int64_t axis_dim = a.shape()[axis];
-
-            // left: set of input dimensions lower than the axis
-            // right: set of input dimensions higher than the axis
-            Shape left_shape{a.shape().begin(), a.shape().begin() + axis};
-            Shape right_shape{a.shape().begin() + (axis + 1), a.shape().end()};
-            Shape axis_shape{axis_dim};  // always ndim==1
-            Indexer<> left_indexer{left_shape};
-            Indexer<> right_indexer{right_shape};
-            Indexer<> axis_indexer{axis_shape};
-
-            auto it_left = left_indexer.It(0);
-            auto it_right = right_indexer.It(0);
-            auto it_axis = axis_indexer.It(0);
-            auto it_out = out_indexer.It(0);
-            auto it_a = a_indexer.It(0);
-
-            for (auto it = indices_indexer.It(0); it; ++it) {
-                int64_t index = indices_iarray[it];
-                if (index < 0) {
-                    index = axis_dim - ((-index + axis_dim - 1) % axis_dim + 1);
-                } else {
-                    index = index % axis_dim;
-                }
-                CHAINERX_ASSERT(0 <= index);
-                CHAINERX_ASSERT(index < axis_dim);
-                it_axis.Restart(index);
+CHAINERX_NATIVE_REGISTER_KERNEL(TakeKernel, NativeTakeKernel);
 
-                it_out.CopyIndex(it, it_left.ndim());
-                it_a.CopyIndex(it_axis, it_left.ndim());
+// Returns true if AddAt can be performed by accumulating contiguous rows, i.e. the indices, `b` and the output are contiguous. This is
+// typically the case for gradients of embedding lookups.
+bool CanAddAtRows(const Array& indices, const Array& b, const Array& out) {
+    return IsDirectIndexDtype(indices.dtype()) && indices.IsContiguous() && b.IsContiguous() && out.IsContiguous();
+}
+
+// Adds a contiguous row of `n` elements into another.
+// The row is processed in fixed-size blocks so that the compiler can vectorize the inner loop without a runtime trip count.
+template <typename T>
+void AccumulateRow(T* CHAINERX_RESTRICT dst, const T* CHAINERX_RESTRICT src, int64_t n) {
+    constexpr int64_t kBlockSize = 16;
+    int64_t k = 0;
+    for (; k + kBlockSize <= n; k += kBlockSize) {
+        for (int64_t j = 0; j < kBlockSize; ++j) {
+            dst[k + j] += src[k + j];
+        }
+    }
+    for (; k < n; ++k) {
+        dst[k] += src[k];
+    }
+}
+
+// Adds rows of `b` into the output, which already holds the values of `a`.
+//
+// The indices are sorted by their destination rows and each run of the same destination row is accumulated by a single task, so that
+// duplicate indices do not race without any locks or atomics. Rows are accumulated in the order of the indices, so the result is
+// deterministic and identical to the sequential one.
+template <typename IndexType>
+void AddAtRows(const Array& indices, int8_t axis, const Array& b, const Array& out) {
+    // Minimum number of bytes accumulated in a single task of the parallel loop.
+    constexpr int64_t kMinBytesPerTask = int64_t{32} << 10;
+
+    Shape left_shape{out.shape().begin(), out.shape().begin() + axis};
+    Shape right_shape{out.shape().begin() + (axis + 1), out.shape().end()};
+    int64_t left_count = left_shape.GetTotalSize();
+    int64_t row_elems = right_shape.GetTotalSize();
+    int64_t index_count = indices.GetTotalSize();
+    if (left_count == 0 || row_elems == 0 || index_count == 0) {
+        return;
+    }
 
-                for (it_left.Restart(); it_left; ++it_left) {
-                    it_out.CopyIndex(it_left);
-                    it_a.CopyIndex(it_left);
+    int64_t axis_dim = out.shape()[axis];
+    const IndexType* indices_ptr = reinterpret_cast<const IndexType*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<const uint8_t*>(indices.raw_data()) + indices.offset());
 
-                    for (it_right.Restart(); it_right; ++it_right) {
-                        it_out.CopyIndex(it_right, it_left.ndim() + it.ndim());
-                        it_a.CopyIndex(it_right, it_left.ndim() + it_axis.ndim());
-                        out_iarray[it_out] = a_iarray[it_a];
+    // Pairs of the destination row and the position in the indices.
+    std::vector<std::pair<int64_t, int64_t>> entries;
+    entries.reserve(index_count);
+    for (int64_t i = 0; i < index_count; ++i) {
+        entries.emplace_back(WrapIndex(static_cast<int64_t>(indices_ptr[i]), axis_dim), i);
+    }
+    std::sort(entries.begin(), entries.end());
+
+    // Start positions of the runs of entries with the same destination row, followed by the end of the entries.
+    std::vector<int64_t> run_starts;
+    for (int64_t i = 0; i < index_count; ++i) {
+        if (i == 0 || entries[i].first != entries[i - 1].first) {
+            run_starts.emplace_back(i);
+        }
+    }
+    int64_t run_count = static_cast<int64_t>(run_starts.size());
+    run_starts.emplace_back(index_count);
+
+    int64_t bytes_per_run = left_count * row_elems * out.GetItemSize() * index_count / run_count;
+    int64_t grain_size = std::max(int64_t{1}, kMinBytesPerTask / std::max(int64_t{1}, bytes_per_run));
+
+    VisitDtype(out.dtype(), [&](auto pt) {
+        using T = typename decltype(pt)::type;
+        T* out_ptr = reinterpret_cast<T*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                static_cast<uint8_t*>(out.raw_data()) + out.offset());
+        const T* b_ptr = reinterpret_cast<const T*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                static_cast<const uint8_t*>(b.raw_data()) + b.offset());
+
+        ParallelFor(run_count, grain_size, [&](int64_t first, int64_t last) {
+            for (int64_t i_run = first; i_run < last; ++i_run) {
+                int64_t row = entries[run_starts[i_run]].first;
+                for (int64_t i_left = 0; i_left < left_count; ++i_left) {
+                    T* dst = out_ptr + (i_left * axis_dim + row) * row_elems;
+                    for (int64_t i = run_starts[i_run]; i < run_starts[i_run + 1]; ++i) {
+                        AccumulateRow(dst, b_ptr + (i_left * index_count + entries[i].second) * row_elems, row_elems);
                     }
                 }
             }
         });
-    }
-};
-
-CHAINERX_NATIVE_REGISTER_KERNEL(TakeKernel, NativeTakeKernel);
+    });
+}
+
+template <typename IndexType>
+void AddAtElementwise(const Array& indices, int8_t axis, const Array& b, const Array& out) {
+    VisitDtype(out.dtype(), [&indices, axis, &b, &out](auto pt) {
+        using T = typename decltype(pt)::type;
+
+        IndexableArray<const T> b_iarray{b};
+        IndexableArray<const IndexType> indices_iarray{indices};
+        IndexableArray<T> out_iarray{out};
+        Indexer<> b_indexer{b.shape()};
+        Indexer<> indices_indexer{indices.shape()};
+        Indexer<> out_indexer{out.shape()};
+
+        int64_t axis_dim = out.shape()[axis];
+
+        // left: set of input dimensions lower than the axis
+        // right: set of input dimensions higher than the axis
+        Shape left_shape{out.shape().begin(), out.shape().begin() + axis};
+        Shape right_shape{out.shape().begin() + (axis + 1), out.shape().end()};
+        Shape axis_shape{axis_dim};  // always ndim==1
+        Indexer<> left_indexer{left_shape};
+        Indexer<> right_indexer{right_shape};
+        Indexer<> axis_indexer{axis_shape};
+
+        auto it_left = left_indexer.It(0);
+        auto it_right = right_indexer.It(0);
+        auto it_axis = axis_indexer.It(0);
+        auto it_out = out_indexer.It(0);
+        auto it_b = b_indexer.It(0);
+
+        for (auto it = indices_indexer.It(0); it; ++it) {
+            int64_t index = WrapIndex(static_cast<int64_t>(indices_iarray[it]), axis_dim);
+            it_axis.Restart(index);
+
+            it_out.CopyIndex(it_axis, it_left.ndim());
+            it_b.CopyIndex(it, it_left.ndim());
+
+            for (it_left.Restart(); it_left; ++it_left) {
+                it_out.CopyIndex(it_left);
+                it_b.CopyIndex(it_left);
+
+                for (it_right.Restart(); it_right; ++it_right) {
+                    it_out.CopyIndex(it_right, it_left.ndim() + it_axis.ndim());
+                    it_b.CopyIndex(it_right, it_left.ndim() + it.ndim());
+                    out_iarray[it_out] += b_iarray[it_b];
+                }
+            }
+        }
+    });
+}
 
 class NativeAddAtKernel : public AddAtKernel {
 public:
@@ -91,68 +323,27 @@ public:
         CHAINERX_ASSERT(GetKind(indices.dtype()) == DtypeKind::kInt || GetKind(indices.dtype()) == DtypeKind::kUInt);
         a.device().CheckDevicesCompatible(a, indices, b);
 
-        const Array& indices_cast = indices.dtype() == Dtype::kInt64 ? indices : indices.AsType(Dtype::kInt64);
-
-        VisitDtype(a.dtype(), [&a, &indices_cast, axis, &b, &out](auto pt) {
-            using T = typename decltype(pt)::type;
-
-            IndexableArray<const T> a_iarray{a};
-            IndexableArray<const T> b_iarray{b};
-            IndexableArray<const int64_t> indices_iarray{indices_cast};
-            IndexableArray<T> out_iarray{out};
-            Indexer<> b_indexer{b.shape()};
-            Indexer<> indices_indexer{indices_cast.shape()};
-            Indexer<> out_indexer{out.shape()};  // indexer for both out_iarray and a_array
-
-            int64_t axis_dim = a.shape()[axis];
-
-            // left: set of input dimensions lower than the axis
-            // right: set of input dimensions higher than the axis
-            Shape left_shape{a.shape().begin(), a.shape().begin() + axis};
-            Shape right_shape{a.shape().begin() + (axis + 1), a.shape().end()};
-            Shape axis_shape{axis_dim};  // always ndim==1
-            Indexer<> left_indexer{left_shape};
-            Indexer<> right_indexer{right_shape};
-            Indexer<> axis_indexer{axis_shape};
-
-            // Copy
-            for (auto it = out_indexer.It(0); it; ++it) {
-                out_iarray[it] = a_iarray[it];
+        // The copy is skipped if the operation is in-place, e.g. accumulating into a zero-filled gradient.
+        bool is_inplace = a.raw_data() == out.raw_data() && a.offset() == out.offset() && a.strides() == out.strides();
+        if (!is_inplace) {
+            a.device().backend().CallKernel<BatchCopyKernel>(std::vector<Array>{a}, std::vector<Array>{out});
+        }
+
+        if (CanAddAtRows(indices, b, out)) {
+            if (indices.dtype() == Dtype::kInt32) {
+                AddAtRows<int32_t>(indices, axis, b, out);
+            } else {
+                AddAtRows<int64_t>(indices, axis, b, out);
             }
-
-            auto it_left = left_indexer.It(0);
-            auto it_right = right_indexer.It(0);
-            auto it_axis = axis_indexer.It(0);
-            auto it_out = out_indexer.It(0);
-            auto it_b = b_indexer.It(0);
-
-            // Add
-            for (auto it = indices_indexer.It(0); it; ++it) {
-                int64_t index = indices_iarray[it];
-                if (index < 0) {
-                    index = axis_dim - ((-index + axis_dim - 1) % axis_dim + 1);
-                } else {
-                    index = index % axis_dim;
-                }
-                CHAINERX_ASSERT(0 <= index);
-                CHAINERX_ASSERT(index < axis_dim);
-                it_axis.Restart(index);
-
-                it_out.CopyIndex(it_axis, it_left.ndim());
-                it_b.CopyIndex(it, it_left.ndim());
-
-                for (it_left.Restart(); it_left; ++it_left) {
-                    it_out.CopyIndex(it_left);
-                    it_b.CopyIndex(it_left);
-
-                    for (it_right.Restart(); it_right; ++it_right) {
-                        it_out.CopyIndex(it_right, it_left.ndim() + it_axis.ndim());
-                        it_b.CopyIndex(it_right, it_left.ndim() + it.ndim());
-                        out_iarray[it_out] += b_iarray[it_b];
-                    }
-                }
-            }
-        });
+            return;
+        }
+
+        if (indices.dtype() == Dtype::kInt32) {
+            AddAtElementwise<int32_t>(indices, axis, b, out);
+        } else {
+            const Array& indices_cast = indices.dtype() == Dtype::kInt64 ? indices : indices.AsType(Dtype::kInt64);
+            AddAtElementwise<int64_t>(indices_cast, axis, b, out);
+        }
     }
 };
 
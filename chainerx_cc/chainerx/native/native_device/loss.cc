@@ -0,0 +1,183 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/indexable_array.h"
+#include "chainerx/kernels/loss.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+using native_internal::ComputeType;
+
+// Number of elements of x processed in a single task of the parallel loop over the rows.
+constexpr int64_t kRowsGrainElements = int64_t{1} << 14;
+
+// Calls func(first, last) for the ranges of rows of x split among the threads.
+template <typename Func>
+void ParallelForRows(const Array& x, Func&& func) {
+    int64_t n = x.shape()[0];
+    int64_t c = x.shape()[1];
+    ParallelFor(n, std::max(int64_t{1}, kRowsGrainElements / std::max(int64_t{1}, c)), func);
+}
+
+// Reads the label of a row, returning -1 if the row is ignored.
+template <typename TLabel>
+int64_t GetLabel(const IndexableArray<const TLabel, 1>& t_iarray, int64_t i, int64_t c, int64_t ignore_label) {
+    int64_t index[] = {i};
+    auto label = static_cast<int64_t>(native_internal::StorageToDataType<const TLabel>(t_iarray[index]));
+    if (label == ignore_label) {
+        return -1;
+    }
+    if (label < 0 || c <= label) {
+        throw ChainerxError{"Label ", label, " at index ", i, " is out of the range of the classes [0, ", c, ")."};
+    }
+    return label;
+}
+
+// Returns the weight of a class, which is one if the weights are not given.
+template <typename T>
+ComputeType<T> GetClassWeight(const nonstd::optional<IndexableArray<const T, 1>>& w_iarray, int64_t label) {
+    if (!w_iarray.has_value()) {
+        return ComputeType<T>{1};
+    }
+    int64_t index[] = {label};
+    return static_cast<ComputeType<T>>(native_internal::StorageToDataType<const T>((*w_iarray)[index]));
+}
+
+// Computes logsumexp(x[i, :]) with the maximum subtracted for numerical stability.
+template <typename T>
+ComputeType<T> LogSumExpRow(const IndexableArray<const T, 2>& x_iarray, int64_t i, int64_t c) {
+    int64_t index[] = {i, 0};
+    auto x_at = [&x_iarray, &index](int64_t j) {
+        index[1] = j;
+        return static_cast<ComputeType<T>>(native_internal::StorageToDataType<const T>(x_iarray[index]));
+    };
+    ComputeType<T> max_value = x_at(0);
+    for (int64_t j = 1; j < c; ++j) {
+        max_value = std::max(max_value, x_at(j));
+    }
+    ComputeType<T> sum = 0;
+    for (int64_t j = 0; j < c; ++j) {
+        sum += std::exp(x_at(j) - max_value);
+    }
+    return max_value + std::log(sum);
+}
+
+template <typename T>
+nonstd::optional<IndexableArray<const T, 1>> MakeClassWeightIndexableArray(const nonstd::optional<Array>& class_weight) {
+    if (!class_weight.has_value()) {
+        return nonstd::nullopt;
+    }
+    return IndexableArray<const T, 1>{*class_weight};
+}
+
+class NativeSoftmaxCrossEntropyKernel : public SoftmaxCrossEntropyKernel {
+public:
+    void Call(const Array& x, const Array& t, const nonstd::optional<Array>& class_weight, int64_t ignore_label, const Array& out)
+            override {
+        CHAINERX_ASSERT(x.ndim() == 2);
+        int64_t c = x.shape()[1];
+
+        VisitFloatingPointDtype(x.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            VisitIntegralDtype(t.dtype(), [&](auto label_pt) {
+                using TLabel = typename decltype(label_pt)::type;
+                IndexableArray<const T, 2> x_iarray{x};
+                IndexableArray<const TLabel, 1> t_iarray{t};
+                nonstd::optional<IndexableArray<const T, 1>> w_iarray = MakeClassWeightIndexableArray<T>(class_weight);
+                IndexableArray<T, 1> out_iarray{out};
+
+                // Each row is read from memory once and reused from the cache by the passes computing the loss.
+                ParallelForRows(x, [&](int64_t first, int64_t last) {
+                    for (int64_t i = first; i < last; ++i) {
+                        int64_t label = GetLabel(t_iarray, i, c, ignore_label);
+                        int64_t out_index[] = {i};
+                        T& out_value = native_internal::StorageToDataType<T>(out_iarray[out_index]);
+                        if (label < 0) {
+                            out_value = T{0};
+                            continue;
+                        }
+                        int64_t x_index[] = {i, label};
+                        auto x_label = static_cast<ComputeType<T>>(native_internal::StorageToDataType<const T>(x_iarray[x_index]));
+                        out_value = static_cast<T>(GetClassWeight(w_iarray, label) * (LogSumExpRow(x_iarray, i, c) - x_label));
+                    }
+                });
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SoftmaxCrossEntropyKernel, NativeSoftmaxCrossEntropyKernel);
+
+class NativeSoftmaxCrossEntropyGradKernel : public SoftmaxCrossEntropyGradKernel {
+public:
+    void Call(
+            const Array& x,
+            const Array& t,
+            const nonstd::optional<Array>& class_weight,
+            int64_t ignore_label,
+            const Array& gout,
+            const Array& gx) override {
+        CHAINERX_ASSERT(x.ndim() == 2);
+        CHAINERX_ASSERT(x.shape() == gx.shape());
+        int64_t c = x.shape()[1];
+
+        VisitFloatingPointDtype(x.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            VisitIntegralDtype(t.dtype(), [&](auto label_pt) {
+                using TLabel = typename decltype(label_pt)::type;
+                IndexableArray<const T, 2> x_iarray{x};
+                IndexableArray<const TLabel, 1> t_iarray{t};
+                nonstd::optional<IndexableArray<const T, 1>> w_iarray = MakeClassWeightIndexableArray<T>(class_weight);
+                IndexableArray<const T, 1> gout_iarray{gout};
+                IndexableArray<T, 2> gx_iarray{gx};
+
+                ParallelForRows(x, [&](int64_t first, int64_t last) {
+                    for (int64_t i = first; i < last; ++i) {
+                        int64_t label = GetLabel(t_iarray, i, c, ignore_label);
+                        int64_t index[] = {i, 0};
+                        if (label < 0) {
+                            for (int64_t j = 0; j < c; ++j) {
+                                index[1] = j;
+                                native_internal::StorageToDataType<T>(gx_iarray[index]) = T{0};
+                            }
+                            continue;
+                        }
+                        int64_t gout_index[] = {i};
+                        auto gout_value = static_cast<ComputeType<T>>(native_internal::StorageToDataType<const T>(gout_iarray[gout_index]));
+                        ComputeType<T> coeff = gout_value * GetClassWeight(w_iarray, label);
+                        ComputeType<T> log_sum_exp = LogSumExpRow(x_iarray, i, c);
+                        for (int64_t j = 0; j < c; ++j) {
+                            index[1] = j;
+                            auto x_value = static_cast<ComputeType<T>>(native_internal::StorageToDataType<const T>(x_iarray[index]));
+                            ComputeType<T> y = std::exp(x_value - log_sum_exp);
+                            if (j == label) {
+                                y -= 1;
+                            }
+                            native_internal::StorageToDataType<T>(gx_iarray[index]) = static_cast<T>(coeff * y);
+                        }
+                    }
+                });
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SoftmaxCrossEntropyGradKernel, NativeSoftmaxCrossEntropyGradKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
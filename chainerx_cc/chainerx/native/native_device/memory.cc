@@ -2,30 +2,46 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <cstring>
 #include <memory>
 
 #include "chainerx/device.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/bulk_memory.h"
+#include "chainerx/native/numa.h"
 
 namespace chainerx {
 namespace native {
+namespace {
+
+// Minimum size of the buffers allocated on the NUMA node of the device, which is also the default mmap threshold of glibc.
+constexpr size_t kNumaBoundMinBytesize = 128 * 1024;
+
+}  // namespace
 
 std::shared_ptr<void> NativeDevice::Allocate(size_t bytesize) {
     if (bytesize == 0) {
         return std::shared_ptr<void>{nullptr};
     }
+    // Large buffers are mapped on pages bound to the NUMA node of this device on a multi-node host.
+    // Smaller buffers are left to the first-touch placement, as mapping pages for each of them would cost more than it saves.
+    if (GetNumaNodes().size() > 1 && bytesize >= kNumaBoundMinBytesize) {
+        return AllocateOnNumaNode(bytesize, numa_node());
+    }
     return std::shared_ptr<uint8_t>{new uint8_t[bytesize], std::default_delete<uint8_t[]>()};
 }
 
 void NativeDevice::MemoryCopyFrom(void* dst, const void* src, size_t bytesize, Device& src_device) {
     CHAINERX_ASSERT(nullptr != dynamic_cast<NativeDevice*>(&src_device) && "Native device only supports copy between native devices");
-    std::memcpy(dst, src, bytesize);
+    Synchronize();
+    src_device.Synchronize();
+    BulkCopy(dst, src, bytesize);
 }
 
 void NativeDevice::MemoryCopyTo(void* dst, const void* src, size_t bytesize, Device& dst_device) {
     CHAINERX_ASSERT(nullptr != dynamic_cast<NativeDevice*>(&dst_device) && "Native device only supports copy between native devices");
-    std::memcpy(dst, src, bytesize);
+    Synchronize();
+    dst_device.Synchronize();
+    BulkCopy(dst, src, bytesize);
 }
 
 std::shared_ptr<void> NativeDevice::TransferDataFrom(
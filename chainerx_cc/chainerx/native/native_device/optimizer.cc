@@ -0,0 +1,201 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/optimizer.h"
+#include "chainerx/native/data_type.h"
+#include "chainerx/native/elementwise.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+using native_internal::ComputeType;
+
+// Number of elements updated in a single task of the parallel loop.
+constexpr int64_t kUpdateGrainSize = int64_t{1} << 14;
+
+// Operands of the update of a parameter. Only the gradient, which is the second operand, is read-only.
+template <typename T, size_t I>
+using OperandType = std::conditional_t<I == 1, const T, T>;
+
+template <typename T>
+native_internal::StorageType<T>* GetStoragePtr(const Array& a) {
+    return reinterpret_cast<native_internal::StorageType<T>*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            static_cast<uint8_t*>(a.raw_data()) + a.offset());
+}
+
+template <typename T, size_t N, typename Impl, size_t... Is>
+void UpdateContiguous(
+        Impl impl,
+        const std::array<const std::vector<Array>*, N>& operands,
+        size_t index,
+        int64_t first,
+        int64_t last,
+        std::index_sequence<Is...> /*indices*/) {
+    std::array<native_internal::StorageType<T>*, N> ptrs{{GetStoragePtr<T>((*operands[Is])[index])...}};
+    for (int64_t i = first; i < last; ++i) {
+        impl(i, native_internal::StorageToDataType<T>(ptrs[Is][i])...);
+    }
+}
+
+template <typename T, size_t N, typename Impl, size_t... Is>
+void UpdateStrided(
+        Impl impl, const std::array<const std::vector<Array>*, N>& operands, size_t index, std::index_sequence<Is...> /*indices*/) {
+    Elementwise<OperandType<T, Is>...>(impl, (*operands[Is])[index]...);
+}
+
+// Applies an elementwise update to lists of arrays, where (*operands[k])[i] is the k-th operand of the i-th parameter, and make_impl(pt)
+// returns the update for the primitive type pt, called as impl(i, param, grad, states...).
+//
+// Contiguous parameters are updated in a single parallel loop over their concatenated elements, so that many small parameters are batched
+// into a few tasks and large ones are split. The others are updated one by one.
+template <size_t N, typename MakeImpl>
+void UpdateParams(const std::array<const std::vector<Array>*, N>& operands, MakeImpl&& make_impl) {
+    const std::vector<Array>& params = *operands[0];
+    std::vector<size_t> contiguous_indices{};
+    std::vector<int64_t> offsets{};
+    int64_t total_size = 0;
+    for (size_t index = 0; index < params.size(); ++index) {
+        int64_t size = params[index].GetTotalSize();
+        if (size == 0) {
+            continue;
+        }
+        auto is_contiguous = [index](const std::vector<Array>* arrays) { return (*arrays)[index].IsContiguous(); };
+        if (std::all_of(operands.begin(), operands.end(), is_contiguous)) {
+            contiguous_indices.emplace_back(index);
+            offsets.emplace_back(total_size);
+            total_size += size;
+        } else {
+            VisitFloatingPointDtype(params[index].dtype(), [&](auto pt) {
+                using T = typename decltype(pt)::type;
+                UpdateStrided<T>(make_impl(pt), operands, index, std::make_index_sequence<N>{});
+            });
+        }
+    }
+
+    ParallelFor(total_size, kUpdateGrainSize, [&](int64_t first, int64_t last) {
+        // Find the parameter that contains the first element.
+        auto it = std::upper_bound(offsets.begin(), offsets.end(), first);
+        size_t j = static_cast<size_t>(it - offsets.begin()) - 1;
+        for (int64_t i = first; i < last; ++j) {
+            size_t index = contiguous_indices[j];
+            int64_t param_first = i - offsets[j];
+            int64_t param_last = std::min(params[index].GetTotalSize(), last - offsets[j]);
+            VisitFloatingPointDtype(params[index].dtype(), [&](auto pt) {
+                using T = typename decltype(pt)::type;
+                UpdateContiguous<T>(make_impl(pt), operands, index, param_first, param_last, std::make_index_sequence<N>{});
+            });
+            i = offsets[j] + param_last;
+        }
+    });
+}
+
+template <typename T>
+struct SgdUpdateImpl {
+    void operator()(int64_t /*i*/, T& param, T grad) {
+        param = static_cast<T>(static_cast<ComputeType<T>>(param) - lr * static_cast<ComputeType<T>>(grad));
+    }
+    ComputeType<T> lr;
+};
+
+template <typename T>
+struct MomentumSgdUpdateImpl {
+    void operator()(int64_t /*i*/, T& param, T grad, T& v) {
+        ComputeType<T> new_v = momentum * static_cast<ComputeType<T>>(v) - lr * static_cast<ComputeType<T>>(grad);
+        v = static_cast<T>(new_v);
+        param = static_cast<T>(static_cast<ComputeType<T>>(param) + new_v);
+    }
+    ComputeType<T> lr;
+    ComputeType<T> momentum;
+};
+
+template <typename T>
+struct AdamUpdateImpl {
+    void operator()(int64_t /*i*/, T& param, T grad, T& m, T& v) {
+        auto g = static_cast<ComputeType<T>>(grad);
+        auto new_m = static_cast<ComputeType<T>>(m);
+        auto new_v = static_cast<ComputeType<T>>(v);
+        new_m += (1 - beta1) * (g - new_m);
+        new_v += (1 - beta2) * (g * g - new_v);
+        m = static_cast<T>(new_m);
+        v = static_cast<T>(new_v);
+        auto p = static_cast<ComputeType<T>>(param);
+        param = static_cast<T>(p - (alpha_t * new_m / (std::sqrt(new_v) + eps) + weight_decay_rate * p));
+    }
+    ComputeType<T> alpha_t;
+    ComputeType<T> beta1;
+    ComputeType<T> beta2;
+    ComputeType<T> eps;
+    ComputeType<T> weight_decay_rate;
+};
+
+class NativeSgdUpdateKernel : public SgdUpdateKernel {
+public:
+    void Call(const std::vector<Array>& params, const std::vector<Array>& grads, Scalar lr) override {
+        UpdateParams<2>({&params, &grads}, [lr](auto pt) {
+            using T = typename decltype(pt)::type;
+            return SgdUpdateImpl<T>{static_cast<ComputeType<T>>(lr)};
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SgdUpdateKernel, NativeSgdUpdateKernel);
+
+class NativeMomentumSgdUpdateKernel : public MomentumSgdUpdateKernel {
+public:
+    void Call(
+            const std::vector<Array>& params,
+            const std::vector<Array>& grads,
+            const std::vector<Array>& velocities,
+            Scalar lr,
+            Scalar momentum) override {
+        UpdateParams<3>({&params, &grads, &velocities}, [lr, momentum](auto pt) {
+            using T = typename decltype(pt)::type;
+            return MomentumSgdUpdateImpl<T>{static_cast<ComputeType<T>>(lr), static_cast<ComputeType<T>>(momentum)};
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(MomentumSgdUpdateKernel, NativeMomentumSgdUpdateKernel);
+
+class NativeAdamUpdateKernel : public AdamUpdateKernel {
+public:
+    void Call(
+            const std::vector<Array>& params,
+            const std::vector<Array>& grads,
+            const std::vector<Array>& ms,
+            const std::vector<Array>& vs,
+            Scalar alpha_t,
+            Scalar beta1,
+            Scalar beta2,
+            Scalar eps,
+            Scalar weight_decay_rate) override {
+        UpdateParams<4>({&params, &grads, &ms, &vs}, [alpha_t, beta1, beta2, eps, weight_decay_rate](auto pt) {
+            using T = typename decltype(pt)::type;
+            return AdamUpdateImpl<T>{static_cast<ComputeType<T>>(alpha_t),
+                                     static_cast<ComputeType<T>>(beta1),
+                                     static_cast<ComputeType<T>>(beta2),
+                                     static_cast<ComputeType<T>>(eps),
+                                     static_cast<ComputeType<T>>(weight_decay_rate)};
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(AdamUpdateKernel, NativeAdamUpdateKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -18,7 +18,9 @@
 #include "chainerx/kernels/indexing.h"
 #include "chainerx/kernels/pooling.h"
 #include "chainerx/kernels/reduction.h"
+#include "chainerx/kernels/statistics.h"
 #include "chainerx/macro.h"
+#include "chainerx/memory_format.h"
 #include "chainerx/native/col2im.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/im2col.h"
@@ -31,6 +33,7 @@
 #include "chainerx/routines/pooling.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace native {
@@ -43,6 +46,22 @@ Scalar GetLowestOrInf(Dtype dtype) {
     });
 }
 
+// Converts the input to the column representation of shape (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n).
+// If the input is channels-last, the column array is a view of channels-last columns, whose reductions are also channels-last.
+Array PoolIm2Col(const Array& x, const Dims& kernel_size, const Dims& stride, const Dims& pad, bool cover_all, Scalar pad_value) {
+    if (GetMemoryFormat(x) == MemoryFormat::kChannelsLast) {
+        return native_internal::ChannelsLastColToChannelsFirst(
+                native_internal::Im2ColChannelsLast(x, kernel_size, stride, pad, cover_all, pad_value));
+    }
+    return native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, pad_value);
+}
+
+// Allocates the output of a pooling of x, reducing the kernel axes of its column representation, in the memory format of x.
+Array EmptyPoolOutput(const Array& x, const Array& col, const Axes& kernel_axes) {
+    Shape out_shape = internal::ReduceShape(col.shape(), kernel_axes, false);
+    return internal::Empty(out_shape, col.dtype(), GetMemoryFormatStrides(out_shape, col.dtype(), GetMemoryFormat(x)), x.device());
+}
+
 // Returns axes that does the following transpose.
 // (batch_size, channel, a_1, a_2, ...., a_n, b_1, b_2, ..., b_n) -> (batch_size, channel, b_1, b_2, ...., b_n, a_1, a_2, ..., a_n).
 Axes GetSwapSpatialDimensionsAxes(size_t n) {
@@ -70,12 +89,13 @@ public:
         }
 
         // Convert to column representation of shape (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n).
-        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, GetLowestOrInf(x.dtype()));
+        Array col = PoolIm2Col(x, kernel_size, stride, pad, cover_all, GetLowestOrInf(x.dtype()));
         Axes axes{};
         axes.resize(kernel_size.size());
         std::iota(axes.begin(), axes.end(), 2);
 
-        Array actual_out = col.Max(axes);
+        Array actual_out = EmptyPoolOutput(x, col, axes);
+        x.device().backend().CallKernel<AMaxKernel>(col, axes, actual_out);
 
         std::unique_ptr<MaxPoolGradState> state =
                 return_state ? std::make_unique<NativeMaxPoolGradState>(x, std::move(col), std::move(axes)) : nullptr;
@@ -255,15 +275,14 @@ public:
             throw NotImplementedError{"Passing out as an argument is not yet supported."};
         }
 
-        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, false, 0);
+        Array col = PoolIm2Col(x, kernel_size, stride, pad, false, 0);
 
         // Average along the kernel dimensions of col with shape (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n).
         Axes kernel_axes{};
         kernel_axes.resize(kernel_size.size());
         std::iota(kernel_axes.begin(), kernel_axes.end(), 2);  // From k_1, up to k_n.
 
-        Device& device = col.device();
-        Array actual_out = internal::EmptyReduced(col.shape(), col.dtype(), kernel_axes, false, device);
+        Array actual_out = EmptyPoolOutput(x, col, kernel_axes);
 
         nonstd::optional<Array> width_ignore{nonstd::nullopt};
 
@@ -0,0 +1,445 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define CHAINERX_NATIVE_ENABLE_VNNI 1
+#endif  // (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/device.h"
+#include "chainerx/dims.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/indexable_array.h"
+#include "chainerx/kernels/quantization.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/elementwise.h"
+#include "chainerx/native/im2col.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/native/parallel.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+// Calls f with the primitive type of a quantized dtype.
+template <typename F>
+auto VisitQuantizedDtype(Dtype dtype, F&& f) {
+    switch (dtype) {
+        case Dtype::kInt8:
+            return std::forward<F>(f)(PrimitiveType<int8_t>{});
+        case Dtype::kUInt8:
+            return std::forward<F>(f)(PrimitiveType<uint8_t>{});
+        default:
+            throw DtypeError{"Quantized dtype must be int8 or uint8 but was ", GetDtypeName(dtype), "."};
+    }
+}
+
+// Rounds half to even and saturates to the range of Out. NaNs are mapped to the lowest value.
+template <typename Out, typename T>
+Out RoundAndSaturate(T v) {
+    v = std::nearbyint(v);
+    if (!(v >= static_cast<T>(std::numeric_limits<Out>::lowest()))) {
+        return std::numeric_limits<Out>::lowest();
+    }
+    if (v > static_cast<T>(std::numeric_limits<Out>::max())) {
+        return std::numeric_limits<Out>::max();
+    }
+    return static_cast<Out>(v);
+}
+
+class NativeQuantizeKernel : public QuantizeKernel {
+public:
+    void Call(const Array& x, const Array& scale, const Array& zero_point, const Array& out) override {
+        x.device().CheckDevicesCompatible(x, scale, zero_point, out);
+        CHAINERX_ASSERT(scale.dtype() == Dtype::kFloat32);
+        CHAINERX_ASSERT(zero_point.dtype() == Dtype::kInt32);
+        VisitNumericDtype(x.dtype(), [&](auto in_pt) {
+            using In = typename decltype(in_pt)::type;
+            // Integers are divided in double precision so that 32-bit accumulators can be requantized exactly.
+            using Compute = std::conditional_t<std::is_integral<In>::value || std::is_same<In, double>::value, double, float>;
+            VisitQuantizedDtype(out.dtype(), [&](auto out_pt) {
+                using Out = typename decltype(out_pt)::type;
+                struct Impl {
+                    void operator()(int64_t /*i*/, In x, float scale, int32_t zero_point, Out& out) {
+                        Compute q = static_cast<Compute>(x) / static_cast<Compute>(scale);
+                        out = RoundAndSaturate<Out>(std::nearbyint(q) + static_cast<Compute>(zero_point));
+                    }
+                };
+                Elementwise<const In, const float, const int32_t, Out>(Impl{}, x, scale, zero_point, out);
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(QuantizeKernel, NativeQuantizeKernel);
+
+class NativeDequantizeKernel : public DequantizeKernel {
+public:
+    void Call(const Array& q, const Array& scale, const Array& zero_point, const Array& out) override {
+        q.device().CheckDevicesCompatible(q, scale, zero_point, out);
+        CHAINERX_ASSERT(scale.dtype() == Dtype::kFloat32);
+        CHAINERX_ASSERT(zero_point.dtype() == Dtype::kInt32);
+        CHAINERX_ASSERT(out.dtype() == Dtype::kFloat32);
+        VisitQuantizedDtype(q.dtype(), [&](auto pt) {
+            using In = typename decltype(pt)::type;
+            struct Impl {
+                void operator()(int64_t /*i*/, In q, float scale, int32_t zero_point, float& out) {
+                    out = static_cast<float>(static_cast<int32_t>(q) - zero_point) * scale;
+                }
+            };
+            Elementwise<const In, const float, const int32_t, float>(Impl{}, q, scale, zero_point, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(DequantizeKernel, NativeDequantizeKernel);
+
+// Number of output columns computed at once, i.e. the number of 32-bit lanes of a 512-bit vector.
+constexpr int64_t kGemmColumnBlock = 16;
+
+// Number of consecutive products summed into each 32-bit lane at once.
+constexpr int64_t kGemmDepthGroup = 4;
+
+// Number of rows of `a` that share each loaded block of `b`.
+constexpr int64_t kGemmRowBlock = 4;
+
+// Operands of the quantized GEMM, repacked for the micro kernels.
+//
+// `a` is stored row-major as unsigned bytes, shifted by `a_offset` if it is signed, with the depth padded with zeros to a multiple of
+// kGemmDepthGroup. `b` is stored as blocks of kGemmColumnBlock columns, each of which is a sequence of groups of kGemmDepthGroup rows
+// laid out column by column, i.e. [N / 16][K / 4][16][4], padded with zeros. This is the operand layout of the VNNI dot product
+// instruction, and the portable kernel uses the same layout so that the compiler can vectorize it.
+struct PackedGemmOperands {
+    int64_t m{};
+    int64_t k{};
+    int64_t n{};
+    int64_t depth_groups{};
+    int64_t column_blocks{};
+    int32_t a_offset{};
+    std::vector<uint8_t> a;
+    std::vector<int8_t> b;
+    // Sums of the original elements of each row of `a` and of each column of `b`, used to subtract the zero points.
+    std::vector<int32_t> a_row_sums;
+    std::vector<int32_t> b_column_sums;
+
+    int64_t padded_depth() const { return depth_groups * kGemmDepthGroup; }
+    int64_t padded_columns() const { return column_blocks * kGemmColumnBlock; }
+};
+
+template <typename T>
+void PackGemmA(const Array& a, PackedGemmOperands& ops) {
+    IndexableArray<const T, 2> a_iarray{a};
+    int64_t padded_depth = ops.padded_depth();
+    int32_t offset = std::is_signed<T>::value ? 128 : 0;
+    ops.a_offset = offset;
+    ops.a.assign(ops.m * padded_depth, 0);
+    ops.a_row_sums.assign(ops.m, 0);
+    ParallelFor(ops.m, std::max(int64_t{1}, int64_t{1 << 16} / std::max(int64_t{1}, ops.k)), [&](int64_t first, int64_t last) {
+        int64_t index[2]{};
+        for (int64_t i = first; i < last; ++i) {
+            index[0] = i;
+            uint8_t* row = ops.a.data() + i * padded_depth;
+            int32_t sum = 0;
+            for (int64_t k = 0; k < ops.k; ++k) {
+                index[1] = k;
+                int32_t v = static_cast<int32_t>(a_iarray[index]);
+                row[k] = static_cast<uint8_t>(v + offset);
+                sum += v;
+            }
+            ops.a_row_sums[i] = sum;
+        }
+    });
+}
+
+void PackGemmB(const Array& b, PackedGemmOperands& ops) {
+    IndexableArray<const int8_t, 2> b_iarray{b};
+    ops.b.assign(ops.column_blocks * ops.depth_groups * kGemmColumnBlock * kGemmDepthGroup, 0);
+    ops.b_column_sums.assign(ops.n, 0);
+    int64_t index[2]{};
+    for (int64_t j = 0; j < ops.n; ++j) {
+        index[1] = j;
+        int8_t* block = ops.b.data() + (j / kGemmColumnBlock) * ops.depth_groups * kGemmColumnBlock * kGemmDepthGroup;
+        int64_t lane = j % kGemmColumnBlock;
+        int32_t sum = 0;
+        for (int64_t k = 0; k < ops.k; ++k) {
+            index[0] = k;
+            int8_t v = b_iarray[index];
+            block[(k / kGemmDepthGroup) * kGemmColumnBlock * kGemmDepthGroup + lane * kGemmDepthGroup + k % kGemmDepthGroup] = v;
+            sum += v;
+        }
+        ops.b_column_sums[j] = sum;
+    }
+}
+
+// Computes the raw products of `rows` rows of the packed `a` starting at `a_rows`, writing padded_columns() values per row to `raw`.
+void GemmRowsPortable(const PackedGemmOperands& ops, const uint8_t* a_rows, int64_t rows, int32_t* raw) {
+    int64_t padded_depth = ops.padded_depth();
+    int64_t padded_columns = ops.padded_columns();
+    for (int64_t r = 0; r < rows; ++r) {
+        const uint8_t* CHAINERX_RESTRICT a_row = a_rows + r * padded_depth;
+        for (int64_t jb = 0; jb < ops.column_blocks; ++jb) {
+            const int8_t* CHAINERX_RESTRICT b_block = ops.b.data() + jb * ops.depth_groups * kGemmColumnBlock * kGemmDepthGroup;
+            int32_t acc[kGemmColumnBlock]{};
+            for (int64_t g = 0; g < ops.depth_groups; ++g) {
+                const uint8_t* a_group = a_row + g * kGemmDepthGroup;
+                const int8_t* b_group = b_block + g * kGemmColumnBlock * kGemmDepthGroup;
+                for (int64_t l = 0; l < kGemmColumnBlock; ++l) {
+                    int32_t s = 0;
+                    for (int64_t t = 0; t < kGemmDepthGroup; ++t) {
+                        s += static_cast<int32_t>(a_group[t]) * static_cast<int32_t>(b_group[l * kGemmDepthGroup + t]);
+                    }
+                    acc[l] += s;
+                }
+            }
+            std::copy(std::begin(acc), std::end(acc), raw + r * padded_columns + jb * kGemmColumnBlock);
+        }
+    }
+}
+
+#ifdef CHAINERX_NATIVE_ENABLE_VNNI
+
+// The functions below are compiled for processors with AVX-512 VNNI regardless of the compiler flags, and are only called if the
+// processor at runtime supports it.
+
+bool IsVnniSupported() {
+    static const bool kSupported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vnni");
+    return kSupported;
+}
+
+template <int64_t kRows>
+__attribute__((target("avx512f,avx512vnni"))) void GemmRowsVnni(const PackedGemmOperands& ops, const uint8_t* a_rows, int32_t* raw) {
+    int64_t padded_depth = ops.padded_depth();
+    int64_t padded_columns = ops.padded_columns();
+    for (int64_t jb = 0; jb < ops.column_blocks; ++jb) {
+        const int8_t* b_block = ops.b.data() + jb * ops.depth_groups * kGemmColumnBlock * kGemmDepthGroup;
+        __m512i acc[kRows];
+        for (int64_t r = 0; r < kRows; ++r) {
+            acc[r] = _mm512_setzero_si512();
+        }
+        for (int64_t g = 0; g < ops.depth_groups; ++g) {
+            __m512i b_group = _mm512_loadu_si512(b_block + g * kGemmColumnBlock * kGemmDepthGroup);
+            for (int64_t r = 0; r < kRows; ++r) {
+                int32_t a_group{};
+                std::memcpy(&a_group, a_rows + r * padded_depth + g * kGemmDepthGroup, sizeof(a_group));
+                acc[r] = _mm512_dpbusd_epi32(acc[r], _mm512_set1_epi32(a_group), b_group);
+            }
+        }
+        for (int64_t r = 0; r < kRows; ++r) {
+            _mm512_storeu_si512(raw + r * padded_columns + jb * kGemmColumnBlock, acc[r]);
+        }
+    }
+}
+
+void GemmRowsVnni(const PackedGemmOperands& ops, const uint8_t* a_rows, int64_t rows, int32_t* raw) {
+    int64_t r = 0;
+    for (; r + kGemmRowBlock <= rows; r += kGemmRowBlock) {
+        GemmRowsVnni<kGemmRowBlock>(ops, a_rows + r * ops.padded_depth(), raw + r * ops.padded_columns());
+    }
+    for (; r < rows; ++r) {
+        GemmRowsVnni<1>(ops, a_rows + r * ops.padded_depth(), raw + r * ops.padded_columns());
+    }
+}
+
+#endif  // CHAINERX_NATIVE_ENABLE_VNNI
+
+void GemmRows(const PackedGemmOperands& ops, const uint8_t* a_rows, int64_t rows, int32_t* raw) {
+#ifdef CHAINERX_NATIVE_ENABLE_VNNI
+    if (IsVnniSupported()) {
+        GemmRowsVnni(ops, a_rows, rows, raw);
+        return;
+    }
+#endif  // CHAINERX_NATIVE_ENABLE_VNNI
+    GemmRowsPortable(ops, a_rows, rows, raw);
+}
+
+std::vector<int32_t> ToInt32Vector(const Array& a) {
+    CHAINERX_ASSERT(a.dtype() == Dtype::kInt32);
+    IndexableArray<const int32_t, 1> a_iarray{a};
+    std::vector<int32_t> values(a.GetTotalSize());
+    for (int64_t i = 0; i < a.GetTotalSize(); ++i) {
+        values[i] = a_iarray[&i];
+    }
+    return values;
+}
+
+std::vector<float> ToFloatVector(const Array& a) {
+    CHAINERX_ASSERT(a.dtype() == Dtype::kFloat32);
+    IndexableArray<const float, 1> a_iarray{a};
+    std::vector<float> values(a.GetTotalSize());
+    for (int64_t i = 0; i < a.GetTotalSize(); ++i) {
+        values[i] = a_iarray[&i];
+    }
+    return values;
+}
+
+class NativeQuantizedGemmKernel : public QuantizedGemmKernel {
+public:
+    void Call(
+            const Array& a,
+            const Array& a_zero_point,
+            const Array& b,
+            const Array& b_zero_point,
+            const nonstd::optional<Array>& bias,
+            const nonstd::optional<Array>& multiplier,
+            const nonstd::optional<Array>& out_zero_point,
+            const Array& out) override {
+        a.device().CheckDevicesCompatible(a, a_zero_point, b, b_zero_point, out);
+        CHAINERX_ASSERT(a.ndim() == 2 && b.ndim() == 2 && out.ndim() == 2);
+        CHAINERX_ASSERT(b.dtype() == Dtype::kInt8);
+        CHAINERX_ASSERT(multiplier.has_value() == (out.dtype() != Dtype::kInt32));
+        CHAINERX_ASSERT(out_zero_point.has_value() == (out.dtype() != Dtype::kInt32));
+
+        PackedGemmOperands ops{};
+        ops.m = a.shape()[0];
+        ops.k = a.shape()[1];
+        ops.n = b.shape()[1];
+        ops.depth_groups = (ops.k + kGemmDepthGroup - 1) / kGemmDepthGroup;
+        ops.column_blocks = (ops.n + kGemmColumnBlock - 1) / kGemmColumnBlock;
+        CHAINERX_ASSERT(b.shape()[0] == ops.k);
+        CHAINERX_ASSERT(out.shape() == Shape({ops.m, ops.n}));
+        if (ops.m == 0 || ops.n == 0) {
+            return;
+        }
+
+        VisitQuantizedDtype(a.dtype(), [&](auto pt) { PackGemmA<typename decltype(pt)::type>(a, ops); });
+        PackGemmB(b, ops);
+
+        // Fold the zero points and the bias into a per-column constant and per-column coefficients of the row sums, using
+        //
+        //     sum_k (a - za) * (b - zb) = sum_k (a + offset) * b - (offset + za) * sum_k b - zb * sum_k a + K * za * zb.
+        int32_t za = static_cast<int32_t>(AsScalar(a_zero_point));
+        std::vector<int32_t> zb = ToInt32Vector(b_zero_point);
+        // The terms are summed in int64_t, as the sums can exceed int32_t for large depths even with the zero points in range.
+        std::vector<int64_t> column_terms(ops.n);
+        for (int64_t j = 0; j < ops.n; ++j) {
+            column_terms[j] = -int64_t{ops.a_offset + za} * ops.b_column_sums[j] + ops.k * za * zb[j];
+        }
+        if (bias.has_value()) {
+            std::vector<int32_t> bias_values = ToInt32Vector(*bias);
+            for (int64_t j = 0; j < ops.n; ++j) {
+                column_terms[j] += bias_values[j];
+            }
+        }
+        std::vector<float> scales = multiplier.has_value() ? ToFloatVector(*multiplier) : std::vector<float>{};
+        int32_t zo = out_zero_point.has_value() ? static_cast<int32_t>(AsScalar(*out_zero_point)) : 0;
+
+        auto store = [&](auto out_pt) {
+            using Out = typename decltype(out_pt)::type;
+            IndexableArray<Out, 2> out_iarray{out};
+            int64_t grain_size = std::max(int64_t{1}, int64_t{1 << 16} / (ops.padded_depth() * ops.padded_columns() * kGemmRowBlock));
+            int64_t row_blocks = (ops.m + kGemmRowBlock - 1) / kGemmRowBlock;
+            ParallelFor(row_blocks, grain_size, [&](int64_t first, int64_t last) {
+                std::vector<int32_t> raw(kGemmRowBlock * ops.padded_columns());
+                int64_t index[2]{};
+                for (int64_t block = first; block < last; ++block) {
+                    int64_t i0 = block * kGemmRowBlock;
+                    int64_t rows = std::min(kGemmRowBlock, ops.m - i0);
+                    GemmRows(ops, ops.a.data() + i0 * ops.padded_depth(), rows, raw.data());
+                    for (int64_t r = 0; r < rows; ++r) {
+                        index[0] = i0 + r;
+                        int64_t row_sum = ops.a_row_sums[i0 + r];
+                        const int32_t* raw_row = &raw[r * ops.padded_columns()];
+                        for (int64_t j = 0; j < ops.n; ++j) {
+                            index[1] = j;
+                            int64_t acc = raw_row[j] + column_terms[j] - zb[j] * row_sum;
+                            if (std::is_same<Out, int32_t>::value) {
+                                out_iarray[index] = RoundAndSaturate<Out>(static_cast<double>(acc));
+                            } else {
+                                out_iarray[index] = RoundAndSaturate<Out>(static_cast<double>(acc) * scales[j] + zo);
+                            }
+                        }
+                    }
+                }
+            });
+        };
+        if (out.dtype() == Dtype::kInt32) {
+            store(PrimitiveType<int32_t>{});
+        } else {
+            VisitQuantizedDtype(out.dtype(), store);
+        }
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(QuantizedGemmKernel, NativeQuantizedGemmKernel);
+
+class NativeQuantizedConvKernel : public QuantizedConvKernel {
+public:
+    Array Call(
+            const Array& x,
+            const Array& x_zero_point,
+            const Array& w,
+            const Array& w_zero_point,
+            const nonstd::optional<Array>& bias,
+            const Dims& stride,
+            const Dims& pad,
+            const nonstd::optional<Array>& multiplier,
+            const nonstd::optional<Array>& out_zero_point,
+            Dtype out_dtype) override {
+        int8_t ndim = w.ndim() - 2;  // Number of spatial dimensions
+        int64_t batch_size = x.shape()[0];
+        int64_t out_channels = w.shape()[0];
+
+        Dims kernel_size;
+        std::copy_n(w.shape().begin() + 2, ndim, std::back_inserter(kernel_size));
+
+        // Pad with the zero point so that the padding represents the real value zero.
+        // col: (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n)
+        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, false, AsScalar(x_zero_point));
+
+        // Move the output positions before the reduced axes and flatten both to the operand a of shape (batch_size * out_1 * ... * out_n,
+        // channel * k_1 * ... * k_n).
+        Axes col_axes{0};
+        for (int8_t i = 0; i < ndim; ++i) {
+            col_axes.emplace_back(static_cast<int8_t>(ndim + 2 + i));
+        }
+        for (int8_t i = 0; i < ndim + 1; ++i) {
+            col_axes.emplace_back(static_cast<int8_t>(1 + i));
+        }
+        Shape out_spatial_shape{col.shape().end() - ndim, col.shape().end()};
+        int64_t out_positions = out_spatial_shape.GetTotalSize();
+        int64_t depth = w.GetTotalSize() / out_channels;
+        Array a = AsContiguous(col.Transpose(col_axes)).Reshape({batch_size * out_positions, depth});
+
+        // The weight is used as the transposed operand b of shape (channel * k_1 * ... * k_n, out_channels).
+        Array b = w.Reshape({out_channels, depth}).Transpose();
+
+        Array y = Empty({batch_size * out_positions, out_channels}, out_dtype, x.device());
+        x.device().backend().CallKernel<QuantizedGemmKernel>(a, x_zero_point, b, w_zero_point, bias, multiplier, out_zero_point, y);
+
+        // (batch_size, out_1, ..., out_n, out_channels) -> (batch_size, out_channels, out_1, ..., out_n)
+        Shape y_shape{batch_size};
+        std::copy(out_spatial_shape.begin(), out_spatial_shape.end(), std::back_inserter(y_shape));
+        y_shape.emplace_back(out_channels);
+        Axes roll_axes;
+        roll_axes.resize(ndim + 2);
+        roll_axes[0] = 0;
+        roll_axes[1] = ndim + 1;
+        std::iota(roll_axes.begin() + 2, roll_axes.end(), 1);
+        return y.Reshape(y_shape).Transpose(roll_axes);
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(QuantizedConvKernel, NativeQuantizedConvKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
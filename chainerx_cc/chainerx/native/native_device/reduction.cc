@@ -9,6 +9,7 @@
 #include "chainerx/kernels/reduction.h"
 #include "chainerx/kernels/sorting.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
 #include "chainerx/native/kernel_regist.h"
 #include "chainerx/native/reduce.h"
 #include "chainerx/numeric.h"
@@ -90,7 +91,7 @@ public:
         auto do_sum = [&a, &axis, &out](auto in_pt, auto out_pt) {
             using In = typename decltype(in_pt)::type;
             using Out = typename decltype(out_pt)::type;
-            using Accum = std::conditional_t<std::is_same<Out, Float16>{}, float, Out>;
+            using Accum = native_internal::ComputeType<Out>;
             struct Impl {
                 Accum Identity() { return Accum{0}; }
                 Accum MapIn(In in, int64_t /*index*/) { return static_cast<Accum>(in); }
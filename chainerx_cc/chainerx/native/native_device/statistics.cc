@@ -1,11 +1,14 @@
 #include "chainerx/native/native_device.h"
 
 #include <cstdint>
+#include <type_traits>
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
+#include "chainerx/bfloat16.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
 #include "chainerx/kernels/statistics.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/kernel_regist.h"
@@ -68,6 +71,92 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(AMinKernel, NativeAMinKernel);
 
+// Running statistics of a set of values, from which the mean and the variance are obtained.
+template <typename Accum>
+struct MeanVarAccum {
+    int64_t count;
+    Accum mean;
+    Accum m2;  // Sum of the squared deviations from the mean.
+};
+
+// Computes the mean and the sum of the squared deviations in a single pass, combining the statistics of partial sums with the formula of
+// Chan et al. The pairwise reduction makes this numerically as accurate as a two-pass computation, unlike the naive sum of squares.
+template <typename In, typename Accum>
+struct MeanVarImpl {
+    MeanVarAccum<Accum> Identity() { return {0, Accum{0}, Accum{0}}; }
+    MeanVarAccum<Accum> MapIn(In in, int64_t /*index*/) { return {1, static_cast<Accum>(in), Accum{0}}; }
+    void Reduce(MeanVarAccum<Accum> next, MeanVarAccum<Accum>& accum) {
+        if (next.count == 0) {
+            return;
+        }
+        if (accum.count == 0) {
+            accum = next;
+            return;
+        }
+        int64_t count = accum.count + next.count;
+        Accum delta = next.mean - accum.mean;
+        Accum next_ratio = static_cast<Accum>(next.count) / static_cast<Accum>(count);
+        accum.mean += delta * next_ratio;
+        accum.m2 += next.m2 + delta * delta * static_cast<Accum>(accum.count) * next_ratio;
+        accum.count = count;
+    }
+};
+
+// Float16 and BFloat16 values are accumulated in float.
+template <typename Out>
+using MeanVarAccumType = std::conditional_t<std::is_same<Out, Float16>{} || std::is_same<Out, BFloat16>{}, float, Out>;
+
+class NativeVarKernel : public VarKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& out) override {
+        CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out.shape(), true));
+        CHAINERX_ASSERT(GetKind(out.dtype()) == DtypeKind::kFloat);
+        a.device().CheckDevicesCompatible(a, out);
+
+        auto do_var = [&a, &axis, &out](auto in_pt, auto out_pt) {
+            using In = typename decltype(in_pt)::type;
+            using Out = typename decltype(out_pt)::type;
+            using Accum = MeanVarAccumType<Out>;
+            struct Impl : MeanVarImpl<In, Accum> {
+                Out MapOut(MeanVarAccum<Accum> accum) { return static_cast<Out>(accum.m2 / static_cast<Accum>(accum.count)); }
+            };
+            Reduce<In, Out>(a, axis, out, Impl{});
+        };
+
+        VisitFloatingPointDtype(out.dtype(), [a_dtype = a.dtype(), &do_var](auto out_pt) { VisitDtype(a_dtype, do_var, out_pt); });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(VarKernel, NativeVarKernel);
+
+class NativeMeanVarKernel : public MeanVarKernel {
+public:
+    void Call(const Array& a, const Axes& axis, const Array& mean, const Array& var) override {
+        CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, var.shape(), true));
+        CHAINERX_ASSERT(mean.dtype() == var.dtype());
+        CHAINERX_ASSERT(GetKind(var.dtype()) == DtypeKind::kFloat);
+        a.device().CheckDevicesCompatible(a, mean, var);
+
+        auto do_mean_var = [&a, &axis, &mean, &var](auto in_pt, auto out_pt) {
+            using In = typename decltype(in_pt)::type;
+            using Out = typename decltype(out_pt)::type;
+            using Accum = MeanVarAccumType<Out>;
+            struct Impl : MeanVarImpl<In, Accum> {
+                void MapOut(MeanVarAccum<Accum> accum, Out& mean, Out& var) {
+                    mean = static_cast<Out>(accum.mean);
+                    var = static_cast<Out>(accum.m2 / static_cast<Accum>(accum.count));
+                }
+            };
+            Reduce<In, Out>(a, axis, mean, var, Impl{});
+        };
+
+        VisitFloatingPointDtype(
+                var.dtype(), [a_dtype = a.dtype(), &do_mean_var](auto out_pt) { VisitDtype(a_dtype, do_mean_var, out_pt); });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(MeanVarKernel, NativeMeanVarKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
@@ -1,16 +1,44 @@
 #include "chainerx/native/native_device.h"
 
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
 
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/bfloat16.h"
 #include "chainerx/context.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/float16.h"
+#include "chainerx/kernels/creation.h"
+#include "chainerx/memory_format.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/numa.h"
+#include "chainerx/native/stream.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/normalization.h"
+#include "chainerx/routines/pooling.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/context_session.h"
 #include "chainerx/testing/threading.h"
+#include "chainerx/util.h"
 
 namespace chainerx {
 namespace native {
@@ -98,6 +126,37 @@ TEST(NativeDeviceTest, FromHostMemory) {
     EXPECT_EQ(src.get(), dst.get());
 }
 
+TEST(NativeDeviceTest, NumaNode) {
+    Context ctx;
+    const std::vector<NumaNode>& nodes = GetNumaNodes();
+    ASSERT_LE(nodes.size(), static_cast<size_t>(ctx.GetNativeBackend().GetDeviceCount()));
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        NativeDevice& device = GetNativeDevice(ctx, static_cast<int>(i));
+        EXPECT_EQ(i, device.numa_node_index());
+        EXPECT_EQ(nodes[i].id, device.numa_node().id);
+    }
+}
+
+TEST(NativeDeviceTest, TransferBetweenNumaNodes) {
+    Context ctx;
+    NativeDevice& device0 = GetNativeDevice(ctx, 0);
+    // On a multi-node host, device 1 is on a different node from device 0.
+    NativeDevice& device1 = GetNativeDevice(ctx, 1);
+
+    // Large enough to be allocated on whole pages.
+    constexpr size_t kCount = 1 << 16;
+    std::shared_ptr<void> src = device0.Allocate(kCount * sizeof(int32_t));
+    auto src_raw = static_cast<int32_t*>(src.get());
+    for (size_t i = 0; i < kCount; ++i) {
+        src_raw[i] = static_cast<int32_t>(i);
+    }
+    std::shared_ptr<void> dst = device1.TransferDataFrom(device0, src, sizeof(int32_t), (kCount - 1) * sizeof(int32_t));
+    auto dst_raw = static_cast<const int32_t*>(dst.get());
+    for (size_t i = 0; i < kCount - 1; ++i) {
+        ASSERT_EQ(static_cast<int32_t>(i + 1), dst_raw[i]);
+    }
+}
+
 TEST(NativeDeviceTest, Synchronize) {
     Context ctx;
     NativeDevice& device = GetNativeDevice(ctx, 0);
@@ -147,6 +206,233 @@ TEST(NativeDeviceTest, GetContextMultiThread) {
     });
 }
 
+TEST(NativeDeviceTest, BatchCopy) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    // Contiguous, padded, transposed, casted and empty arrays.
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array b = testing::BuildArray({4, 5}).WithLinearData<float>().WithPadding(1);
+    Array c = static_cast<Array>(testing::BuildArray({3, 2}).WithLinearData<float>()).Transpose();
+    Array d = testing::BuildArray({2, 3}).WithLinearData<int32_t>();
+    Array e = testing::BuildArray({0, 3}).WithData<float>({});
+    std::vector<Array> srcs{a, b, c, d, e};
+
+    std::vector<Array> outs;
+    for (const Array& src : srcs) {
+        outs.emplace_back(Empty(src.shape(), Dtype::kFloat32, device));
+    }
+    device.backend().CallKernel<BatchCopyKernel>(srcs, outs);
+
+    for (size_t i = 0; i < srcs.size(); ++i) {
+        EXPECT_ARRAY_EQ(srcs[i].AsType(Dtype::kFloat32), outs[i]);
+    }
+}
+
+TEST(NativeDeviceTest, CopyTransposed) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    // The extents are not multiples of the tile size nor of the vector widths.
+    std::vector<std::pair<Shape, Axes>> cases{
+            {{37, 45}, {1, 0}}, {{5, 37, 6}, {2, 0, 1}}, {{5, 37, 6}, {1, 2, 0}}, {{3, 2, 33, 4}, {0, 2, 1, 3}}, {{1, 3, 70}, {2, 0, 1}}};
+    for (Dtype dtype : {Dtype::kInt8, Dtype::kInt16, Dtype::kFloat32, Dtype::kFloat64}) {
+        for (const std::pair<Shape, Axes>& c : cases) {
+            Array a = Arange(c.first.GetTotalSize(), Dtype::kInt64, device).AsType(dtype).Reshape(c.first);
+
+            // Transposed source.
+            Array a_t = a.Transpose(c.second);
+            Array out = Empty(a_t.shape(), dtype, device);
+            device.backend().CallKernel<CopyKernel>(a_t, out);
+            EXPECT_ARRAY_EQ(a_t, out);
+
+            // Transposed destination.
+            Axes inverse{};
+            inverse.resize(c.second.size());
+            for (size_t i = 0; i < c.second.size(); ++i) {
+                inverse[c.second[i]] = static_cast<int8_t>(i);
+            }
+            Array out_t = Empty(a_t.shape(), dtype, device).Transpose(inverse);
+            device.backend().CallKernel<CopyKernel>(a, out_t);
+            EXPECT_ARRAY_EQ(a, out_t);
+        }
+    }
+}
+
+TEST(NativeDeviceTest, CopyFloat16) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    // The length of the rows is not a multiple of the vector width.
+    Shape shape{3, 37};
+    std::vector<float> float_values;
+    std::vector<Float16> half_values;
+    for (int64_t i = 0; i < shape.GetTotalSize(); ++i) {
+        float_values.emplace_back(static_cast<float>(i) / 7 - 2);
+        half_values.emplace_back(Float16{float_values.back()});
+    }
+    std::vector<float> rounded_values;
+    for (Float16 value : half_values) {
+        rounded_values.emplace_back(static_cast<float>(value));
+    }
+
+    // Contiguous and padded arrays.
+    for (int64_t padding : {0, 1}) {
+        Array a = testing::BuildArray(shape).WithData<float>(float_values).WithPadding(padding);
+        Array h = testing::BuildArray(shape).WithData<Float16>(half_values).WithPadding(padding);
+
+        Array a_to_h = Empty(shape, Dtype::kFloat16, device);
+        device.backend().CallKernel<CopyKernel>(a, a_to_h);
+        EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<Float16>(half_values), a_to_h);
+
+        Array h_to_a = Empty(shape, Dtype::kFloat32, device);
+        device.backend().CallKernel<CopyKernel>(h, h_to_a);
+        EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<float>(rounded_values), h_to_a);
+    }
+}
+
+TEST(NativeDeviceTest, ElementwiseFloat16) {
+    testing::ContextSession context_session;
+
+    // Spans more than one block of the float32 conversion.
+    Shape shape{3, 111};
+    std::vector<Float16> x1_values;
+    std::vector<Float16> x2_values;
+    for (int64_t i = 0; i < shape.GetTotalSize(); ++i) {
+        x1_values.emplace_back(Float16{static_cast<float>(i) / 7 - 2});
+        x2_values.emplace_back(Float16{static_cast<float>(i % 13) / 3});
+    }
+    std::vector<Float16> multiply_values;
+    std::vector<Float16> exp_values;
+    for (int64_t i = 0; i < shape.GetTotalSize(); ++i) {
+        int64_t transposed = i % shape[1] * shape[0] + i / shape[1];
+        multiply_values.emplace_back(Float16{static_cast<float>(x1_values[i]) * static_cast<float>(x2_values[transposed])});
+        exp_values.emplace_back(Float16{std::exp(static_cast<float>(x1_values[i]))});
+    }
+
+    // Padded and transposed arrays.
+    Array x1 = testing::BuildArray(shape).WithData<Float16>(x1_values).WithPadding(1);
+    Array x2 = testing::BuildArray({shape[1], shape[0]}).WithData<Float16>(x2_values);
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<Float16>(multiply_values), Multiply(x1, x2.Transpose()));
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<Float16>(exp_values), Exp(x1));
+}
+
+TEST(NativeDeviceTest, CopyBFloat16) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    Shape shape{3, 37};
+    std::vector<float> float_values;
+    std::vector<BFloat16> bfloat_values;
+    for (int64_t i = 0; i < shape.GetTotalSize(); ++i) {
+        float_values.emplace_back(static_cast<float>(i) / 7 - 2);
+        bfloat_values.emplace_back(BFloat16{float_values.back()});
+    }
+    std::vector<float> rounded_values;
+    for (BFloat16 value : bfloat_values) {
+        rounded_values.emplace_back(static_cast<float>(value));
+    }
+
+    for (int64_t padding : {0, 1}) {
+        Array a = testing::BuildArray(shape).WithData<float>(float_values).WithPadding(padding);
+        Array h = testing::BuildArray(shape).WithData<BFloat16>(bfloat_values).WithPadding(padding);
+
+        Array a_to_h = Empty(shape, Dtype::kBFloat16, device);
+        device.backend().CallKernel<CopyKernel>(a, a_to_h);
+        EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<BFloat16>(bfloat_values), a_to_h);
+
+        Array h_to_a = Empty(shape, Dtype::kFloat32, device);
+        device.backend().CallKernel<CopyKernel>(h, h_to_a);
+        EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<float>(rounded_values), h_to_a);
+    }
+}
+
+TEST(NativeDeviceTest, BFloat16AccumulatesInFloat32) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    // Accumulating in bfloat16 would stop at 256, where adding one is below the precision.
+    Array a = Ones({1024}, Dtype::kBFloat16, device);
+    EXPECT_ARRAY_EQ(testing::BuildArray({}).WithData<BFloat16>({BFloat16{1024.0f}}), Sum(a));
+    EXPECT_ARRAY_EQ(testing::BuildArray({1, 1}).WithData<BFloat16>({BFloat16{1024.0f}}), Dot(a.Reshape({1, 1024}), a.Reshape({1024, 1})));
+}
+
+TEST(NativeDeviceTest, ChannelsLastMemoryFormat) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    Shape x_shape{2, 3, 7, 6};
+    Array x = Arange(x_shape.GetTotalSize(), Dtype::kFloat32, device).Reshape(x_shape) / Scalar{10.0f};
+    Array x_nhwc = AsMemoryFormat(x, MemoryFormat::kChannelsLast);
+    ASSERT_EQ(MemoryFormat::kChannelsLast, GetMemoryFormat(x_nhwc));  // test precondition
+
+    // Channels-last inputs give the same values in the channels-last format.
+    auto check = [](const Array& expected, const Array& actual) {
+        EXPECT_EQ(MemoryFormat::kChannelsLast, GetMemoryFormat(actual));
+        EXPECT_ARRAY_ALL_CLOSE(expected, actual, 1e-5, 1e-5);
+    };
+
+    Array w = Arange(5 * 3 * 3 * 2, Dtype::kFloat32, device).Reshape({5, 3, 3, 2}) / Scalar{50.0f};
+    Array b = Arange(5, Dtype::kFloat32, device);
+    check(Conv(x, w, b, {2, 1}, {1, 0}), Conv(x_nhwc, w, b, {2, 1}, {1, 0}));
+    check(MaxPool(x, {3, 2}, {2, 2}, {1, 0}), MaxPool(x_nhwc, {3, 2}, {2, 2}, {1, 0}));
+    check(AveragePool(x, {2, 3}, {1, 2}, {1, 1}, AveragePoolPadMode::kZero),
+          AveragePool(x_nhwc, {2, 3}, {1, 2}, {1, 1}, AveragePoolPadMode::kZero));
+    check(AveragePool(x, {2, 3}, {1, 2}, {1, 1}), AveragePool(x_nhwc, {2, 3}, {1, 2}, {1, 1}));
+
+    Array gamma = Arange(3, Dtype::kFloat32, device) + Scalar{1.0f};
+    Array beta = Arange(3, Dtype::kFloat32, device);
+    Array mean = Full({3}, 0.5f, device);
+    Array var = Full({3}, 2.0f, device);
+    check(FixedBatchNorm(x, gamma, beta, mean, var, 2e-5, Axes{0, 2, 3}),
+          FixedBatchNorm(x_nhwc, gamma, beta, mean, var, 2e-5, Axes{0, 2, 3}));
+}
+
+TEST(NativeDeviceTest, AsyncExecution) {
+    testing::ContextSession context_session;
+    NativeDevice& device = GetNativeDevice(context_session.context(), 0);
+    device.SetAsync(true);
+    ASSERT_TRUE(device.is_async());
+
+    // Kernels are executed in the order they are called and the results are synchronized before being read.
+    Array a = Arange(12, Dtype::kFloat32, device).Reshape({3, 4});
+    Array b = a * a + a;
+    for (int i = 0; i < 10; ++i) {
+        b = b - a;
+    }
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 4}).WithLinearData<float>(0.f), a);
+    EXPECT_ARRAY_EQ(a * a - Scalar{9} * a, b);
+    EXPECT_EQ(66.f, static_cast<float>(AsScalar(Sum(a))));
+    EXPECT_ARRAY_EQ(
+            testing::BuildArray({3, 3}).WithData<float>({14.f, 38.f, 62.f, 38.f, 126.f, 214.f, 62.f, 214.f, 366.f}), Dot(a, a.Transpose()));
+
+    // Disabling the asynchronous execution finishes the pending kernels.
+    b = a + a;
+    device.SetAsync(false);
+    EXPECT_FALSE(device.is_async());
+    EXPECT_ARRAY_EQ(a * Scalar{2}, b);
+}
+
+TEST(NativeDeviceTest, AsyncEnvVar) {
+    nonstd::optional<std::string> original = GetEnv(kNativeAsyncEnvVarName);
+    auto is_async_with_env = [](const std::string& value) {
+        SetEnv(kNativeAsyncEnvVarName, value);
+        testing::ContextSession context_session;
+        return GetNativeDevice(context_session.context(), 0).is_async();
+    };
+    EXPECT_TRUE(is_async_with_env("1"));
+    EXPECT_FALSE(is_async_with_env("0"));
+    EXPECT_THROW(is_async_with_env("yes"), ChainerxError);
+    EXPECT_THROW(is_async_with_env("1x"), ChainerxError);
+    EXPECT_THROW(is_async_with_env(""), ChainerxError);
+
+    if (original.has_value()) {
+        SetEnv(kNativeAsyncEnvVarName, *original);
+    } else {
+        UnsetEnv(kNativeAsyncEnvVarName);
+    }
+}
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
@@ -0,0 +1,173 @@
+#include "chainerx/native/numa.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // __linux__
+
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+thread_local size_t t_numa_node_index = 0;
+
+#ifdef __linux__
+
+constexpr const char* kNodeSysfsDir = "/sys/devices/system/node/";
+
+// Memory policy mode and flag of mbind(2), defined in <numaif.h> of libnuma which is not necessarily available.
+constexpr int kMpolPreferred = 1;
+constexpr unsigned kMpolMfMove = 1U << 1;
+
+bool ReadLine(const std::string& path, std::string& line) {
+    std::ifstream ifs{path};
+    return static_cast<bool>(std::getline(ifs, line));
+}
+
+std::vector<NumaNode> LoadNumaNodes() {
+    std::string line{};
+    if (!ReadLine(std::string{kNodeSysfsDir} + "online", line)) {
+        return {};
+    }
+    std::vector<NumaNode> nodes{};
+    try {
+        for (int id : native_internal::ParseCpuList(line)) {
+            std::string cpu_list{};
+            if (!ReadLine(std::string{kNodeSysfsDir} + "node" + std::to_string(id) + "/cpulist", cpu_list)) {
+                return {};
+            }
+            nodes.emplace_back(NumaNode{id, native_internal::ParseCpuList(cpu_list)});
+        }
+    } catch (const ChainerxError&) {
+        return {};
+    }
+    return nodes;
+}
+
+#else  // __linux__
+
+std::vector<NumaNode> LoadNumaNodes() { return {}; }
+
+#endif  // __linux__
+
+}  // namespace
+
+const std::vector<NumaNode>& GetNumaNodes() {
+    static const std::vector<NumaNode> nodes = []() {
+        std::vector<NumaNode> loaded = LoadNumaNodes();
+        if (loaded.empty()) {
+            loaded.emplace_back(NumaNode{0, {}});
+        }
+        return loaded;
+    }();
+    return nodes;
+}
+
+void BindMemoryToNumaNode(void* ptr, size_t bytesize, const NumaNode& node) {
+#ifdef __linux__
+    constexpr size_t kBitsPerMask = sizeof(unsigned long) * 8;  // NOLINT(google-runtime-int)
+    std::vector<unsigned long> mask(node.id / kBitsPerMask + 1);  // NOLINT(google-runtime-int)
+    mask[node.id / kBitsPerMask] |= 1UL << (node.id % kBitsPerMask);
+    // The binding is an optimization; failures (e.g. in a restricted container) are ignored.
+    syscall(SYS_mbind, ptr, bytesize, kMpolPreferred, mask.data(), mask.size() * kBitsPerMask + 1, kMpolMfMove);
+#else  // __linux__
+    (void)ptr;  // unused
+    (void)bytesize;  // unused
+    (void)node;  // unused
+#endif  // __linux__
+}
+
+std::shared_ptr<void> AllocateOnNumaNode(size_t bytesize, const NumaNode& node) {
+#ifdef __linux__
+    // Pages from mmap are untouched, unlike those reused by malloc, so the binding decides where they are placed.
+    void* ptr = mmap(nullptr, bytesize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        throw std::bad_alloc{};
+    }
+    BindMemoryToNumaNode(ptr, bytesize, node);
+    return std::shared_ptr<void>{ptr, [bytesize](void* p) { munmap(p, bytesize); }};
+#else  // __linux__
+    (void)node;  // unused
+    return std::shared_ptr<uint8_t>{new uint8_t[bytesize], std::default_delete<uint8_t[]>()};
+#endif  // __linux__
+}
+
+void PinCurrentThreadToNumaNode(const NumaNode& node) {
+#ifdef __linux__
+    if (node.cpus.empty()) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : node.cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#else  // __linux__
+    (void)node;  // unused
+#endif  // __linux__
+}
+
+size_t GetCurrentNumaNodeIndex() { return t_numa_node_index; }
+
+NumaNodeScope::NumaNodeScope(size_t node_index) : prev_node_index_{t_numa_node_index} {
+    CHAINERX_ASSERT(node_index < GetNumaNodes().size());
+    t_numa_node_index = node_index;
+}
+
+NumaNodeScope::~NumaNodeScope() { t_numa_node_index = prev_node_index_; }
+
+namespace native_internal {
+
+std::vector<int> ParseCpuList(const std::string& cpu_list) {
+    std::vector<int> cpus{};
+    size_t pos = 0;
+    auto parse_int = [&cpu_list, &pos]() {
+        size_t begin = pos;
+        while (pos < cpu_list.size() && cpu_list[pos] >= '0' && cpu_list[pos] <= '9') {
+            ++pos;
+        }
+        if (pos == begin) {
+            throw ChainerxError{"Invalid CPU list: '", cpu_list, "'"};
+        }
+        return std::stoi(cpu_list.substr(begin, pos - begin));
+    };
+    while (pos < cpu_list.size() && cpu_list[pos] != '\n') {
+        int first = parse_int();
+        int last = first;
+        if (pos < cpu_list.size() && cpu_list[pos] == '-') {
+            ++pos;
+            last = parse_int();
+            if (last < first) {
+                throw ChainerxError{"Invalid CPU list: '", cpu_list, "'"};
+            }
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.emplace_back(cpu);
+        }
+        if (pos < cpu_list.size() && cpu_list[pos] == ',') {
+            ++pos;
+        }
+    }
+    return cpus;
+}
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace chainerx {
+namespace native {
+
+// A NUMA node of the host and the CPUs attached to it.
+struct NumaNode {
+    int id;
+    std::vector<int> cpus;
+};
+
+// Returns the NUMA nodes of the host, in ascending order of their IDs.
+// If the topology is not available, e.g. on non-Linux platforms, a single node with no CPUs listed is returned, which means any CPU.
+const std::vector<NumaNode>& GetNumaNodes();
+
+// Prefers the given NUMA node for the pages in the range [ptr, ptr + bytesize), which must be page-aligned.
+// Untouched pages are placed on the node when they are first touched, and touched pages are moved to the node if possible.
+// The policy stays with the pages until they are unmapped. It does nothing if the binding is not supported.
+void BindMemoryToNumaNode(void* ptr, size_t bytesize, const NumaNode& node);
+
+// Allocates a buffer on pages of its own, which are bound to the given NUMA node and unmapped when the buffer is released.
+// Since every call maps new pages, it is meant for large buffers. Falls back to the ordinary allocation on non-Linux platforms.
+std::shared_ptr<void> AllocateOnNumaNode(size_t bytesize, const NumaNode& node);
+
+// Restricts the current thread to the CPUs of the given NUMA node.
+// It does nothing if the node has no CPUs listed or the affinity is not supported.
+void PinCurrentThreadToNumaNode(const NumaNode& node);
+
+// Returns the index in GetNumaNodes() of the node whose thread pool is used by ParallelFor in the current thread.
+size_t GetCurrentNumaNodeIndex();
+
+// Makes ParallelFor use the thread pool of the given node within the scope.
+class NumaNodeScope {
+public:
+    explicit NumaNodeScope(size_t node_index);
+    ~NumaNodeScope();
+
+    NumaNodeScope(const NumaNodeScope&) = delete;
+    NumaNodeScope(NumaNodeScope&&) = delete;
+    NumaNodeScope& operator=(const NumaNodeScope&) = delete;
+    NumaNodeScope& operator=(NumaNodeScope&&) = delete;
+
+private:
+    size_t prev_node_index_;
+};
+
+namespace native_internal {
+
+// Parses a CPU list in the format of Linux sysfs, e.g. "0-3,8,10-11".
+std::vector<int> ParseCpuList(const std::string& cpu_list);
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
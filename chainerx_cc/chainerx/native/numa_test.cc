@@ -0,0 +1,80 @@
+#include "chainerx/native/numa.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/error.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+TEST(NumaTest, ParseCpuList) {
+    EXPECT_EQ((std::vector<int>{0}), native_internal::ParseCpuList("0"));
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), native_internal::ParseCpuList("0-3\n"));
+    EXPECT_EQ((std::vector<int>{0, 1, 4, 8, 9, 10}), native_internal::ParseCpuList("0-1,4,8-10"));
+    EXPECT_EQ((std::vector<int>{}), native_internal::ParseCpuList(""));
+    EXPECT_EQ((std::vector<int>{}), native_internal::ParseCpuList("\n"));
+}
+
+TEST(NumaTest, ParseCpuListInvalid) {
+    EXPECT_THROW(native_internal::ParseCpuList("a"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseCpuList("1-"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseCpuList("3-1"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseCpuList("1,,2"), ChainerxError);
+}
+
+TEST(NumaTest, GetNumaNodes) {
+    const std::vector<NumaNode>& nodes = GetNumaNodes();
+    ASSERT_FALSE(nodes.empty());
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        EXPECT_LT(nodes[i - 1].id, nodes[i].id);
+    }
+}
+
+TEST(NumaTest, NumaNodeScope) {
+    size_t last = GetNumaNodes().size() - 1;
+    EXPECT_EQ(size_t{0}, GetCurrentNumaNodeIndex());
+    {
+        NumaNodeScope scope1{last};
+        EXPECT_EQ(last, GetCurrentNumaNodeIndex());
+        {
+            NumaNodeScope scope2{0};
+            EXPECT_EQ(size_t{0}, GetCurrentNumaNodeIndex());
+        }
+        EXPECT_EQ(last, GetCurrentNumaNodeIndex());
+    }
+    EXPECT_EQ(size_t{0}, GetCurrentNumaNodeIndex());
+}
+
+TEST(NumaTest, BindMemoryToNumaNode) {
+    constexpr size_t kPageSize = 4096;
+    constexpr size_t kBytesize = kPageSize * 4;
+    void* ptr{};
+    ASSERT_EQ(0, posix_memalign(&ptr, kPageSize, kBytesize));
+    BindMemoryToNumaNode(ptr, kBytesize, GetNumaNodes().back());
+    // The memory is usable regardless of whether the binding succeeded.
+    std::vector<char> expected(kBytesize, 1);
+    std::fill_n(static_cast<char*>(ptr), kBytesize, 1);
+    EXPECT_EQ(0, std::memcmp(expected.data(), ptr, kBytesize));
+    std::free(ptr);
+}
+
+TEST(NumaTest, AllocateOnNumaNode) {
+    constexpr size_t kBytesize = 4096 * 4 + 1;
+    std::shared_ptr<void> ptr = AllocateOnNumaNode(kBytesize, GetNumaNodes().back());
+    ASSERT_NE(nullptr, ptr);
+    std::vector<char> expected(kBytesize, 1);
+    std::fill_n(static_cast<char*>(ptr.get()), kBytesize, 1);
+    EXPECT_EQ(0, std::memcmp(expected.data(), ptr.get(), kBytesize));
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,255 @@
+#include "chainerx/native/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/numa.h"
+#include "chainerx/util.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+// Set while the current thread is running a chunk of ParallelFor.
+thread_local bool t_in_parallel_region = false;
+
+// A set of chunks to be processed by the thread pool.
+class Job {
+public:
+    Job(int64_t n, int64_t chunk_size, const std::function<void(int64_t, int64_t)>& func)
+        : n_{n}, chunk_size_{chunk_size}, chunk_count_{(n + chunk_size - 1) / chunk_size}, func_{func} {}
+
+    // Processes chunks until none are left.
+    void Process() {
+        t_in_parallel_region = true;
+        int64_t chunk;
+        while ((chunk = next_chunk_++) < chunk_count_) {
+            int64_t begin = chunk * chunk_size_;
+            int64_t end = std::min(begin + chunk_size_, n_);
+            try {
+                func_(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (error_ == nullptr) {
+                    error_ = std::current_exception();
+                }
+            }
+            if (++done_chunk_count_ == chunk_count_) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                done_cv_.notify_all();
+            }
+        }
+        t_in_parallel_region = false;
+    }
+
+    // Waits for all the chunks to be processed and rethrows an exception, if any.
+    void Wait() {
+        std::unique_lock<std::mutex> lock{mutex_};
+        done_cv_.wait(lock, [this]() { return done_chunk_count_ == chunk_count_; });
+        if (error_ != nullptr) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    const int64_t n_;
+    const int64_t chunk_size_;
+    const int64_t chunk_count_;
+    const std::function<void(int64_t, int64_t)>& func_;
+
+    std::atomic<int64_t> next_chunk_{0};
+    std::atomic<int64_t> done_chunk_count_{0};
+
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+    std::exception_ptr error_;
+};
+
+class ThreadPool {
+public:
+    // If pinned_node is given, the workers run only on the CPUs of the node.
+    // The calling thread, which may run on any node, then only waits for the workers.
+    // Otherwise it also works, so one less worker is needed.
+    ThreadPool(size_t thread_count, const NumaNode* pinned_node) : caller_works_{pinned_node == nullptr} {
+        for (size_t i = caller_works_ ? 1 : 0; i < thread_count; ++i) {
+            workers_.emplace_back([this, pinned_node]() {
+                if (pinned_node != nullptr) {
+                    PinCurrentThreadToNumaNode(*pinned_node);
+                }
+                WorkerLoop();
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    size_t thread_count() const { return workers_.size() + (caller_works_ ? 1 : 0); }
+
+    // Runs the job in the workers, and in the calling thread unless the workers are pinned.
+    // Returns false without running the job if the pool is busy with another job.
+    bool TryRun(const std::shared_ptr<Job>& job) {
+        std::unique_lock<std::mutex> run_lock{run_mutex_, std::try_to_lock};
+        if (!run_lock.owns_lock()) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            job_ = job;
+            ++generation_;
+        }
+        cv_.notify_all();
+
+        if (caller_works_) {
+            job->Process();
+        }
+        job->Wait();
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            job_.reset();
+        }
+        return true;
+    }
+
+private:
+    void WorkerLoop() {
+        uint64_t generation = 0;
+        std::unique_lock<std::mutex> lock{mutex_};
+        while (true) {
+            cv_.wait(lock, [this, generation]() { return stop_ || generation_ != generation; });
+            if (stop_) {
+                return;
+            }
+            generation = generation_;
+            std::shared_ptr<Job> job = job_;
+            if (job == nullptr) {
+                continue;
+            }
+            lock.unlock();
+            job->Process();
+            lock.lock();
+        }
+    }
+
+    const bool caller_works_;
+
+    std::vector<std::thread> workers_;
+
+    // Serializes jobs.
+    std::mutex run_mutex_;
+
+    // Guards the members below.
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::shared_ptr<Job> job_;
+    uint64_t generation_{0};
+    bool stop_{false};
+};
+
+size_t GetThreadCount(const NumaNode& node, bool multi_node) {
+    if (nonstd::optional<std::string> env = GetEnv(kNativeThreadCountEnvVarName)) {
+        return native_internal::ParseThreadCount(*env);
+    }
+    if (multi_node && !node.cpus.empty()) {
+        return node.cpus.size();
+    }
+    return std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+}
+
+// Returns the thread pool of the NUMA node of the current thread.
+// Each node has its own pool, created on first use. On a single-node host, the workers are not pinned.
+ThreadPool& GetThreadPool() {
+    const std::vector<NumaNode>& nodes = GetNumaNodes();
+    static std::vector<std::once_flag> once_flags(nodes.size());
+    static std::vector<std::unique_ptr<ThreadPool>> thread_pools(nodes.size());
+
+    size_t node_index = GetCurrentNumaNodeIndex();
+    std::call_once(once_flags[node_index], [&nodes, node_index]() {
+        const NumaNode& node = nodes[node_index];
+        bool multi_node = nodes.size() > 1;
+        thread_pools[node_index] = std::make_unique<ThreadPool>(GetThreadCount(node, multi_node), multi_node ? &node : nullptr);
+    });
+    return *thread_pools[node_index];
+}
+
+}  // namespace
+
+namespace native_internal {
+
+size_t ParseThreadCount(const std::string& value) {
+    size_t pos = 0;
+    int64_t thread_count = 0;
+    try {
+        // Parsed as signed, as std::stoul accepts negative values and wraps them around.
+        thread_count = std::stoll(value, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (pos == 0 || pos != value.size()) {
+        throw ChainerxError{kNativeThreadCountEnvVarName, " must be an integer: ", value};
+    }
+    if (thread_count <= 0) {
+        throw ChainerxError{kNativeThreadCountEnvVarName, " must be positive: ", value};
+    }
+    return static_cast<size_t>(thread_count);
+}
+
+}  // namespace native_internal
+
+size_t GetParallelThreadCount() { return GetThreadPool().thread_count(); }
+
+void ParallelFor(int64_t n, int64_t grain_size, const std::function<void(int64_t, int64_t)>& func) {
+    CHAINERX_ASSERT(grain_size > 0);
+    if (n <= 0) {
+        return;
+    }
+    if (n <= grain_size || t_in_parallel_region) {
+        func(0, n);
+        return;
+    }
+
+    ThreadPool& thread_pool = GetThreadPool();
+    int64_t thread_count = static_cast<int64_t>(thread_pool.thread_count());
+    if (thread_count == 1) {
+        func(0, n);
+        return;
+    }
+
+    // A few chunks per thread for load balancing.
+    int64_t chunk_size = std::max(grain_size, (n + thread_count * 4 - 1) / (thread_count * 4));
+    auto job = std::make_shared<Job>(n, chunk_size, func);
+    if (!thread_pool.TryRun(job)) {
+        func(0, n);
+    }
+}
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace chainerx {
+namespace native {
+
+// Name of the environment variable to specify the number of threads used by parallel native kernels.
+// If unset, the number of hardware threads is used, or the number of CPUs of each NUMA node on a multi-node host.
+constexpr const char* kNativeThreadCountEnvVarName = "CHAINERX_NATIVE_NUM_THREADS";
+
+// Returns the number of threads that process the chunks of ParallelFor in the current thread, including the calling thread if it works.
+size_t GetParallelThreadCount();
+
+// Splits the range [0, n) into chunks of at least grain_size iterations and calls func(begin, end) for each chunk in parallel.
+// It returns after all the chunks are processed.
+//
+// The calling thread also processes chunks, except on a multi-node host where only the workers pinned to the NUMA node do, since the
+// calling thread may run on another node.
+// The whole range is processed in the calling thread if it is not worth splitting, if another ParallelFor is running concurrently, or if
+// called from within func (i.e. nested calls are serialized).
+// If func throws, one of the exceptions is rethrown after all the chunks are processed.
+// The chunks are processed by the thread pool of the NUMA node selected by NumaNodeScope, which is set by native kernels to the node of
+// their device.
+void ParallelFor(int64_t n, int64_t grain_size, const std::function<void(int64_t, int64_t)>& func);
+
+namespace native_internal {
+
+// Parses the value of kNativeThreadCountEnvVarName, which must be a positive integer.
+size_t ParseThreadCount(const std::string& value);
+
+}  // namespace native_internal
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,83 @@
+#include "chainerx/native/parallel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/error.h"
+#include "chainerx/testing/threading.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+TEST(ParallelTest, GetParallelThreadCount) { EXPECT_LE(size_t{1}, GetParallelThreadCount()); }
+
+TEST(ParallelTest, ParseThreadCount) {
+    EXPECT_EQ(size_t{1}, native_internal::ParseThreadCount("1"));
+    EXPECT_EQ(size_t{16}, native_internal::ParseThreadCount("16"));
+    EXPECT_THROW(native_internal::ParseThreadCount("0"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseThreadCount("-1"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseThreadCount("abc"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseThreadCount("4x"), ChainerxError);
+    EXPECT_THROW(native_internal::ParseThreadCount(""), ChainerxError);
+    EXPECT_THROW(native_internal::ParseThreadCount("99999999999999999999"), ChainerxError);
+}
+
+TEST(ParallelTest, ParallelFor) {
+    for (int64_t n : {0, 1, 7, 1000, 12345}) {
+        for (int64_t grain_size : {1, 10, 100000}) {
+            std::vector<std::atomic<int>> counts(n);
+            ParallelFor(n, grain_size, [&counts, grain_size, n](int64_t begin, int64_t end) {
+                EXPECT_LE(0, begin);
+                EXPECT_LT(begin, end);
+                EXPECT_LE(end, n);
+                EXPECT_TRUE(end - begin >= grain_size || end == n);
+                for (int64_t i = begin; i < end; ++i) {
+                    ++counts[i];
+                }
+            });
+            for (int64_t i = 0; i < n; ++i) {
+                EXPECT_EQ(1, counts[i]) << "n: " << n << ", grain_size: " << grain_size << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST(ParallelTest, ParallelForNested) {
+    std::atomic<int64_t> sum{0};
+    ParallelFor(10, 1, [&sum](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            ParallelFor(10, 1, [&sum](int64_t begin2, int64_t end2) { sum += end2 - begin2; });
+        }
+    });
+    EXPECT_EQ(100, sum);
+}
+
+TEST(ParallelTest, ParallelForException) {
+    EXPECT_THROW(
+            ParallelFor(
+                    100,
+                    1,
+                    [](int64_t begin, int64_t /*end*/) {
+                        if (begin == 0) {
+                            throw std::runtime_error{"error"};
+                        }
+                    }),
+            std::runtime_error);
+}
+
+TEST(ParallelTest, ParallelForThreadSafe) {
+    testing::RunThreads(4, [](size_t /*thread_index*/) {
+        std::atomic<int64_t> sum{0};
+        ParallelFor(1000, 10, [&sum](int64_t begin, int64_t end) { sum += end - begin; });
+        EXPECT_EQ(1000, sum);
+    });
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
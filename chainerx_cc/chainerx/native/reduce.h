@@ -95,87 +95,133 @@ void ReductionKernel(ReductionKernelArg<In, Out, InNdim, OutNdim> arg, Reduction
     }
 }
 
-}  // namespace reduce_detail
+template <typename In, typename Out, typename ReductionImpl, int8_t InNdim = kDynamicNdim, int8_t OutNdim = kDynamicNdim>
+void ReductionKernel(ReductionKernelArg<In, Out, InNdim, OutNdim> arg, IndexableArray<Out, OutNdim> out2, ReductionImpl&& impl) {
+    auto it_in = arg.in_indexer.It(0, arg.out_indexer.total_size());
+    int64_t reduce_len = arg.in_indexer.total_size() / arg.out_indexer.total_size();
 
-// Computes the reduction of the input and stores into the output array.
-//
-// `ReductionImpl` is required to provide the following member function.
-// T can be arbitrary but should be common between these functions.
-//
-// - T Identity();
-//       Returns the initial value of reduction.
-// - T MapIn(In in, int64_t index);
-//       Applies pre-reduction mapping of the input and its index.
-// - void Reduce(T next, T& accum);
-//       Accumulates the iterated value to accum.
-// - Out MapOut(T accum);
-//       Applies post-reduction mapping of the output.
-//
-// Example:
-//     Simple summation over a float array can be implemented as the following reduction impl.
-//
-//         struct SumImpl {
-//             float Identity() { return 0; }
-//             float MapIn(float in) { return in; }
-//             void Reduce(float next, float& accum) { accum += next; }
-//             float MapOut(float accum) { return accum; }
-//         };
-//
-//     Then, it can be passed to Reduce like: Reduce(input, axis, output, SumImpl{});
-template <typename In, typename Out, typename ReductionImpl>
-void Reduce(const Array& in, const Axes& axis, const Array& out, ReductionImpl&& impl) {
-    if (out.GetTotalSize() == 0) {
-        return;
+    // Iterate over output dimensions
+    for (auto it_out = arg.out_indexer.It(0); it_out; ++it_out) {
+        it_in.Restart(it_out.raw_index());
+        auto accum = PairwiseReduction<In, ReductionImpl, InNdim, decltype(impl.Identity())>(arg.in, it_in, impl, reduce_len);
+        Out value1{};
+        Out value2{};
+        impl.MapOut(accum, value1, value2);
+        arg.out[it_out] = native_internal::DataToStorageType<Out>(value1);
+        out2[it_out] = native_internal::DataToStorageType<Out>(value2);
     }
+}
 
-    ReductionArg arg{in, axis, out};
-
+// Calls func with the reduction kernel argument, whose indexers are statically optimized for the common numbers of dimensions.
+template <typename In, typename Out, typename Func>
+void DispatchReductionKernelArg(const ReductionArg& arg, Func&& func) {
     // TODO(sonots): Reconsider the number of statically-optimized kernels in terms of speed and binary size trade-offs.
     // Currently, we optimize for contiguous output arrays.
     switch (arg.in_shape().ndim()) {
         case 1:
             switch (arg.out_shape().ndim()) {
                 case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 1, 0>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 1, 0>(arg));
                     return;
                 case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 1, 1>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 1, 1>(arg));
                     return;
             }
             break;
         case 2:
             switch (arg.out_shape().ndim()) {
                 case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 2, 0>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 2, 0>(arg));
                     return;
                 case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 2, 1>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 2, 1>(arg));
                     return;
             }
             break;
         case 3:
             switch (arg.out_shape().ndim()) {
                 case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 3, 0>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 3, 0>(arg));
                     return;
                 case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 3, 1>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 3, 1>(arg));
                     return;
             }
             break;
         case 4:
             switch (arg.out_shape().ndim()) {
                 case 0:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 4, 0>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 4, 0>(arg));
                     return;
                 case 1:
-                    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out, 4, 1>(arg), impl);
+                    func(MakeReductionKernelArg<In, Out, 4, 1>(arg));
                     return;
             }
             break;
     }
 
-    reduce_detail::ReductionKernel(MakeReductionKernelArg<In, Out>(arg), impl);
+    func(MakeReductionKernelArg<In, Out>(arg));
+}
+
+}  // namespace reduce_detail
+
+// Computes the reduction of the input and stores into the output array.
+//
+// `ReductionImpl` is required to provide the following member function.
+// T can be arbitrary but should be common between these functions.
+//
+// - T Identity();
+//       Returns the initial value of reduction.
+// - T MapIn(In in, int64_t index);
+//       Applies pre-reduction mapping of the input and its index.
+// - void Reduce(T next, T& accum);
+//       Accumulates the iterated value to accum.
+// - Out MapOut(T accum);
+//       Applies post-reduction mapping of the output.
+//
+// Example:
+//     Simple summation over a float array can be implemented as the following reduction impl.
+//
+//         struct SumImpl {
+//             float Identity() { return 0; }
+//             float MapIn(float in) { return in; }
+//             void Reduce(float next, float& accum) { accum += next; }
+//             float MapOut(float accum) { return accum; }
+//         };
+//
+//     Then, it can be passed to Reduce like: Reduce(input, axis, output, SumImpl{});
+template <typename In, typename Out, typename ReductionImpl>
+void Reduce(const Array& in, const Axes& axis, const Array& out, ReductionImpl&& impl) {
+    if (out.GetTotalSize() == 0) {
+        return;
+    }
+
+    ReductionArg arg{in, axis, out};
+    reduce_detail::DispatchReductionKernelArg<In, Out>(arg, [&impl](auto kernel_arg) { reduce_detail::ReductionKernel(kernel_arg, impl); });
+}
+
+// Computes a reduction of the input that gives two outputs, e.g. the mean and the variance, and stores into the output arrays.
+// The output arrays must have the same shape and strides.
+//
+// `ReductionImpl` is required to provide Identity, MapIn and Reduce as in Reduce above, and the following member function instead of
+// MapOut.
+//
+// - void MapOut(T accum, Out& out1, Out& out2);
+//       Applies post-reduction mapping of the output.
+template <typename In, typename Out, typename ReductionImpl>
+void Reduce(const Array& in, const Axes& axis, const Array& out1, const Array& out2, ReductionImpl&& impl) {
+    CHAINERX_ASSERT(out1.shape() == out2.shape());
+    CHAINERX_ASSERT(out1.strides() == out2.strides());
+    if (out1.GetTotalSize() == 0) {
+        return;
+    }
+
+    // The permuted and squashed strides of the first output apply to the second one as well.
+    ReductionArg arg{in, axis, out1};
+    reduce_detail::DispatchReductionKernelArg<In, Out>(arg, [&impl, &out2, &arg](auto kernel_arg) {
+        decltype(kernel_arg.out) out2_iarray{out2, arg.out_strides()};
+        reduce_detail::ReductionKernel(kernel_arg, out2_iarray, impl);
+    });
 }
 
 }  // namespace native
@@ -0,0 +1,113 @@
+#include "chainerx/native/stream.h"
+
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "chainerx/backprop_mode.h"
+#include "chainerx/thread_local_state.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+thread_local bool t_in_kernel_execution = false;
+
+// The stream whose worker thread is the current thread, if any.
+thread_local const Stream* t_current_stream = nullptr;
+
+}  // namespace
+
+bool IsInKernelExecution() { return t_in_kernel_execution; }
+
+KernelExecutionScope::KernelExecutionScope() : prev_in_kernel_execution_{t_in_kernel_execution} { t_in_kernel_execution = true; }
+
+KernelExecutionScope::~KernelExecutionScope() { t_in_kernel_execution = prev_in_kernel_execution_; }
+
+Stream::Stream() : worker_{[this]() { WorkerLoop(); }} {}
+
+Stream::~Stream() {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    task_cv_.notify_all();
+    worker_.join();
+}
+
+void Stream::Enqueue(std::function<void()> task) {
+    const internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    std::vector<std::function<void()>> finished_tasks{};
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        tasks_.push_back(Task{std::move(task), state.default_context, state.default_device});
+        std::swap(finished_tasks, finished_tasks_);
+    }
+    task_cv_.notify_one();
+}
+
+void Stream::Synchronize() {
+    if (t_current_stream == this) {
+        return;
+    }
+    std::exception_ptr error{};
+    std::vector<std::function<void()>> finished_tasks{};
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        done_cv_.wait(lock, [this]() { return tasks_.empty() && !busy_; });
+        std::swap(error, error_);
+        std::swap(finished_tasks, finished_tasks_);
+    }
+    // Arrays bound to the tasks are released before returning.
+    finished_tasks.clear();
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+void Stream::WorkerLoop() {
+    t_current_stream = this;
+    KernelExecutionScope kernel_execution_scope{};
+    // Kernels never record graphs.
+    InferenceModeScope inference_mode_scope{};
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true) {
+        // Remaining tasks are processed before stopping.
+        task_cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            return;
+        }
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+        state.default_context = task.default_context;
+        state.default_device = task.default_device;
+        std::exception_ptr error{};
+        try {
+            task.func();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        // The task is destroyed by the caller of Enqueue or Synchronize, which may hold locks (e.g. the GIL) required to release what the
+        // task holds.
+        finished_tasks_.emplace_back(std::move(task.func));
+        if (error != nullptr && error_ == nullptr) {
+            error_ = error;
+        }
+        busy_ = false;
+        if (tasks_.empty()) {
+            done_cv_.notify_all();
+        }
+    }
+}
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+
+namespace chainerx {
+namespace native {
+
+// Name of the environment variable to enable the asynchronous execution of kernels on native devices.
+// If set to a nonzero value, native devices are created with the asynchronous execution enabled.
+constexpr const char* kNativeAsyncEnvVarName = "CHAINERX_NATIVE_ASYNC";
+
+// Returns true if the current thread is executing a native kernel, either in the worker thread of a stream or synchronously in the thread
+// that called the kernel. Kernels called from other kernels are executed immediately in the same thread.
+bool IsInKernelExecution();
+
+// Marks the current thread as executing a native kernel within the scope.
+class KernelExecutionScope {
+public:
+    KernelExecutionScope();
+    ~KernelExecutionScope();
+
+    KernelExecutionScope(const KernelExecutionScope&) = delete;
+    KernelExecutionScope(KernelExecutionScope&&) = delete;
+    KernelExecutionScope& operator=(const KernelExecutionScope&) = delete;
+    KernelExecutionScope& operator=(KernelExecutionScope&&) = delete;
+
+private:
+    bool prev_in_kernel_execution_;
+};
+
+// An in-order queue of tasks executed by a dedicated worker thread.
+//
+// Native devices use streams to execute kernels asynchronously with respect to the calling thread, similarly to CUDA streams.
+// Since the tasks are executed in the order they are enqueued, a kernel always observes the results of the kernels called before it.
+class Stream {
+public:
+    Stream();
+    ~Stream();
+
+    Stream(const Stream&) = delete;
+    Stream(Stream&&) = delete;
+    Stream& operator=(const Stream&) = delete;
+    Stream& operator=(Stream&&) = delete;
+
+    // Enqueues a task.
+    // The task is executed with the default context and device of the calling thread.
+    //
+    // Finished tasks are not destroyed by the worker thread but by the next call to Enqueue or Synchronize, so that what they hold (e.g.
+    // memory owned by Python objects, whose release requires the GIL held by the caller) is released in a thread that may block on it.
+    void Enqueue(std::function<void()> task);
+
+    // Blocks until all the enqueued tasks are finished.
+    // If any of the tasks has thrown since the last synchronization, the first exception is rethrown.
+    // It returns immediately if called from a task of this stream, for which all the preceding tasks are already finished. Called from
+    // anywhere else, including tasks of other streams and kernels executed synchronously, it waits.
+    void Synchronize();
+
+private:
+    struct Task {
+        std::function<void()> func;
+        Context* default_context;
+        Device* default_device;
+    };
+
+    void WorkerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Task> tasks_;
+    std::vector<std::function<void()>> finished_tasks_;
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_;
+
+    std::thread worker_;
+};
+
+}  // namespace native
+}  // namespace chainerx
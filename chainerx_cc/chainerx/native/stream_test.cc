@@ -0,0 +1,154 @@
+#include "chainerx/native/stream.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace native {
+namespace {
+
+TEST(StreamTest, Order) {
+    Stream stream{};
+    std::vector<int> values;
+    std::thread::id caller_id = std::this_thread::get_id();
+    for (int i = 0; i < 100; ++i) {
+        stream.Enqueue([&values, caller_id, i]() {
+            EXPECT_NE(caller_id, std::this_thread::get_id());
+            EXPECT_TRUE(IsInKernelExecution());
+            values.emplace_back(i);
+        });
+    }
+    stream.Synchronize();
+    ASSERT_EQ(100U, values.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i, values[i]);
+    }
+    EXPECT_FALSE(IsInKernelExecution());
+}
+
+TEST(StreamTest, SynchronizeInTask) {
+    Stream stream{};
+    int count = 0;
+    stream.Enqueue([&stream, &count]() {
+        // Must not wait for itself.
+        stream.Synchronize();
+        ++count;
+    });
+    stream.Synchronize();
+    EXPECT_EQ(1, count);
+}
+
+TEST(StreamTest, SynchronizeOtherStreamInTask) {
+    Stream stream1{};
+    Stream stream2{};
+    std::atomic<bool> release{false};
+    bool done = false;
+    stream2.Enqueue([&release, &done]() {
+        while (!release) {
+            std::this_thread::yield();
+        }
+        done = true;
+    });
+    bool observed = false;
+    stream1.Enqueue([&stream2, &release, &done, &observed]() {
+        release = true;
+        // Waits for the other stream, although the current thread is executing a kernel.
+        stream2.Synchronize();
+        observed = done;
+    });
+    stream1.Synchronize();
+    EXPECT_TRUE(observed);
+}
+
+TEST(StreamTest, SynchronizeInKernelExecutionScope) {
+    Stream stream{};
+    std::atomic<bool> release{false};
+    bool done = false;
+    stream.Enqueue([&release, &done]() {
+        while (!release) {
+            std::this_thread::yield();
+        }
+        done = true;
+    });
+    KernelExecutionScope scope{};
+    release = true;
+    stream.Synchronize();
+    EXPECT_TRUE(done);
+}
+
+TEST(StreamTest, Exception) {
+    Stream stream{};
+    int count = 0;
+    stream.Enqueue([]() { throw std::runtime_error{"error1"}; });
+    stream.Enqueue([]() { throw std::logic_error{"error2"}; });
+    stream.Enqueue([&count]() { ++count; });
+
+    // The first exception is rethrown only once.
+    EXPECT_THROW(stream.Synchronize(), std::runtime_error);
+    EXPECT_EQ(1, count);
+    stream.Synchronize();
+}
+
+TEST(StreamTest, DestroyTasksInCaller) {
+    // Records the thread that destroys a task.
+    class Payload {
+    public:
+        explicit Payload(std::thread::id& destroyer_id) : destroyer_id_{destroyer_id} {}
+        ~Payload() { destroyer_id_ = std::this_thread::get_id(); }
+
+        Payload(const Payload&) = delete;
+        Payload(Payload&&) = delete;
+        Payload& operator=(const Payload&) = delete;
+        Payload& operator=(Payload&&) = delete;
+
+    private:
+        std::thread::id& destroyer_id_;
+    };
+
+    Stream stream{};
+    std::thread::id destroyer_id1{};
+    std::thread::id destroyer_id2{};
+    stream.Enqueue([payload = std::make_shared<Payload>(destroyer_id1)]() {});
+    stream.Synchronize();
+    EXPECT_EQ(std::this_thread::get_id(), destroyer_id1);
+
+    stream.Enqueue([payload = std::make_shared<Payload>(destroyer_id2)]() {});
+    while (destroyer_id2 == std::thread::id{}) {
+        stream.Enqueue([]() {});
+    }
+    EXPECT_EQ(std::this_thread::get_id(), destroyer_id2);
+}
+
+TEST(StreamTest, DestroyWithPendingTasks) {
+    int count = 0;
+    {
+        Stream stream{};
+        for (int i = 0; i < 10; ++i) {
+            stream.Enqueue([&count]() { ++count; });
+        }
+    }
+    EXPECT_EQ(10, count);
+}
+
+TEST(StreamTest, KernelExecutionScope) {
+    EXPECT_FALSE(IsInKernelExecution());
+    {
+        KernelExecutionScope scope1{};
+        EXPECT_TRUE(IsInKernelExecution());
+        {
+            KernelExecutionScope scope2{};
+            EXPECT_TRUE(IsInKernelExecution());
+        }
+        EXPECT_TRUE(IsInKernelExecution());
+    }
+    EXPECT_FALSE(IsInKernelExecution());
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
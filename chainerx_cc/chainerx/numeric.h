@@ -15,6 +15,7 @@ inline bool IsNan(T /*value*/) {
 }
 
 inline bool IsNan(chainerx::Float16 value) { return value.IsNan(); }
+inline bool IsNan(chainerx::BFloat16 value) { return value.IsNan(); }
 inline bool IsNan(float value) { return std::isnan(value); }
 inline bool IsNan(double value) { return std::isnan(value); }
 
@@ -24,6 +25,7 @@ inline bool IsInf(T /*value*/) {
 }
 
 inline bool IsInf(chainerx::Float16 value) { return value.IsInf(); }
+inline bool IsInf(chainerx::BFloat16 value) { return value.IsInf(); }
 inline bool IsInf(double value) { return std::isinf(value); }
 inline bool IsInf(float value) { return std::isinf(value); }
 
@@ -37,14 +39,23 @@ inline chainerx::Float16 Sign<chainerx::Float16>(chainerx::Float16 x) {
     return IsNan(x) ? x : Float16{static_cast<int>(Float16{0} < x) - static_cast<int>(x < Float16{0})};
 }
 
-#define CHAINERX_DEFINE_NATIVE_FLOAT16_FALLBACK_UNARY(name, func)           \
-    template <typename T>                                                   \
-    inline T name(T x) {                                                    \
-        return func(x);                                                     \
-    }                                                                       \
-    template <>                                                             \
-    inline chainerx::Float16 name<chainerx::Float16>(chainerx::Float16 x) { \
-        return chainerx::Float16{func(static_cast<float>(x))};              \
+template <>
+inline chainerx::BFloat16 Sign<chainerx::BFloat16>(chainerx::BFloat16 x) {
+    return IsNan(x) ? x : BFloat16{static_cast<int>(BFloat16{0} < x) - static_cast<int>(x < BFloat16{0})};
+}
+
+#define CHAINERX_DEFINE_NATIVE_FLOAT16_FALLBACK_UNARY(name, func)              \
+    template <typename T>                                                      \
+    inline T name(T x) {                                                       \
+        return func(x);                                                        \
+    }                                                                          \
+    template <>                                                                \
+    inline chainerx::Float16 name<chainerx::Float16>(chainerx::Float16 x) {    \
+        return chainerx::Float16{func(static_cast<float>(x))};                 \
+    }                                                                          \
+    template <>                                                                \
+    inline chainerx::BFloat16 name<chainerx::BFloat16>(chainerx::BFloat16 x) { \
+        return chainerx::BFloat16{func(static_cast<float>(x))};                \
     }
 
 CHAINERX_DEFINE_NATIVE_FLOAT16_FALLBACK_UNARY(Ceil, std::ceil)
@@ -118,6 +129,10 @@ inline chainerx::Float16 Power(chainerx::Float16 x1, chainerx::Float16 x2) {
     return chainerx::Float16{std::pow(static_cast<float>(x1), static_cast<float>(x2))};
 }
 template <>
+inline chainerx::BFloat16 Power(chainerx::BFloat16 x1, chainerx::BFloat16 x2) {
+    return chainerx::BFloat16{std::pow(static_cast<float>(x1), static_cast<float>(x2))};
+}
+template <>
 inline float Power(float x1, float x2) {
     return std::pow(x1, x2);
 }
@@ -126,14 +141,18 @@ inline double Power(double x1, double x2) {
     return std::pow(x1, x2);
 }
 
-#define CHAINERX_DEFINE_NATIVE_FLOAT16_FALLBACK_BINARY(name, func)                                 \
-    template <typename T>                                                                          \
-    inline T name(T x1, T x2) {                                                                    \
-        return func(x1, x2);                                                                       \
-    }                                                                                              \
-    template <>                                                                                    \
-    inline chainerx::Float16 name<chainerx::Float16>(chainerx::Float16 x1, chainerx::Float16 x2) { \
-        return chainerx::Float16{func(static_cast<float>(x1), static_cast<float>(x2))};            \
+#define CHAINERX_DEFINE_NATIVE_FLOAT16_FALLBACK_BINARY(name, func)                                     \
+    template <typename T>                                                                              \
+    inline T name(T x1, T x2) {                                                                        \
+        return func(x1, x2);                                                                           \
+    }                                                                                                  \
+    template <>                                                                                        \
+    inline chainerx::Float16 name<chainerx::Float16>(chainerx::Float16 x1, chainerx::Float16 x2) {     \
+        return chainerx::Float16{func(static_cast<float>(x1), static_cast<float>(x2))};                \
+    }                                                                                                  \
+    template <>                                                                                        \
+    inline chainerx::BFloat16 name<chainerx::BFloat16>(chainerx::BFloat16 x1, chainerx::BFloat16 x2) { \
+        return chainerx::BFloat16{func(static_cast<float>(x1), static_cast<float>(x2))};               \
     }
 
 CHAINERX_DEFINE_NATIVE_FLOAT16_FALLBACK_BINARY(Arctan2, std::atan2)
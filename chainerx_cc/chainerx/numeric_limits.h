@@ -7,6 +7,7 @@
 #include <limits>
 #endif  // _WIN32
 
+#include "chainerx/bfloat16.h"
 #include "chainerx/float16.h"
 #include "chainerx/macro.h"
 
@@ -58,6 +59,12 @@ struct NumericLimits<chainerx::Float16> {
     CHAINERX_HOST_DEVICE static constexpr chainerx::Float16 MaxOrInf() noexcept { return chainerx::Float16::FromData(0x7c00); }
 };
 
+template <>
+struct NumericLimits<chainerx::BFloat16> {
+    CHAINERX_HOST_DEVICE static constexpr chainerx::BFloat16 LowestOrInf() noexcept { return chainerx::BFloat16::FromData(0xff80); }
+    CHAINERX_HOST_DEVICE static constexpr chainerx::BFloat16 MaxOrInf() noexcept { return chainerx::BFloat16::FromData(0x7f80); }
+};
+
 #ifdef _WIN32
 template <>
 struct NumericLimits<float> {
@@ -1,9 +1,14 @@
 #include "chainerx/numerical_gradient.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <utility>
 #include <vector>
 
+#include <gsl/gsl>
+
 #include "chainerx/array.h"
 #include "chainerx/array_repr.h"
 #include "chainerx/backprop_mode.h"
@@ -14,9 +19,13 @@
 #include "chainerx/indexer.h"
 #include "chainerx/native/data_type.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/native_device.h"
+#include "chainerx/native/parallel.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/thread_local_state.h"
 
 namespace chainerx {
 namespace numerical_gradient_internal {
@@ -26,6 +35,36 @@ void SynchronizeArrays(const Arrays& arrays) {
     std::for_each(arrays.begin(), arrays.end(), [](const Array& array) { array.device().Synchronize(); });
 }
 
+bool IsNativeDevice(const Device& device) { return nullptr != dynamic_cast<const native::NativeDevice*>(&device); }
+
+// Computes the numerical gradients of an elementwise function, perturbing all the elements of each input at once.
+Arrays CalculateElementwiseNumericalGradient(
+        const std::function<Arrays(const Arrays&)>& func, const Arrays& xs, const Arrays& grad_outputs, const Arrays& eps) {
+    Arrays grads;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        const Array& x = xs[i];
+        Arrays xs_minus = xs;  // shallow copy
+        Arrays xs_plus = xs;  // shallow copy
+        xs_minus[i] = x - eps[i];
+        xs_plus[i] = x + eps[i];
+        Arrays ys0 = func(xs_minus);
+        Arrays ys1 = func(xs_plus);
+
+        Array grad_i = ZerosLike(x);
+        for (size_t j = 0; j < grad_outputs.size(); ++j) {
+            if (ys0.at(j).shape() != x.shape()) {
+                throw ChainerxError{"Output ", j, " of shape ", ys0.at(j).shape(), " of an elementwise function does not match input ", i,
+                                    " of shape ", x.shape(), "."};
+            }
+            Array dy = ys1.at(j) - ys0.at(j);
+            Array denom = eps[i].AsType(dy.dtype(), false) * Scalar{2, GetKind(dy.dtype())};
+            grad_i = grad_i + (dy / denom * grad_outputs.at(j)).AsType(x.dtype(), false);
+        }
+        grads.emplace_back(std::move(grad_i));
+    }
+    return grads;
+}
+
 }  // namespace
 
 Scalar Norm(const Array& x) {
@@ -34,7 +73,8 @@ Scalar Norm(const Array& x) {
 }
 
 void Set(const Array& out, int64_t flat_index, Scalar value) {
-    Device& native_device = out.device().context().GetNativeBackend().GetDevice(0);
+    Device& device = out.device();
+    bool is_native = IsNativeDevice(device);
 
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -42,30 +82,44 @@ void Set(const Array& out, int64_t flat_index, Scalar value) {
         Indexer<> indexer{out.shape()};
         T& dst = native::StorageToDataType<T>(iarray[indexer.It(flat_index)]);
         auto src = static_cast<T>(value);
-        Device& device = out.device();
-        device.MemoryCopyFrom(&dst, &src, sizeof(T), native_device);
+        if (is_native) {
+            // Kernels may be running asynchronously.
+            device.Synchronize();
+            dst = src;
+            return;
+        }
+        device.MemoryCopyFrom(&dst, &src, sizeof(T), device.context().GetNativeBackend().GetDevice(0));
         // TODO(hvy): Avoid having to synchronize for each Set.
         device.Synchronize();
     });
 }
 
 Scalar Get(const Array& out, int64_t flat_index) {
-    Device& native_device = out.device().context().GetNativeBackend().GetDevice(0);
+    Device& device = out.device();
+    bool is_native = IsNativeDevice(device);
 
     return VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         IndexableArray<const T> iarray{out};
         Indexer<> indexer{out.shape()};
         const T& src = native::StorageToDataType<const T>(iarray[indexer.It(flat_index)]);
+        if (is_native) {
+            device.Synchronize();
+            return Scalar{src};
+        }
         T dst{};
-        out.device().MemoryCopyTo(&dst, &src, sizeof(T), native_device);
+        device.MemoryCopyTo(&dst, &src, sizeof(T), device.context().GetNativeBackend().GetDevice(0));
         return Scalar{dst};
     });
 }
 
 Arrays CalculateNumericalGradient(
-        std::function<Arrays(const Arrays&)> func, const Arrays& inputs, const Arrays& grad_outputs, const Arrays& eps) {
-    // TODO(niboshi): Currently only elementwise functions are supported.
+        std::function<Arrays(const Arrays&)> func,
+        const Arrays& inputs,
+        const Arrays& grad_outputs,
+        const Arrays& eps,
+        bool elementwise,
+        bool parallel) {
     // TODO(niboshi): Implement arithmetic operations and avoid manual synchronize
     NoBackpropModeScope scope{};
 
@@ -94,7 +148,11 @@ Arrays CalculateNumericalGradient(
         // TODO(niboshi): Check: eps must not contain zeros.
     }
 
-    auto eval = [&func, &xs](int i_in, int64_t in_flat_index, Scalar eps_scalar, float multiplier) mutable -> Arrays {
+    if (elementwise) {
+        return CalculateElementwiseNumericalGradient(func, xs, grad_outputs, eps);
+    }
+
+    auto eval = [&func, &xs](int i_in, int64_t in_flat_index, Scalar eps_scalar, float multiplier) -> Arrays {
         Arrays xs_copy = xs;  // shallow copy
         Array& xi = xs_copy.at(i_in);
         // Only the target array is deeply copied
@@ -104,28 +162,55 @@ Arrays CalculateNumericalGradient(
         return func(xs_copy);
     };
 
+    // The elements are evaluated in parallel only if all the arrays are on native devices, since the evaluations of the other devices
+    // would be serialized by the per-element copies anyway.
+    auto on_native_device = [](const Array& a) { return IsNativeDevice(a.device()); };
+    parallel = parallel && std::all_of(inputs.begin(), inputs.end(), on_native_device) &&
+               std::all_of(grad_outputs.begin(), grad_outputs.end(), on_native_device);
+    ThreadLocalState thread_local_state = ThreadLocalState::Get();
+
     Arrays grads;
     for (int i = 0; i < nin; ++i) {
-        Array grad_i = ZerosLike(xs.at(i));
-        Dtype dtype = grad_i.dtype();
-        int64_t size = grad_i.GetTotalSize();
-
-        for (int64_t in_flat_index = 0; in_flat_index < size; ++in_flat_index) {
-            Scalar eps_scalar = Get(eps.at(i), in_flat_index);
-            Arrays ys0 = eval(i, in_flat_index, eps_scalar, -1);
-            Arrays ys1 = eval(i, in_flat_index, eps_scalar, 1);
-
-            for (int j = 0; j < nout; ++j) {
-                Array dy = ys1.at(j) - ys0.at(j);
-                Array denom = FullLike(dy, eps_scalar) * FullLike(dy, Scalar{2, GetKind(dtype)});
-
-                Array slope = (ys1.at(j) - ys0.at(j)) / denom;
-                Scalar g = AsScalar((slope * grad_outputs.at(j)).Sum().AsType(dtype));
-                Scalar g_ij = Get(grad_i, in_flat_index) + g;
-                Set(grad_i, in_flat_index, g_ij);
+        const Array& x = xs.at(i);
+        Dtype dtype = x.dtype();
+        int64_t size = x.GetTotalSize();
+
+        // Gradients and eps are accessed on the host.
+        Device& host_device = IsNativeDevice(x.device()) ? x.device() : x.device().context().GetNativeBackend().GetDevice(0);
+        Array grad_i = Zeros(x.shape(), dtype, host_device);
+        Array eps_i = eps.at(i).ToDevice(host_device);
+
+        // Each element is computed independently of the others.
+        auto compute_elements = [&](int64_t first, int64_t last) {
+            for (int64_t in_flat_index = first; in_flat_index < last; ++in_flat_index) {
+                Scalar eps_scalar = Get(eps_i, in_flat_index);
+                Arrays ys0 = eval(i, in_flat_index, eps_scalar, -1);
+                Arrays ys1 = eval(i, in_flat_index, eps_scalar, 1);
+
+                for (int j = 0; j < nout; ++j) {
+                    Array dy = ys1.at(j) - ys0.at(j);
+                    Array denom = FullLike(dy, eps_scalar) * FullLike(dy, Scalar{2, GetKind(dtype)});
+
+                    Array slope = (ys1.at(j) - ys0.at(j)) / denom;
+                    Scalar g = AsScalar((slope * grad_outputs.at(j)).Sum().AsType(dtype));
+                    Scalar g_ij = Get(grad_i, in_flat_index) + g;
+                    Set(grad_i, in_flat_index, g_ij);
+                }
             }
+        };
+
+        if (parallel) {
+            // The worker threads evaluate the function with the default context, device and backprop modes of the calling thread.
+            native::ParallelFor(size, 1, [&compute_elements, &thread_local_state](int64_t first, int64_t last) {
+                ThreadLocalState worker_state = ThreadLocalState::Get();
+                auto restore_worker_state = gsl::finally([&worker_state]() { ThreadLocalState::Set(worker_state); });
+                ThreadLocalState::Set(thread_local_state);
+                compute_elements(first, last);
+            });
+        } else {
+            compute_elements(0, size);
         }
-        grads.push_back(grad_i);
+        grads.emplace_back(&host_device == &x.device() ? std::move(grad_i) : grad_i.ToDevice(x.device()));
     }
 
     return grads;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -10,8 +11,23 @@ namespace numerical_gradient_internal {
 
 using Arrays = std::vector<Array>;
 
+// Computes the gradients of `func` by central differences, with the displacements given by `eps`.
+//
+// Each element of the inputs is perturbed separately by default.
+//
+// If `elementwise` is true, `func` must be an elementwise function, i.e. each element of its outputs, all of which must have the shapes of
+// the inputs, depends only on the elements of the inputs at the same index. All the elements of an input are then perturbed at once, so
+// that `func` is only evaluated twice for each input.
+//
+// If `parallel` is true and all the arrays are on native devices, the perturbed elements are evaluated in parallel by the native thread
+// pool, in which case `func` must be thread safe. It has no effect if `elementwise` is true.
 Arrays CalculateNumericalGradient(
-        std::function<Arrays(const Arrays&)> func, const Arrays& inputs, const Arrays& grad_outputs, const Arrays& eps);
+        std::function<Arrays(const Arrays&)> func,
+        const Arrays& inputs,
+        const Arrays& grad_outputs,
+        const Arrays& eps,
+        bool elementwise = false,
+        bool parallel = false);
 
 }  // namespace numerical_gradient_internal
 
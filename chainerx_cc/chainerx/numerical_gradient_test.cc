@@ -13,6 +13,8 @@
 #include "chainerx/array_repr.h"
 #include "chainerx/context.h"
 #include "chainerx/device_id.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
 #include "chainerx/shape.h"
 #include "chainerx/testing/array.h"
 #include "chainerx/testing/device_session.h"
@@ -36,6 +38,18 @@ public:
             const Arrays& grad_outputs,
             const Arrays& eps,
             const Arrays& expected_grads) {
+        CheckNumericalGradient<T>(func, center_inputs, grad_outputs, eps, expected_grads);
+    }
+
+    template <typename T>
+    void CheckNumericalGradient(
+            const std::function<Arrays(const Arrays&)>& func,
+            const Arrays& center_inputs,
+            const Arrays& grad_outputs,
+            const Arrays& eps,
+            const Arrays& expected_grads,
+            bool elementwise = false,
+            bool parallel = false) {
         size_t nin = center_inputs.size();
 
         auto checked_func = [&](const Arrays& inputs) -> Arrays {
@@ -48,7 +62,7 @@ public:
             return func(inputs);
         };
 
-        Arrays grads = CalculateNumericalGradient(checked_func, center_inputs, grad_outputs, eps);
+        Arrays grads = CalculateNumericalGradient(checked_func, center_inputs, grad_outputs, eps, elementwise, parallel);
 
         EXPECT_EQ(grads.size(), expected_grads.size());
 
@@ -138,6 +152,74 @@ TEST_P(NumericalGradientTest, NumericalGradientMul) {
     CheckElementwiseNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads);
 }
 
+TEST_P(NumericalGradientTest, NumericalGradientMulElementwise) {
+    using T = float;
+    Shape shape{2, 3};
+    std::vector<T> data1{1.f, 2.f, 3.f, 4.f, -2.f, -3.f};
+    std::vector<T> data2{0.f, 1.f, 2.f, 3.f, 2.f, 3.f};
+    std::vector<T> eps1{1e-3f, -1e-3f, 1e-3f, 1e-3f, -1e-3f, 1e-3f};
+    std::vector<T> eps2{1e-3f, 1e-3f, -1e-3f, 1e-3f, 1e-3f, 1e-3f};
+    std::vector<T> grad_output_data{1.f, -2.f, 3.f, 0.f, 2.2f, 1.f};
+
+    Arrays inputs = {
+            testing::BuildArray(shape).WithData(data1),
+            testing::BuildArray(shape).WithData(data2),
+    };
+    Arrays eps = {
+            testing::BuildArray(shape).WithData(eps1),
+            testing::BuildArray(shape).WithData(eps2),
+    };
+    Arrays grad_outputs = {
+            testing::BuildArray(shape).WithData(grad_output_data),
+    };
+
+    // Forward function
+    int eval_count = 0;
+    auto forward = [&eval_count](const Arrays& inputs) {
+        ++eval_count;
+        return Arrays{inputs[0] * inputs[1]};
+    };
+
+    // Create expected gradients
+    Arrays expected_grads = {inputs[1] * grad_outputs[0], inputs[0] * grad_outputs[0]};
+
+    // Check
+    CheckNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads, true);
+
+    // All the elements of each input are perturbed at once.
+    EXPECT_EQ(4, eval_count);
+}
+
+TEST_P(NumericalGradientTest, NumericalGradientDot) {
+    using T = float;
+    std::vector<T> data1{1.f, 2.f, 3.f, 4.f, -2.f, -3.f};
+    std::vector<T> data2{0.f, 1.f, 2.f, 3.f, 2.f, 3.f};
+
+    Arrays inputs = {
+            testing::BuildArray({2, 3}).WithData(data1),
+            testing::BuildArray({3, 2}).WithData(data2),
+    };
+    Arrays eps = {
+            Full({2, 3}, 1e-2f),
+            Full({3, 2}, 1e-2f),
+    };
+    Arrays grad_outputs = {
+            testing::BuildArray({2, 2}).WithData<T>({1.f, -2.f, 0.5f, 3.f}),
+    };
+
+    // Forward function, each of whose outputs depends on several elements of the inputs.
+    auto forward = [](const Arrays& inputs) { return Arrays{Dot(inputs[0], inputs[1])}; };
+
+    // Create expected gradients
+    Arrays expected_grads = {Dot(grad_outputs[0], inputs[1].Transpose()), Dot(inputs[0].Transpose(), grad_outputs[0])};
+
+    // Check
+    CheckNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads);
+
+    // The forward function is thread safe, so that the elements can also be evaluated in parallel.
+    CheckNumericalGradient<float>(forward, inputs, grad_outputs, eps, expected_grads, false, true);
+}
+
 INSTANTIATE_TEST_CASE_P(
         ForEachBackend,
         NumericalGradientTest,
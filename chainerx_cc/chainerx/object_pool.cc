@@ -0,0 +1,200 @@
+#include "chainerx/object_pool.h"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+constexpr size_t kSizeClassCount = kObjectPoolMaxBlockSize / kObjectPoolAlignment;
+
+// Number of blocks carved out of a newly allocated slab.
+constexpr size_t kSlabBlockCount = 64;
+
+// Maximum number of blocks kept in a thread cache per size class. Surplus blocks are returned to the central free list.
+constexpr size_t kMaxCachedBlockCount = 2 * kSlabBlockCount;
+
+// Number of blocks moved at once between a thread cache and the central free list.
+constexpr size_t kTransferBlockCount = kSlabBlockCount / 2;
+
+static_assert(kObjectPoolMaxBlockSize % kObjectPoolAlignment == 0, "");
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+size_t GetSizeClass(size_t size) { return (size + kObjectPoolAlignment - 1) / kObjectPoolAlignment - 1; }
+
+size_t GetBlockSize(size_t size_class) { return (size_class + 1) * kObjectPoolAlignment; }
+
+// A singly-linked list of free blocks.
+class FreeList {
+public:
+    bool empty() const { return head_ == nullptr; }
+
+    size_t size() const { return size_; }
+
+    void Push(FreeBlock* block) {
+        block->next = head_;
+        head_ = block;
+        ++size_;
+    }
+
+    FreeBlock* Pop() {
+        CHAINERX_ASSERT(head_ != nullptr);
+        FreeBlock* block = head_;
+        head_ = block->next;
+        --size_;
+        return block;
+    }
+
+    // Moves at most `count` blocks to the other list.
+    void MoveTo(FreeList& other, size_t count) {
+        for (size_t i = 0; i < count && head_ != nullptr; ++i) {
+            other.Push(Pop());
+        }
+    }
+
+private:
+    FreeBlock* head_{nullptr};
+    size_t size_{0};
+};
+
+// Free list of a size class shared among threads.
+class CentralFreeList {
+public:
+    // Moves free blocks to the given thread-local list, allocating a new slab if there are none.
+    void Fetch(size_t size_class, FreeList& dst) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (free_list_.empty()) {
+            AllocateSlab(GetBlockSize(size_class));
+        }
+        free_list_.MoveTo(dst, kTransferBlockCount);
+    }
+
+    void Return(FreeList& src, size_t count) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        src.MoveTo(free_list_, count);
+    }
+
+    void Return(FreeBlock* block) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        free_list_.Push(block);
+    }
+
+private:
+    // Slabs are never freed; blocks are recycled through the free lists for the lifetime of the process.
+    void AllocateSlab(size_t block_size) {
+        auto* slab = static_cast<char*>(::operator new(block_size * kSlabBlockCount));
+        for (size_t i = 0; i < kSlabBlockCount; ++i) {
+            free_list_.Push(reinterpret_cast<FreeBlock*>(slab + i * block_size));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        }
+    }
+
+    std::mutex mutex_;
+    FreeList free_list_;
+};
+
+// The central free lists are intentionally leaked, since blocks can be deallocated during the destruction of static objects.
+std::array<CentralFreeList, kSizeClassCount>& GetCentralFreeLists() {
+    static auto* central_free_lists = new std::array<CentralFreeList, kSizeClassCount>{};
+    return *central_free_lists;
+}
+
+thread_local size_t t_oversize_allocation_count = 0;
+
+// Set when the thread cache of the current thread is destroyed on thread exit.
+// Since it is trivially destructible, it can be accessed even after the destruction of other thread-local objects.
+thread_local bool t_thread_cache_destroyed = false;
+
+class ThreadCache {
+public:
+    ThreadCache() = default;
+
+    ~ThreadCache() {
+        std::array<CentralFreeList, kSizeClassCount>& central_free_lists = GetCentralFreeLists();
+        for (size_t size_class = 0; size_class < kSizeClassCount; ++size_class) {
+            FreeList& free_list = free_lists_[size_class];
+            central_free_lists[size_class].Return(free_list, free_list.size());
+        }
+        t_thread_cache_destroyed = true;
+    }
+
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache(ThreadCache&&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+    ThreadCache& operator=(ThreadCache&&) = delete;
+
+    void* Allocate(size_t size_class) {
+        FreeList& free_list = free_lists_[size_class];
+        if (free_list.empty()) {
+            GetCentralFreeLists()[size_class].Fetch(size_class, free_list);
+        }
+        return free_list.Pop();
+    }
+
+    void Deallocate(FreeBlock* block, size_t size_class) {
+        FreeList& free_list = free_lists_[size_class];
+        free_list.Push(block);
+        if (free_list.size() > kMaxCachedBlockCount) {
+            GetCentralFreeLists()[size_class].Return(free_list, kTransferBlockCount);
+        }
+    }
+
+private:
+    std::array<FreeList, kSizeClassCount> free_lists_{};
+};
+
+// Returns the thread cache of the current thread, or nullptr if it has already been destroyed.
+ThreadCache* GetThreadCache() {
+    if (t_thread_cache_destroyed) {
+        return nullptr;
+    }
+    thread_local ThreadCache thread_cache{};
+    return &thread_cache;
+}
+
+}  // namespace
+
+void* AllocateFromObjectPool(size_t size) {
+    if (size == 0 || size > kObjectPoolMaxBlockSize) {
+        ++t_oversize_allocation_count;
+        return ::operator new(size);
+    }
+    size_t size_class = GetSizeClass(size);
+    if (ThreadCache* thread_cache = GetThreadCache()) {
+        return thread_cache->Allocate(size_class);
+    }
+    FreeList free_list{};
+    GetCentralFreeLists()[size_class].Fetch(size_class, free_list);
+    void* ptr = free_list.Pop();
+    GetCentralFreeLists()[size_class].Return(free_list, free_list.size());
+    return ptr;
+}
+
+size_t GetObjectPoolOversizeAllocationCount() { return t_oversize_allocation_count; }
+
+void DeallocateToObjectPool(void* ptr, size_t size) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (size == 0 || size > kObjectPoolMaxBlockSize) {
+        ::operator delete(ptr);
+        return;
+    }
+    size_t size_class = GetSizeClass(size);
+    auto* block = static_cast<FreeBlock*>(ptr);
+    if (ThreadCache* thread_cache = GetThreadCache()) {
+        thread_cache->Deallocate(block, size_class);
+    } else {
+        GetCentralFreeLists()[size_class].Return(block);
+    }
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace chainerx {
+namespace internal {
+
+// Alignment of the memory blocks returned by the object pool.
+constexpr size_t kObjectPoolAlignment = alignof(std::max_align_t);
+
+// Largest size of a memory block served from the object pool. Larger requests are forwarded to the global allocator.
+// It must be large enough for the nodes of computational graphs, including the control blocks of their shared pointers.
+constexpr size_t kObjectPoolMaxBlockSize = 1024;
+
+// Allocates a memory block of the given size from the object pool.
+//
+// The object pool is a size-segregated free-list allocator with a per-thread cache. It is meant for small objects that are created and
+// destroyed very frequently, such as the nodes of computational graphs, where the global allocator tends to be a bottleneck.
+// Blocks may be deallocated in a thread other than the one that allocated them.
+// Memory of the pool is retained for reuse and is never returned to the system.
+void* AllocateFromObjectPool(size_t size);
+
+// Deallocates a memory block allocated by AllocateFromObjectPool.
+// The size must be equal to the one given on allocation.
+void DeallocateToObjectPool(void* ptr, size_t size) noexcept;
+
+// Returns the number of allocations in the current thread that were forwarded to the global allocator because of their sizes.
+// It is meant for tests checking that objects fit in the object pool.
+size_t GetObjectPoolOversizeAllocationCount();
+
+// Allocator which allocates from the object pool.
+// It is intended to be used with std::allocate_shared.
+template <typename T>
+class ObjectPoolAllocator {
+    static_assert(alignof(T) <= kObjectPoolAlignment, "Over-aligned types are not supported.");
+
+public:
+    using value_type = T;
+
+    ObjectPoolAllocator() = default;
+
+    template <typename U>
+    ObjectPoolAllocator(const ObjectPoolAllocator<U>& /*other*/) noexcept {}  // NOLINT(google-explicit-constructor)
+
+    T* allocate(size_t n) { return static_cast<T*>(AllocateFromObjectPool(n * sizeof(T))); }
+
+    void deallocate(T* ptr, size_t n) noexcept { DeallocateToObjectPool(ptr, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const ObjectPoolAllocator<U>& /*other*/) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const ObjectPoolAllocator<U>& /*other*/) const noexcept {
+        return false;
+    }
+};
+
+// Creates a shared object whose storage, including its control block, is allocated from the object pool.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakePooledShared(Args&&... args) {
+    return std::allocate_shared<T>(ObjectPoolAllocator<T>{}, std::forward<Args>(args)...);
+}
+
+}  // namespace internal
+}  // namespace chainerx
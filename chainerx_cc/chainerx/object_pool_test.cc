@@ -0,0 +1,99 @@
+#include "chainerx/object_pool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/testing/device_session.h"
+#include "chainerx/testing/threading.h"
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+bool IsAligned(const void* ptr) { return reinterpret_cast<uintptr_t>(ptr) % kObjectPoolAlignment == 0; }  // NOLINT
+
+TEST(ObjectPoolTest, AllocateAndDeallocate) {
+    for (size_t size : {size_t{1}, size_t{8}, size_t{16}, size_t{17}, size_t{100}, kObjectPoolMaxBlockSize, kObjectPoolMaxBlockSize + 1}) {
+        std::vector<void*> ptrs;
+        for (int i = 0; i < 200; ++i) {
+            void* ptr = AllocateFromObjectPool(size);
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_TRUE(IsAligned(ptr));
+            std::memset(ptr, 0xff, size);
+            ptrs.emplace_back(ptr);
+        }
+        // All the blocks are distinct.
+        EXPECT_EQ(ptrs.size(), std::set<void*>(ptrs.begin(), ptrs.end()).size());
+        for (void* ptr : ptrs) {
+            DeallocateToObjectPool(ptr, size);
+        }
+    }
+}
+
+TEST(ObjectPoolTest, Reuse) {
+    void* ptr1 = AllocateFromObjectPool(48);
+    DeallocateToObjectPool(ptr1, 48);
+    void* ptr2 = AllocateFromObjectPool(48);
+    EXPECT_EQ(ptr1, ptr2);
+    DeallocateToObjectPool(ptr2, 48);
+}
+
+TEST(ObjectPoolTest, MakePooledShared) {
+    std::shared_ptr<int> p = MakePooledShared<int>(3);
+    EXPECT_EQ(3, *p);
+    std::weak_ptr<int> w = p;
+    p.reset();
+    EXPECT_TRUE(w.expired());
+}
+
+TEST(ObjectPoolTest, DeallocateInAnotherThread) {
+    static constexpr size_t kThreadCount = 2;
+    static constexpr size_t kCount = 1000;
+
+    std::vector<std::shared_ptr<int64_t>> values;
+    for (size_t i = 0; i < kThreadCount * kCount; ++i) {
+        values.emplace_back(MakePooledShared<int64_t>(i));
+    }
+
+    testing::RunThreads(kThreadCount, [&values](size_t thread_index) {
+        for (size_t i = thread_index * kCount; i < (thread_index + 1) * kCount; ++i) {
+            EXPECT_EQ(static_cast<int64_t>(i), *values[i]);
+            values[i].reset();
+            // Allocate in this thread as well.
+            std::shared_ptr<int64_t> p = MakePooledShared<int64_t>(-1);
+            EXPECT_EQ(-1, *p);
+        }
+        return nullptr;
+    });
+}
+
+TEST(ObjectPoolTest, GraphNodesArePooled) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    Array a = Ones({2, 3}, Dtype::kFloat32).RequireGrad();
+    Array b = Ones({2, 3}, Dtype::kFloat32).RequireGrad();
+
+    // Array bodies, array nodes and op nodes created by the forward and backward computations all fit in the pool.
+    size_t count = GetObjectPoolOversizeAllocationCount();
+    std::vector<Array> ys = Split(a * b + a, 3, 1);
+    Array y = Sum(ys[0] * ys[1] - ys[2]);
+    Backward(y, nonstd::nullopt, DoubleBackpropOption::kEnable);
+    EXPECT_EQ(count, GetObjectPoolOversizeAllocationCount());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace chainerx
@@ -18,6 +18,7 @@
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
 #include "chainerx/shape.h"
+#include "chainerx/small_vector.h"
 
 namespace chainerx {
 
@@ -31,6 +32,10 @@ namespace internal {
 class ArrayNode;
 class OpNode;
 
+// Number of inputs and outputs of an op node that can be stored without heap allocation.
+// Most ops have only a few inputs and outputs.
+constexpr size_t kOpNodeInlineEdgeCount = 4;
+
 struct ArrayProps {
     explicit ArrayProps(const Array& array);
     explicit ArrayProps(const ArrayNode& array_node);
@@ -43,13 +48,15 @@ struct ArrayProps {
 
 class OpNodeBackwardEntry {
 public:
-    OpNodeBackwardEntry(OpNode& op_node, std::vector<size_t> input_array_node_indices, BackwardFunction backward_func);
+    using InputArrayNodeIndices = SmallVector<size_t, kOpNodeInlineEdgeCount>;
+
+    OpNodeBackwardEntry(OpNode& op_node, InputArrayNodeIndices input_array_node_indices, BackwardFunction backward_func);
 
     OpNode& op_node() const { return op_node_; }
 
     size_t input_array_node_count() const { return input_array_node_indices_.size(); }
 
-    const std::vector<size_t>& input_array_node_indices() const { return input_array_node_indices_; }
+    const InputArrayNodeIndices& input_array_node_indices() const { return input_array_node_indices_; }
 
     const BackwardFunction& backward_func() const { return backward_func_; }
 
@@ -60,7 +67,7 @@ private:
 
     // The index mapping from local (this backward function) to global (op node).
     // Can be unset if the input array does not require grad.
-    std::vector<size_t> input_array_node_indices_;
+    InputArrayNodeIndices input_array_node_indices_;
 
     BackwardFunction backward_func_;
 };
@@ -72,6 +79,9 @@ std::shared_ptr<ArrayNode> FabricateOutputArrayNode(std::shared_ptr<OpNode> op_n
 
 class OpNode {
 public:
+    using InputArrayNodes = SmallVector<std::shared_ptr<ArrayNode>, kOpNodeInlineEdgeCount>;
+    using OutputArrayNodes = SmallVector<nonstd::optional<std::weak_ptr<ArrayNode>>, kOpNodeInlineEdgeCount>;
+
     // Creates a new op node that has output array nodes corresponding to the given outputs.
     static std::shared_ptr<OpNode> CreateWithOutputArrayNodes(
             std::string name, BackpropId backprop_id, size_t input_count, const std::vector<ConstArrayRef>& outputs);
@@ -106,9 +116,9 @@ public:
 
     std::string name() const { return name_; }
 
-    std::vector<std::shared_ptr<ArrayNode>>& input_array_nodes();
+    InputArrayNodes& input_array_nodes();
 
-    const std::vector<std::shared_ptr<ArrayNode>>& input_array_nodes() const;
+    const InputArrayNodes& input_array_nodes() const;
 
     gsl::span<OpNodeBackwardEntry> backward_entries() { return backward_entries_; }
 
@@ -128,10 +138,10 @@ public:
     }
 
     // Returns the list of output array nodes on "this" graph.
-    const std::vector<nonstd::optional<std::weak_ptr<ArrayNode>>>& output_array_nodes() const { return output_array_nodes_; }
+    const OutputArrayNodes& output_array_nodes() const { return output_array_nodes_; }
 
     // Returns the list of output array nodes on "this" graph.
-    std::vector<nonstd::optional<std::weak_ptr<ArrayNode>>>& output_array_nodes() { return output_array_nodes_; }
+    OutputArrayNodes& output_array_nodes() { return output_array_nodes_; }
 
     // Returns the input array nodes of all graphs.
     const std::vector<std::tuple<BackpropId, std::vector<std::shared_ptr<ArrayNode>>>>& outer_graphs_input_array_nodes() const {
@@ -158,10 +168,10 @@ private:
     int64_t rank_{0};
 
     // List of input array nodes.
-    std::vector<std::shared_ptr<ArrayNode>> input_array_nodes_;
+    InputArrayNodes input_array_nodes_;
 
     // List of output array nodes of this graph.
-    std::vector<nonstd::optional<std::weak_ptr<ArrayNode>>> output_array_nodes_;
+    OutputArrayNodes output_array_nodes_;
 
     // List of input/output array nodes of outer graphs.
     // Outer graphs refer to graphs with lower ordinals.
@@ -170,9 +180,10 @@ private:
     std::vector<std::tuple<BackpropId, std::vector<std::shared_ptr<ArrayNode>>>> outer_graphs_output_array_nodes_;
 
     // Array props of output array nodes. This is used for creating dummy gradients.
-    std::vector<ArrayProps> output_array_props_;
+    SmallVector<ArrayProps, kOpNodeInlineEdgeCount> output_array_props_;
 
-    std::vector<OpNodeBackwardEntry> backward_entries_;
+    // Most ops register a single backward function.
+    SmallVector<OpNodeBackwardEntry, 1> backward_entries_;
 };
 
 }  // namespace internal
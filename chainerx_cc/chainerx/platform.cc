@@ -5,10 +5,12 @@
 #else  // _WIN32
 // Windows doesn't support it currently
 #include <dlfcn.h>
+#include <unistd.h>
 // NOLINTNEXTLINE(modernize-deprecated-headers): clang-tidy recommends to use cstdlib, but setenv is not included in cstdlib
 #include <stdlib.h>
 
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 #include <string>
 
@@ -30,6 +32,10 @@ void DlClose(void* handle) { windows::DlClose(handle); }
 
 void* DlSym(void* handle, const std::string& name) { return windows::DlSym(handle, name); }
 
+void SyncFile(std::FILE* file) { windows::SyncFile(file); }
+
+void RenameFile(const std::string& src_path, const std::string& dst_path) { windows::RenameFile(src_path, dst_path); }
+
 #else  // _WIN32
 
 void SetEnv(const std::string& name, const std::string& value) {
@@ -65,6 +71,19 @@ void* DlSym(void* handle, const std::string& name) {
     throw ChainerxError{"Failed to get symbol: ", ::dlerror()};
 }
 
+void SyncFile(std::FILE* file) {
+    if (0 != std::fflush(file) || 0 != ::fsync(::fileno(file))) {
+        throw ChainerxError{"Failed to synchronize file: ", std::strerror(errno)};
+    }
+}
+
+void RenameFile(const std::string& src_path, const std::string& dst_path) {
+    // rename(2) atomically replaces the destination.
+    if (0 != std::rename(src_path.c_str(), dst_path.c_str())) {
+        throw ChainerxError{"Failed to rename file '", src_path, "' to '", dst_path, "': ", std::strerror(errno)};
+    }
+}
+
 #endif  // _WIN32
 
 }  // namespace platform
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdio>
 #include <string>
 
 namespace chainerx {
@@ -15,5 +16,11 @@ void DlClose(void* handle);
 
 void* DlSym(void* handle, const std::string& name);
 
+// Flushes the buffered data of the file and synchronizes it with the storage device.
+void SyncFile(std::FILE* file);
+
+// Renames a file, replacing the destination if it exists.
+void RenameFile(const std::string& src_path, const std::string& dst_path);
+
 }  // namespace platform
 }  // namespace chainerx
@@ -1,6 +1,10 @@
 #include "chainerx/platform/windows.h"
 
+#include <io.h>
+#include <windows.h>
+
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 #include <string>
 
@@ -39,6 +43,18 @@ void* DlSym(void* handle, const std::string& name) {
     throw ChainerxError{"dlsym not implemented for Windows."};
 }
 
+void SyncFile(std::FILE* file) {
+    if (0 != std::fflush(file) || 0 != ::_commit(::_fileno(file))) {
+        throw ChainerxError{"Failed to synchronize file: ", std::strerror(errno)};
+    }
+}
+
+void RenameFile(const std::string& src_path, const std::string& dst_path) {
+    if (!::MoveFileExA(src_path.c_str(), dst_path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        throw ChainerxError{"Failed to rename file '", src_path, "' to '", dst_path, "': error code ", ::GetLastError()};
+    }
+}
+
 }  // namespace windows
 }  // namespace platform
 }  // namespace chainerx
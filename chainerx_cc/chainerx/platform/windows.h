@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdio>
 #include <string>
 
 namespace chainerx {
@@ -16,6 +17,10 @@ void DlClose(void* handle);
 
 void* DlSym(void* handle, const std::string& name);
 
+void SyncFile(std::FILE* file);
+
+void RenameFile(const std::string& src_path, const std::string& dst_path);
+
 }  // namespace windows
 }  // namespace platform
 }  // namespace chainerx
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <string>
 #include <tuple>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/misc.h"
 #include "chainerx/routines/sorting.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
 #include "chainerx/strides.h"
@@ -69,18 +71,41 @@ ArrayBodyPtr MakeArrayFromNumpyArray(py::array array, Device& device) {
     py::buffer_info info = array.request();
 
     // Some backends may perform zero copy, so increment refcount of numpy ndarray not to be released in user codes.
-    // Note that inc_ref() / dec_ref() is performed by the lambda capture.
-    std::shared_ptr<void> data{static_cast<char*>(info.ptr) + first, [array](void*) {}};
+    std::shared_ptr<void> data = MakeDataOwnedByPyObject(static_cast<char*>(info.ptr) + first, std::move(array));
 
     return MoveArrayBody(internal::FromHostData(shape, dtype, data, strides, -first, device));
 }
 
+ArrayBodyPtr MakeTakeIndicesArray(py::handle indices, Device& device) {
+    if (py::isinstance<ArrayBody>(indices)) {
+        return py::cast<ArrayBodyPtr>(indices);
+    }
+    if (py::isinstance<py::sequence>(indices)) {
+        nonstd::optional<Dtype> dtype = Dtype::kInt64;
+        return MakeArray(indices, dtype, false, device);
+    }
+    if (py::isinstance<py::array>(indices)) {
+        return MakeArrayFromNumpyArray(py::cast<py::array>(indices), device);
+    }
+    throw py::type_error{"only integers, slices (`:`), sequence, numpy.ndarray and chainerx.newaxis (`None`) are valid indices"};
+}
+
+std::shared_ptr<void> MakeDataOwnedByPyObject(void* ptr, py::object owner) {
+    // The deleter may be called from a thread which does not hold the GIL, e.g. when the last array referring to the data is released
+    // in a routine called with the GIL released.
+    PyObject* owner_ptr = owner.release().ptr();
+    return std::shared_ptr<void>{ptr, [owner_ptr](void* /*ptr*/) {
+                                     py::gil_scoped_acquire acquire;
+                                     Py_DECREF(owner_ptr);
+                                 }};
+}
+
 namespace {
 
 py::array MakeNumpyArrayFromArray(const py::module& m, const ArrayBodyPtr& self, bool copy) {
     Array array = Array{self}.ToNative();
 
-    py::object dtype = GetNumpyDtypeFromModule(m, array.dtype());
+    py::dtype dtype = GetConvertibleNumpyDtypeFromModule(m, array.dtype());
     const Shape& shape = array.shape();
     const Strides& strides = array.strides();
     const void* ptr = internal::GetRawOffsetData(array);
@@ -97,7 +122,7 @@ py::object MakeCupyArrayFromArray(const py::module& m, py::handle self) {
     Device& device = array.device();
     // TODO(okapies): rejects if array's device is not compatible with cupy
 
-    py::object dtype = GetNumpyDtypeFromModule(m, array.dtype());
+    py::dtype dtype = GetConvertibleNumpyDtypeFromModule(m, array.dtype());
     const Shape& shape = array.shape();
     const Strides& strides = array.strides();
 
@@ -116,6 +141,89 @@ py::object MakeCupyArrayFromArray(const py::module& m, py::handle self) {
     return ndarray(ToTuple(shape), dtype, memptr, ToTuple(strides));
 }
 
+// The functions below implement fast paths of the operators which are frequently called with small arrays, where the overhead of the
+// binding dominates the computation. Arguments are checked by exact type comparisons and unboxed without going through the type casters
+// of pybind11. Other argument types fall back to the generic conversions.
+
+PyTypeObject* GetArrayBodyType() {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    static PyTypeObject* type = reinterpret_cast<PyTypeObject*>(py::detail::get_type_handle(typeid(ArrayBody), true).ptr());
+    return type;
+}
+
+// Returns the array body held by the object if its type is exactly chainerx.ndarray, or nullptr otherwise.
+const ArrayBodyPtr* TryUnboxArrayBody(py::handle obj) {
+    if (Py_TYPE(obj.ptr()) != GetArrayBodyType()) {
+        return nullptr;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    py::detail::value_and_holder v_h = reinterpret_cast<py::detail::instance*>(obj.ptr())->get_value_and_holder();
+    if (!v_h.holder_constructed()) {
+        return nullptr;
+    }
+    return &v_h.holder<ArrayBodyPtr>();
+}
+
+// Returns the scalar if the object is exactly a Python float, int or bool, or nullopt otherwise.
+nonstd::optional<Scalar> TryUnboxScalar(py::handle obj) {
+    PyObject* ptr = obj.ptr();
+    if (PyFloat_CheckExact(ptr)) {
+        return Scalar{PyFloat_AS_DOUBLE(ptr)};
+    }
+    if (PyLong_CheckExact(ptr)) {
+        int overflow{};
+        int64_t value = PyLong_AsLongLongAndOverflow(ptr, &overflow);
+        if (overflow == 0) {
+            return Scalar{value};
+        }
+        return nonstd::nullopt;
+    }
+    if (PyBool_Check(ptr)) {
+        return Scalar{ptr == Py_True};
+    }
+    return nonstd::nullopt;
+}
+
+// Applies a binary operator to an array and either an array or a scalar.
+// Returns NotImplemented if the right-hand side is neither of them.
+template <typename Op>
+py::object ApplyBinaryOperator(const ArrayBodyPtr& self, py::handle rhs, Op&& op) {
+    if (const ArrayBodyPtr* rhs_body = TryUnboxArrayBody(rhs)) {
+        return py::cast(MoveArrayBody(op(Array{self}, Array{*rhs_body})));
+    }
+    if (nonstd::optional<Scalar> rhs_scalar = TryUnboxScalar(rhs)) {
+        return py::cast(MoveArrayBody(op(Array{self}, *rhs_scalar)));
+    }
+
+    // Slow path, e.g. for subclasses of chainerx.ndarray and NumPy scalars.
+    if (py::isinstance<ArrayBody>(rhs)) {
+        return py::cast(MoveArrayBody(op(Array{self}, Array{py::cast<ArrayBodyPtr>(rhs)})));
+    }
+    nonstd::optional<Scalar> rhs_scalar{};
+    try {
+        rhs_scalar = py::cast<Scalar>(rhs);
+    } catch (const py::cast_error&) {
+        return py::reinterpret_borrow<py::object>(Py_NotImplemented);
+    }
+    return py::cast(MoveArrayBody(op(Array{self}, *rhs_scalar)));
+}
+
+// Converts the axis argument of reductions, which is either None, an integer or a sequence of integers.
+OptionalAxes ToReductionAxes(py::handle axis) {
+    if (axis.is_none()) {
+        return nonstd::nullopt;
+    }
+    try {
+        if (py::isinstance<py::sequence>(axis)) {
+            std::vector<int8_t> axes = py::cast<std::vector<int8_t>>(axis);
+            return Axes{axes.begin(), axes.end()};
+        }
+        return Axes{py::cast<int8_t>(axis)};
+    } catch (const py::cast_error&) {
+        throw py::type_error{"axis must be None, an integer or a sequence of integers"};
+    }
+}
+
 }  // namespace
 
 ArrayBodyPtr MakeArray(py::handle object, py::handle dtype, bool copy, py::handle device) {
@@ -179,8 +287,7 @@ void InitChainerxArray(pybind11::module& m) {
                   -> ArrayBodyPtr {
               // TODO(niboshi): Expose `base` as `ndarray.base` attribute.
               void* c_ptr = reinterpret_cast<void*>(ptr);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-              // Note that inc_ref() / dec_ref() is performed by the lambda capture.
-              std::shared_ptr<void> data{c_ptr, [base](void*) {}};
+              std::shared_ptr<void> data = MakeDataOwnedByPyObject(c_ptr, std::move(base));
               return MoveArrayBody(FromData(ToShape(shape), GetDtype(dtype), data, ToStrides(strides), offset, GetDevice(device)));
           });
     c.def(py::pickle(
@@ -216,11 +323,17 @@ void InitChainerxArray(pybind11::module& m) {
     });
     c.def("view", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.MakeView()); });
     c.def("__repr__", [](const ArrayBodyPtr& self) { return Array{self}.ToString(); });
-    c.def("to_device", [](const ArrayBodyPtr& self, py::handle device) { return MoveArrayBody(Array{self}.ToDevice(GetDevice(device))); });
-    c.def("to_device", [](const ArrayBodyPtr& self, const std::string& backend_name, int index) {
-        Device& device = GetDefaultContext().GetDevice({backend_name, index});
-        return MoveArrayBody(Array{self}.ToDevice(device));
+    c.def("to_device", [](const ArrayBodyPtr& self, py::handle device) {
+        Device& dst_device = GetDevice(device);
+        py::gil_scoped_release release;
+        return MoveArrayBody(Array{self}.ToDevice(dst_device));
     });
+    c.def("to_device",
+          [](const ArrayBodyPtr& self, const std::string& backend_name, int index) {
+              Device& device = GetDefaultContext().GetDevice({backend_name, index});
+              return MoveArrayBody(Array{self}.ToDevice(device));
+          },
+          py::call_guard<py::gil_scoped_release>());
     c.def("as_grad_stopped",
           [](const ArrayBodyPtr& self, bool copy) {
               return MoveArrayBody(Array{self}.AsGradStopped(copy ? CopyKind::kCopy : CopyKind::kView));
@@ -233,28 +346,23 @@ void InitChainerxArray(pybind11::module& m) {
           py::arg().noconvert(),
           "copy"_a = false);
     c.def("astype",
-          [](const ArrayBodyPtr& self, py::handle dtype, bool copy) { return MoveArrayBody(Array{self}.AsType(GetDtype(dtype), copy)); },
+          [](const ArrayBodyPtr& self, py::handle dtype, bool copy) {
+              Dtype out_dtype = GetDtype(dtype);
+              py::gil_scoped_release release;
+              return MoveArrayBody(Array{self}.AsType(out_dtype, copy));
+          },
           "dtype"_a,
           "copy"_a = true);
-    c.def("copy", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.Copy()); });
+    c.def("copy", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.Copy()); }, py::call_guard<py::gil_scoped_release>());
     c.def("__getitem__", [](const ArrayBodyPtr& self, py::handle key) { return MoveArrayBody(Array{self}.At(MakeArrayIndices(key))); });
     c.def("take",
           [](const ArrayBodyPtr& self, py::handle indices, const nonstd::optional<int8_t>& axis) {
               if (!axis.has_value()) {
                   throw NotImplementedError{"axis=None is not yet supported for chainerx.ndarray.take."};
               }
-              if (py::isinstance<ArrayBody>(indices)) {
-                  return MoveArrayBody(Array{self}.Take(Array{py::cast<ArrayBodyPtr>(indices)}, axis.value()));
-              }
-              if (py::isinstance<py::sequence>(indices)) {
-                  nonstd::optional<Dtype> dtype = Dtype::kInt64;
-                  return MoveArrayBody(Array{self}.Take(Array{MakeArray(indices, dtype, false, self->device())}, axis.value()));
-              }
-              if (py::isinstance<py::array>(indices)) {
-                  return MoveArrayBody(
-                          Array{self}.Take(Array{MakeArrayFromNumpyArray(py::cast<py::array>(indices), self->device())}, axis.value()));
-              }
-              throw py::type_error{"only integers, slices (`:`), sequence, numpy.ndarray and chainerx.newaxis (`None`) are valid indices"};
+              Array indices_array{MakeTakeIndicesArray(indices, self->device())};
+              py::gil_scoped_release release;
+              return MoveArrayBody(Array{self}.Take(indices_array, axis.value()));
           },
           "indices"_a,
           "axis"_a = nullptr);
@@ -264,14 +372,14 @@ void InitChainerxArray(pybind11::module& m) {
           },
           "axes"_a = nullptr);
     c.def("transpose", [](const ArrayBodyPtr& self, py::args args) { return MoveArrayBody(Array{self}.Transpose(ToAxes(args))); });
-    c.def("reshape", [](const ArrayBodyPtr& self, py::handle shape) { return MoveArrayBody(Array{self}.Reshape(ToShape(shape))); });
-    c.def("reshape", [](const ArrayBodyPtr& self, const std::vector<int64_t>& shape) {
-        return MoveArrayBody(Array{self}.Reshape({shape.begin(), shape.end()}));
-    });
+    // A single binding for both reshape(shape) and reshape(*shape) to avoid overload resolution.
     c.def("reshape", [](const ArrayBodyPtr& self, py::args args) {
         if (args.size() == 0) {
             throw ChainerxError("Reshape takes exactly 1 argument (0 given).");
         }
+        if (args.size() == 1) {
+            return MoveArrayBody(Array{self}.Reshape(ToShape(args[0])));
+        }
         return MoveArrayBody(Array{self}.Reshape(ToShape(args)));
     });
     c.def("squeeze",
@@ -385,9 +493,10 @@ void InitChainerxArray(pybind11::module& m) {
           py::is_operator());
     c.def("__ixor__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(std::move(Array{self} ^= rhs)); }, py::is_operator());
     c.def("__add__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} + Array{rhs}); },
+          [](const ArrayBodyPtr& self, py::handle rhs) {
+              return ApplyBinaryOperator(self, rhs, [](const Array& a, const auto& b) { return a + b; });
+          },
           py::is_operator());
-    c.def("__add__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} + rhs); }, py::is_operator());
     c.def("__radd__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(lhs + Array{self}); }, py::is_operator());
     c.def("__sub__",
           [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} - Array{rhs}); },
@@ -395,9 +504,10 @@ void InitChainerxArray(pybind11::module& m) {
     c.def("__sub__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} - rhs); }, py::is_operator());
     c.def("__rsub__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(lhs - Array{self}); }, py::is_operator());
     c.def("__mul__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} * Array{rhs}); },
+          [](const ArrayBodyPtr& self, py::handle rhs) {
+              return ApplyBinaryOperator(self, rhs, [](const Array& a, const auto& b) { return a * b; });
+          },
           py::is_operator());
-    c.def("__mul__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} * rhs); }, py::is_operator());
     c.def("__rmul__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(lhs * Array{self}); }, py::is_operator());
     c.def("__floordiv__",
           [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(FloorDivide(Array{self}, Array{rhs})); },
@@ -435,55 +545,61 @@ void InitChainerxArray(pybind11::module& m) {
     c.def("__xor__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} ^ rhs); }, py::is_operator());
     c.def("__rxor__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(Array{self} ^ lhs); }, py::is_operator());
     c.def("sum",
-          [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Sum(Axes{axis}, keepdims)); },
-          "axis"_a,
-          "keepdims"_a = false);
-    c.def("sum",
-          [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
-              return MoveArrayBody(Array{self}.Sum(ToAxes(axis), keepdims));
+          [](const ArrayBodyPtr& self, py::handle axis, bool keepdims) {
+              OptionalAxes axes = ToReductionAxes(axis);
+              py::gil_scoped_release release;
+              return MoveArrayBody(Array{self}.Sum(axes, keepdims));
           },
           "axis"_a = nullptr,
           "keepdims"_a = false);
     c.def("max",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Max(Axes{axis}, keepdims)); },
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("max",
           [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Array{self}.Max(ToAxes(axis), keepdims));
           },
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("min",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Min(Axes{axis}, keepdims)); },
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("min",
           [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Array{self}.Min(ToAxes(axis), keepdims));
           },
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("mean",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Mean(Axes{axis}, keepdims)); },
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("mean",
           [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Array{self}.Mean(ToAxes(axis), keepdims));
           },
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("var",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Var(Axes{axis}, keepdims)); },
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("var",
           [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Array{self}.Var(ToAxes(axis), keepdims));
           },
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("all",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.All(Axes{axis}, keepdims)); },
           "axis"_a,
@@ -506,17 +622,23 @@ void InitChainerxArray(pybind11::module& m) {
           "keepdims"_a = false);
     c.def("argmax",
           [](const ArrayBodyPtr& self, const nonstd::optional<int8_t>& axis) { return MoveArrayBody(ArgMax(Array{self}, ToAxes(axis))); },
-          "axis"_a = nullptr);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
     c.def("argmin",
           [](const ArrayBodyPtr& self, const nonstd::optional<int8_t>& axis) { return MoveArrayBody(ArgMin(Array{self}, ToAxes(axis))); },
-          "axis"_a = nullptr);
-    c.def("dot", [](const ArrayBodyPtr& self, const ArrayBodyPtr& b) { return MoveArrayBody(Array{self}.Dot(Array{b})); }, "b"_a);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
+    c.def("dot",
+          [](const ArrayBodyPtr& self, const ArrayBodyPtr& b) { return MoveArrayBody(Array{self}.Dot(Array{b})); },
+          "b"_a,
+          py::call_guard<py::gil_scoped_release>());
     c.def("fill",
           [](const ArrayBodyPtr& self, Scalar value) {
               Array{self}.Fill(value);
               return;
           },
-          "value"_a);
+          "value"_a,
+          py::call_guard<py::gil_scoped_release>());
 
     c.def("require_grad",
           [](const ArrayBodyPtr& self, const nonstd::optional<BackpropId>& backprop_id) {
@@ -560,7 +682,8 @@ void InitChainerxArray(pybind11::module& m) {
               Backward(Array{self}, backprop_id, double_backprop);
           },
           "backprop_id"_a = nullptr,
-          "enable_double_backprop"_a = false);
+          "enable_double_backprop"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     c.def("_debug_dump_computational_graph",
           [](const ArrayBodyPtr& self, const nonstd::optional<BackpropId>& backprop_id) {
               DebugDumpComputationalGraph(std::cout, Array{self}, backprop_id);
@@ -626,7 +749,7 @@ void InitChainerxArray(pybind11::module& m) {
 
             for (auto it = indexer.It(0); it; ++it) {
                 T value = native::StorageToDataType<const T>(iarray[it]);
-                if (std::is_same<T, chainerx::Float16>::value) {
+                if (std::is_same<T, chainerx::Float16>::value || std::is_same<T, chainerx::BFloat16>::value) {
                     list.append(static_cast<double>(value));
                 } else {
                     list.append(value);
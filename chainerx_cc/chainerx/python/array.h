@@ -29,6 +29,13 @@ ArrayBodyPtr MakeArray(pybind11::handle object, const nonstd::optional<Dtype>& d
 // Makes an array from a NumPy array. Shape, dtype, strides will be kept.
 ArrayBodyPtr MakeArrayFromNumpyArray(pybind11::array array, Device& device);
 
+// Makes an array of indices for take from a chainerx.ndarray, a sequence or a NumPy array.
+ArrayBodyPtr MakeTakeIndicesArray(pybind11::handle indices, Device& device);
+
+// Makes a data pointer which refers to the memory owned by a Python object, keeping the object alive.
+// The reference to the object is released with the GIL acquired, so that arrays may be released while the GIL is released.
+std::shared_ptr<void> MakeDataOwnedByPyObject(void* ptr, pybind11::object owner);
+
 void InitChainerxArray(pybind11::module& m);
 
 }  // namespace python_internal
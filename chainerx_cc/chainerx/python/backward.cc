@@ -46,7 +46,8 @@ void InitChainerxBackward(pybind11::module& m) {
           },
           py::arg(),
           "backprop_id"_a = nullptr,
-          "enable_double_backprop"_a = false);
+          "enable_double_backprop"_a = false,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("backward",
           [](const std::vector<ArrayBodyPtr>& outputs, const nonstd::optional<BackpropId>& backprop_id, bool enable_double_backprop) {
@@ -56,7 +57,8 @@ void InitChainerxBackward(pybind11::module& m) {
           },
           py::arg(),
           "backprop_id"_a = nullptr,
-          "enable_double_backprop"_a = false);
+          "enable_double_backprop"_a = false,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("grad",
           [](const std::vector<ArrayBodyPtr>& outputs,
@@ -76,7 +78,8 @@ void InitChainerxBackward(pybind11::module& m) {
           py::arg(),  // outputs
           py::arg(),  // inputs
           "backprop_id"_a = nullptr,
-          "enable_double_backprop"_a = false);
+          "enable_double_backprop"_a = false,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace python_internal
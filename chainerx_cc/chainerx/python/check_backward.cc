@@ -48,7 +48,9 @@ void InitChainerxCheckBackward(pybind11::module& m) {
              const std::vector<ArrayBodyPtr>& eps,
              double atol,
              double rtol,
-             const nonstd::optional<BackpropId>& backprop_id) {
+             const nonstd::optional<BackpropId>& backprop_id,
+             bool elementwise,
+             bool parallel) {
               py::gil_scoped_release release;
               CheckBackward(
                       ForwardInPython{func},
@@ -58,7 +60,9 @@ void InitChainerxCheckBackward(pybind11::module& m) {
                       2,
                       atol,
                       rtol,
-                      backprop_id);
+                      backprop_id,
+                      elementwise,
+                      parallel);
           },
           "func"_a,
           "inputs"_a,
@@ -66,7 +70,9 @@ void InitChainerxCheckBackward(pybind11::module& m) {
           "eps"_a,
           "atol"_a = 1e-5,
           "rtol"_a = 1e-4,
-          "backprop_id"_a = nullptr);
+          "backprop_id"_a = nullptr,
+          "elementwise"_a = false,
+          "parallel"_a = false);
 
     m.def("check_double_backward",
           [](py::object func,
@@ -76,7 +82,9 @@ void InitChainerxCheckBackward(pybind11::module& m) {
              const std::vector<ArrayBodyPtr>& eps,
              double atol,
              double rtol,
-             const nonstd::optional<BackpropId>& backprop_id) {
+             const nonstd::optional<BackpropId>& backprop_id,
+             bool elementwise,
+             bool parallel) {
               py::gil_scoped_release release;
               CheckDoubleBackwardComputation(
                       ForwardInPython{func},
@@ -87,7 +95,9 @@ void InitChainerxCheckBackward(pybind11::module& m) {
                       2,
                       atol,
                       rtol,
-                      backprop_id);
+                      backprop_id,
+                      elementwise,
+                      parallel);
           },
           "func"_a,
           "inputs"_a,
@@ -96,7 +106,9 @@ void InitChainerxCheckBackward(pybind11::module& m) {
           "eps"_a,
           "atol"_a = 1e-5,
           "rtol"_a = 1e-4,
-          "backprop_id"_a = nullptr);
+          "backprop_id"_a = nullptr,
+          "elementwise"_a = false,
+          "parallel"_a = false);
 }
 
 }  // namespace python_internal
@@ -1,10 +1,12 @@
 #include "chainerx/python/dtype.h"
 
+#include <exception>
 #include <string>
 
 #include <pybind11/numpy.h>
 
 #include "chainerx/dtype.h"
+#include "chainerx/error.h"
 #include "chainerx/scalar.h"
 
 #include "chainerx/macro.h"
@@ -17,6 +19,13 @@ namespace python_internal {
 
 namespace py = pybind11;  // standard convention
 
+namespace {
+
+// Python dtype object of bfloat16, used in place of the NumPy dtype when the ml_dtypes package is not installed.
+class PyBFloat16Dtype {};
+
+}  // namespace
+
 Dtype GetDtypeFromString(const std::string& name) {
     // From Python type names
     if (name == "bool") {
@@ -78,6 +87,12 @@ Dtype GetDtypeFromNumpyDtype(const py::dtype& npdtype) {
                     break;
             }
             break;
+        case 'V':
+            // NumPy has no bfloat16. ml_dtypes registers it as a void-kind dtype.
+            if (npdtype.itemsize() == 2 && py::cast<std::string>(npdtype.attr("name")) == "bfloat16") {
+                return Dtype::kBFloat16;
+            }
+            break;
         default:
             break;
     }
@@ -141,6 +156,15 @@ Dtype GetDtype(py::handle handle) {
         return Dtype::kFloat64;
     }
 
+    // From bfloat16 objects, which NumPy does not provide
+    if (py::isinstance<PyBFloat16Dtype>(handle)) {
+        return Dtype::kBFloat16;
+    }
+    py::handle ml_dtypes_bfloat16 = GetCachedMlDtypesBFloat16();
+    if (!ml_dtypes_bfloat16.is_none() && handle.is(ml_dtypes_bfloat16)) {
+        return Dtype::kBFloat16;
+    }
+
     throw py::type_error{"Dtype not understood: " + py::cast<std::string>(py::repr(handle))};
 }
 
@@ -164,11 +188,21 @@ py::object GetNumpyDtypeFromModule(const py::module& m, Dtype dtype) {
             return m.attr("_float32");
         case Dtype::kFloat64:
             return m.attr("_float64");
+        case Dtype::kBFloat16:
+            return m.attr("_bfloat16");
         default:
             CHAINERX_NEVER_REACH();
     }
 }
 
+py::dtype GetConvertibleNumpyDtypeFromModule(const py::module& m, Dtype dtype) {
+    py::object npdtype = GetNumpyDtypeFromModule(m, dtype);
+    if (!py::isinstance<py::dtype>(npdtype)) {
+        throw DtypeError{"bfloat16 arrays cannot be converted to NumPy arrays unless the ml_dtypes package is installed"};
+    }
+    return py::reinterpret_borrow<py::dtype>(npdtype);
+}
+
 void InitChainerxDtype(py::module& m) {
     // Store cached py::dtype objects directly in the core module to optimize the ChainerX dtype to NumPy dtype conversions.
     // This improves the performance of e.g. accessing ndarray.dtype.
@@ -181,6 +215,32 @@ void InitChainerxDtype(py::module& m) {
     m.attr("_float16") = py::dtype{"float16"};
     m.attr("_float32") = py::dtype{"float32"};
     m.attr("_float64") = py::dtype{"float64"};
+
+    // NumPy has no bfloat16. The dtype registered by ml_dtypes is used if it is installed, and otherwise a dtype object of ChainerX which
+    // only supports identifying the dtype.
+    py::class_<PyBFloat16Dtype> c{m, "_BFloat16Dtype"};
+    c.def_property_readonly("name", [](const PyBFloat16Dtype& /*self*/) { return GetDtypeName(Dtype::kBFloat16); });
+    c.def_property_readonly("itemsize", [](const PyBFloat16Dtype& /*self*/) { return GetItemSize(Dtype::kBFloat16); });
+    c.def_property_readonly("kind", [](const PyBFloat16Dtype& /*self*/) { return "V"; });
+    c.def("__eq__", [](const PyBFloat16Dtype& /*self*/, py::handle other) {
+        try {
+            return GetDtype(other) == Dtype::kBFloat16;
+        } catch (const std::exception&) {
+            return false;
+        }
+    });
+    c.def("__hash__", [](const PyBFloat16Dtype& /*self*/) { return py::hash(py::str{GetDtypeName(Dtype::kBFloat16)}); });
+    c.def("__repr__", [](const PyBFloat16Dtype& /*self*/) { return std::string{"dtype('"} + GetDtypeName(Dtype::kBFloat16) + "')"; });
+    c.def("__str__", [](const PyBFloat16Dtype& /*self*/) { return GetDtypeName(Dtype::kBFloat16); });
+
+    py::handle ml_dtypes_bfloat16 = GetCachedMlDtypesBFloat16();
+    if (ml_dtypes_bfloat16.is_none()) {
+        m.attr("_bfloat16") = PyBFloat16Dtype{};
+        m.attr("bfloat16") = m.attr("_bfloat16");
+    } else {
+        m.attr("_bfloat16") = py::dtype::from_args(py::reinterpret_borrow<py::object>(ml_dtypes_bfloat16));
+        m.attr("bfloat16") = ml_dtypes_bfloat16;
+    }
 }
 
 }  // namespace python_internal
@@ -17,8 +17,12 @@ Dtype GetDtypeFromNumpyDtype(const pybind11::dtype& npdtype);
 
 Dtype GetDtype(pybind11::handle handle);
 
+// Returns the dtype object of the Python binding, which is a NumPy dtype except for bfloat16 without the ml_dtypes package.
 pybind11::object GetNumpyDtypeFromModule(const pybind11::module& m, Dtype dtype);
 
+// Returns the NumPy dtype to convert arrays to NumPy or CuPy arrays with. Throws DtypeError if there is none.
+pybind11::dtype GetConvertibleNumpyDtypeFromModule(const pybind11::module& m, Dtype dtype);
+
 void InitChainerxDtype(pybind11::module& m);
 
 }  // namespace python_internal
@@ -35,6 +35,18 @@ inline py::handle GetCachedNumpyBool() {
     return ret;
 }
 
+// Returns the bfloat16 scalar type of ml_dtypes, or None if the package is not installed.
+inline py::handle GetCachedMlDtypesBFloat16() {
+    static py::handle ret = []() -> py::handle {
+        try {
+            return py::module::import("ml_dtypes").attr("bfloat16").release();
+        } catch (const py::error_already_set&) {
+            return py::none().release();
+        }
+    }();
+    return ret;
+}
+
 inline py::handle GetCachedCupyModule() {
     static py::handle ret = py::module::import("cupy");
     return ret;
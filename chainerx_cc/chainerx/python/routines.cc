@@ -32,6 +32,7 @@
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/misc.h"
 #include "chainerx/routines/normalization.h"
+#include "chainerx/routines/optimizer.h"
 #include "chainerx/routines/pooling.h"
 #include "chainerx/routines/reduction.h"
 #include "chainerx/routines/rounding.h"
@@ -225,7 +226,7 @@ void InitChainerxCreation(pybind11::module& m) {
           [](const ArrayBodyPtr& a, py::handle device) { return MoveArrayBody(OnesLike(Array{a}, GetDevice(device))); },
           "a"_a,
           "device"_a = nullptr);
-    m.def("copy", [](const ArrayBodyPtr& a) { return MoveArrayBody(Copy(Array{a})); }, "a"_a);
+    m.def("copy", [](const ArrayBodyPtr& a) { return MoveArrayBody(Copy(Array{a})); }, "a"_a, py::call_guard<py::gil_scoped_release>());
     m.def("frombuffer", &MakeArrayFromBuffer, "buffer"_a, "dtype"_a = "float32", "count"_a = -1, "offset"_a = 0, "device"_a = nullptr);
     m.def("identity",
           [](int64_t n, py::handle dtype, py::handle device) {
@@ -281,18 +282,9 @@ void InitChainerxIndexing(pybind11::module& m) {
               if (!axis.has_value()) {
                   throw NotImplementedError{"axis=None is not yet supported for chainerx.take."};
               }
-              if (py::isinstance<ArrayBody>(indices)) {
-                  return MoveArrayBody(Take(Array{a}, Array{py::cast<ArrayBodyPtr>(indices)}, axis.value()));
-              }
-              if (py::isinstance<py::sequence>(indices)) {
-                  nonstd::optional<Dtype> dtype = Dtype::kInt64;
-                  return MoveArrayBody(Take(Array{a}, Array{MakeArray(indices, dtype, false, a->device())}, axis.value()));
-              }
-              if (py::isinstance<py::array>(indices)) {
-                  return MoveArrayBody(
-                          Take(Array{a}, Array{MakeArrayFromNumpyArray(py::cast<py::array>(indices), a->device())}, axis.value()));
-              }
-              throw py::type_error{"only integers, slices (`:`), sequence, numpy.ndarray and chainerx.newaxis (`None`) are valid indices"};
+              Array indices_array{MakeTakeIndicesArray(indices, a->device())};
+              py::gil_scoped_release release;
+              return MoveArrayBody(Take(Array{a}, indices_array, axis.value()));
           },
           "a"_a,
           "indices"_a,
@@ -327,7 +319,11 @@ void InitChainerxIndexing(pybind11::module& m) {
 
 void InitChainerxLinalg(pybind11::module& m) {
     // linalg routines
-    m.def("dot", [](const ArrayBodyPtr& a, const ArrayBodyPtr& b) { return MoveArrayBody(Dot(Array{a}, Array{b})); }, "a"_a, "b"_a);
+    m.def("dot",
+          [](const ArrayBodyPtr& a, const ArrayBodyPtr& b) { return MoveArrayBody(Dot(Array{a}, Array{b})); },
+          "a"_a,
+          "b"_a,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void InitChainerxLogic(pybind11::module& m) {
@@ -463,6 +459,7 @@ void InitChainerxManipulation(pybind11::module& m) {
               std::transform(arrays.begin(), arrays.end(), std::back_inserter(xs), [](const auto& item) {
                   return Array{py::cast<ArrayBodyPtr>(item)};
               });
+              py::gil_scoped_release release;
               return MoveArrayBody(Concatenate(xs, axis));
           },
           "arrays"_a,
@@ -474,6 +471,7 @@ void InitChainerxManipulation(pybind11::module& m) {
               std::transform(arrays.begin(), arrays.end(), std::back_inserter(xs), [](const auto& item) {
                   return Array{py::cast<ArrayBodyPtr>(item)};
               });
+              py::gil_scoped_release release;
               return MoveArrayBody(Stack(xs, axis));
           },
           "arrays"_a,
@@ -737,43 +735,54 @@ void InitChainerxReduction(pybind11::module& m) {
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Sum(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("sum",
           [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Sum(Array{a}, ToAxes(axis), keepdims));
           },
           "a"_a,
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("logsumexp",
           [](const ArrayBodyPtr& x, int8_t axis, bool keepdims) { return MoveArrayBody(LogSumExp(Array{x}, Axes{axis}, keepdims)); },
           "x"_a,
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("logsumexp",
           [](const ArrayBodyPtr& x, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(LogSumExp(Array{x}, ToAxes(axis), keepdims));
           },
           "x"_a,
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("log_softmax",
           [](const ArrayBodyPtr& x, int8_t axis) { return MoveArrayBody(LogSoftmax(Array{x}, Axes{axis})); },
           "x"_a,
-          "axis"_a);
+          "axis"_a,
+          py::call_guard<py::gil_scoped_release>());
     m.def("log_softmax",
           [](const ArrayBodyPtr& x, const nonstd::optional<std::vector<int8_t>>& axis) {
               return MoveArrayBody(LogSoftmax(Array{x}, ToAxes(axis)));
           },
           "x"_a,
-          "axis"_a = nullptr);
-    m.def("softmax", [](const ArrayBodyPtr& x, int8_t axis) { return MoveArrayBody(Softmax(Array{x}, Axes{axis})); }, "x"_a, "axis"_a);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("softmax",
+          [](const ArrayBodyPtr& x, int8_t axis) { return MoveArrayBody(Softmax(Array{x}, Axes{axis})); },
+          "x"_a,
+          "axis"_a,
+          py::call_guard<py::gil_scoped_release>());
     m.def("softmax",
           [](const ArrayBodyPtr& x, const nonstd::optional<std::vector<int8_t>>& axis) {
               return MoveArrayBody(Softmax(Array{x}, ToAxes(axis)));
           },
           "x"_a,
-          "axis"_a = nullptr);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void InitChainerxRounding(pybind11::module& m) {
@@ -799,11 +808,13 @@ void InitChainerxSorting(pybind11::module& m) {
     m.def("argmax",
           [](const ArrayBodyPtr& a, const nonstd::optional<int8_t>& axis) { return MoveArrayBody(ArgMax(Array{a}, ToAxes(axis))); },
           "a"_a,
-          "axis"_a = nullptr);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
     m.def("argmin",
           [](const ArrayBodyPtr& a, const nonstd::optional<int8_t>& axis) { return MoveArrayBody(ArgMin(Array{a}, ToAxes(axis))); },
           "a"_a,
-          "axis"_a = nullptr);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void InitChainerxStatistics(pybind11::module& m) {
@@ -812,52 +823,60 @@ void InitChainerxStatistics(pybind11::module& m) {
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(AMax(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("amax",
           [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(AMax(Array{a}, ToAxes(axis), keepdims));
           },
           "a"_a,
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.attr("max") = m.attr("amax");
     m.def("amin",
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(AMin(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("amin",
           [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(AMin(Array{a}, ToAxes(axis), keepdims));
           },
           "a"_a,
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.attr("min") = m.attr("amin");
     m.def("mean",
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Mean(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("mean",
           [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Mean(Array{a}, ToAxes(axis), keepdims));
           },
           "a"_a,
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("var",
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Var(Array{a}, Axes{axis}, keepdims)); },
           "a"_a,
           "axis"_a,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
     m.def("var",
           [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Var(Array{a}, ToAxes(axis), keepdims));
           },
           "a"_a,
           "axis"_a = nullptr,
-          "keepdims"_a = false);
+          "keepdims"_a = false,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void InitChainerxConnection(pybind11::module& m) {
@@ -872,13 +891,11 @@ void InitChainerxConnection(pybind11::module& m) {
               // Create an Array from x to compute the image dimensions and the expected number of stride and padding elements.
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
-              return MoveArrayBody(
-                      Conv(x_array,
-                           Array{w},
-                           b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt,
-                           ToStackVector<int64_t>(stride, ndim),
-                           ToStackVector<int64_t>(pad, ndim),
-                           cover_all));
+              Dims stride_dims = ToStackVector<int64_t>(stride, ndim);
+              Dims pad_dims = ToStackVector<int64_t>(pad, ndim);
+              nonstd::optional<Array> b_array = b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt;
+              py::gil_scoped_release release;
+              return MoveArrayBody(Conv(x_array, Array{w}, b_array, stride_dims, pad_dims, cover_all));
           },
           "x"_a,
           "w"_a,
@@ -896,13 +913,15 @@ void InitChainerxConnection(pybind11::module& m) {
               // Create an Array from x to compute the image dimensions and the expected number of stride and padding elements.
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
-              return MoveArrayBody(ConvTranspose(
-                      x_array,
-                      Array{w},
-                      b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt,
-                      ToStackVector<int64_t>(stride, ndim),
-                      ToStackVector<int64_t>(pad, ndim),
-                      outsize.has_value() ? nonstd::optional<Dims>{ToStackVector<int64_t>(*outsize, ndim)} : nonstd::nullopt));
+              Dims stride_dims = ToStackVector<int64_t>(stride, ndim);
+              Dims pad_dims = ToStackVector<int64_t>(pad, ndim);
+              nonstd::optional<Dims> out_size{};
+              if (outsize.has_value()) {
+                  out_size = ToStackVector<int64_t>(*outsize, ndim);
+              }
+              nonstd::optional<Array> b_array = b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt;
+              py::gil_scoped_release release;
+              return MoveArrayBody(ConvTranspose(x_array, Array{w}, b_array, stride_dims, pad_dims, out_size));
           },
           "x"_a,
           "w"_a,
@@ -918,7 +937,8 @@ void InitChainerxConnection(pybind11::module& m) {
           "x"_a,
           "w"_a,
           "b"_a = nullptr,
-          "n_batch_axes"_a = 1);
+          "n_batch_axes"_a = 1,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void InitChainerxNormalization(pybind11::module& m) {
@@ -942,7 +962,8 @@ void InitChainerxNormalization(pybind11::module& m) {
           "running_var"_a,
           "eps"_a = 2e-5,
           "decay"_a = 0.9,
-          "axis"_a = nullptr);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
     m.def("fixed_batch_norm",
           [](const ArrayBodyPtr& x,
              const ArrayBodyPtr& gamma,
@@ -959,7 +980,8 @@ void InitChainerxNormalization(pybind11::module& m) {
           "mean"_a,
           "var"_a,
           "eps"_a = 2e-5,
-          "axis"_a = nullptr);
+          "axis"_a = nullptr,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 void InitChainerxPooling(pybind11::module& m) {
@@ -969,12 +991,11 @@ void InitChainerxPooling(pybind11::module& m) {
           [](const ArrayBodyPtr& x, py::handle ksize, py::handle stride, py::handle pad, bool cover_all) {
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
-              return MoveArrayBody(
-                      MaxPool(x_array,
-                              ToStackVector<int64_t>(ksize, ndim),
-                              stride.is_none() ? ToStackVector<int64_t>(ksize, ndim) : ToStackVector<int64_t>(stride, ndim),
-                              ToStackVector<int64_t>(pad, ndim),
-                              cover_all));
+              Dims ksize_dims = ToStackVector<int64_t>(ksize, ndim);
+              Dims stride_dims = stride.is_none() ? ksize_dims : ToStackVector<int64_t>(stride, ndim);
+              Dims pad_dims = ToStackVector<int64_t>(pad, ndim);
+              py::gil_scoped_release release;
+              return MoveArrayBody(MaxPool(x_array, ksize_dims, stride_dims, pad_dims, cover_all));
           },
           "x"_a,
           "ksize"_a,
@@ -995,12 +1016,11 @@ void InitChainerxPooling(pybind11::module& m) {
                   throw py::value_error{"pad_mode must be either of 'zero' or 'ignore'"};
               }
 
-              return MoveArrayBody(AveragePool(
-                      x_array,
-                      ToStackVector<int64_t>(ksize, ndim),
-                      stride.is_none() ? ToStackVector<int64_t>(ksize, ndim) : ToStackVector<int64_t>(stride, ndim),
-                      ToStackVector<int64_t>(pad, ndim),
-                      mode));
+              Dims ksize_dims = ToStackVector<int64_t>(ksize, ndim);
+              Dims stride_dims = stride.is_none() ? ksize_dims : ToStackVector<int64_t>(stride, ndim);
+              Dims pad_dims = ToStackVector<int64_t>(pad, ndim);
+              py::gil_scoped_release release;
+              return MoveArrayBody(AveragePool(x_array, ksize_dims, stride_dims, pad_dims, mode));
           },
           "x"_a,
           "ksize"_a,
@@ -1009,28 +1029,103 @@ void InitChainerxPooling(pybind11::module& m) {
           "pad_mode"_a = "ignore");
 }
 
+// Converts a list of ndarrays given to an update of optimizers.
+std::vector<Array> ToArrays(const std::vector<ArrayBodyPtr>& array_bodies) {
+    std::vector<Array> arrays;
+    arrays.reserve(array_bodies.size());
+    for (const ArrayBodyPtr& body : array_bodies) {
+        arrays.emplace_back(body);
+    }
+    return arrays;
+}
+
+void InitChainerxOptimizer(pybind11::module& m) {
+    // update rules of optimizers
+    m.def("sgd_update",
+          [](const std::vector<ArrayBodyPtr>& params, const std::vector<ArrayBodyPtr>& grads, Scalar lr) {
+              SgdUpdate(ToArrays(params), ToArrays(grads), lr);
+          },
+          "params"_a,
+          "grads"_a,
+          "lr"_a,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("momentum_sgd_update",
+          [](const std::vector<ArrayBodyPtr>& params,
+             const std::vector<ArrayBodyPtr>& grads,
+             const std::vector<ArrayBodyPtr>& velocities,
+             Scalar lr,
+             Scalar momentum) {
+              MomentumSgdUpdate(ToArrays(params), ToArrays(grads), ToArrays(velocities), lr, momentum);
+          },
+          "params"_a,
+          "grads"_a,
+          "velocities"_a,
+          "lr"_a,
+          "momentum"_a,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("adam_update",
+          [](const std::vector<ArrayBodyPtr>& params,
+             const std::vector<ArrayBodyPtr>& grads,
+             const std::vector<ArrayBodyPtr>& ms,
+             const std::vector<ArrayBodyPtr>& vs,
+             int64_t t,
+             Scalar alpha,
+             Scalar beta1,
+             Scalar beta2,
+             Scalar eps,
+             Scalar weight_decay_rate) {
+              AdamUpdate(ToArrays(params), ToArrays(grads), ToArrays(ms), ToArrays(vs), t, alpha, beta1, beta2, eps, weight_decay_rate);
+          },
+          "params"_a,
+          "grads"_a,
+          "ms"_a,
+          "vs"_a,
+          "t"_a,
+          "alpha"_a = 0.001,
+          "beta1"_a = 0.9,
+          "beta2"_a = 0.999,
+          "eps"_a = 1e-8,
+          "weight_decay_rate"_a = 0.0,
+          py::call_guard<py::gil_scoped_release>());
+}
+
 void InitChainerxLoss(pybind11::module& m) {
     m.def("absolute_error",
           [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(AbsoluteError(Array{x1}, Array{x2})); },
           "x1"_a,
-          "x2"_a);
+          "x2"_a,
+          py::call_guard<py::gil_scoped_release>());
     m.def("squared_error",
           [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(SquaredError(Array{x1}, Array{x2})); },
           "x1"_a,
-          "x2"_a);
+          "x2"_a,
+          py::call_guard<py::gil_scoped_release>());
     m.def("gaussian_kl_divergence",
           [](const ArrayBodyPtr& mean, const ArrayBodyPtr& ln_var) {
               return MoveArrayBody(GaussianKLDivergence(Array{mean}, Array{ln_var}));
           },
           "mean"_a,
-          "ln_var"_a);
+          "ln_var"_a,
+          py::call_guard<py::gil_scoped_release>());
     m.def("huber_loss",
           [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, Scalar delta) {
               return MoveArrayBody(HuberLoss(Array{x1}, Array{x2}, delta));
           },
           "x1"_a,
           "x2"_a,
-          "delta"_a);
+          "delta"_a,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("softmax_cross_entropy",
+          [](const ArrayBodyPtr& x, const ArrayBodyPtr& t, const nonstd::optional<ArrayBodyPtr>& class_weight, int64_t ignore_label) {
+              nonstd::optional<Array> class_weight_array =
+                      class_weight.has_value() ? nonstd::optional<Array>{Array{*class_weight}} : nonstd::nullopt;
+              return MoveArrayBody(SoftmaxCrossEntropy(Array{x}, Array{t}, class_weight_array, ignore_label));
+          },
+          "x"_a,
+          "t"_a,
+          "class_weight"_a = nullptr,
+          "ignore_label"_a = -1,
+          py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace
@@ -1056,6 +1151,7 @@ void InitChainerxRoutines(pybind11::module& m) {
     InitChainerxConnection(m);
     InitChainerxNormalization(m);
     InitChainerxPooling(m);
+    InitChainerxOptimizer(m);
 }
 
 }  // namespace python_internal
@@ -4,8 +4,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <nonstd/optional.hpp>
+
+#include "chainerx/constant.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -14,7 +18,47 @@ namespace python_internal {
 
 namespace py = pybind11;
 
+namespace {
+
+// Converts a tuple of Python integers without going through the type casters of pybind11.
+// Returns nullopt if the tuple contains other objects or is too long, in which case the generic conversion should be used.
+nonstd::optional<Shape> TupleToShapeFast(py::handle tup) {
+    PyObject* ptr = tup.ptr();
+    Py_ssize_t size = PyTuple_GET_SIZE(ptr);
+    if (size > kMaxNdim) {
+        return nonstd::nullopt;
+    }
+    Shape shape{};
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject* item = PyTuple_GET_ITEM(ptr, i);
+        if (!PyLong_CheckExact(item)) {
+            return nonstd::nullopt;
+        }
+        int overflow{};
+        int64_t dim = PyLong_AsLongLongAndOverflow(item, &overflow);
+        if (overflow != 0) {
+            return nonstd::nullopt;
+        }
+        shape.emplace_back(dim);
+    }
+    return shape;
+}
+
+}  // namespace
+
 Shape ToShape(py::handle shape) {
+    if (PyTuple_CheckExact(shape.ptr())) {
+        if (nonstd::optional<Shape> result = TupleToShapeFast(shape)) {
+            return std::move(*result);
+        }
+    } else if (PyLong_CheckExact(shape.ptr())) {
+        int overflow{};
+        int64_t dim = PyLong_AsLongLongAndOverflow(shape.ptr(), &overflow);
+        if (overflow == 0) {
+            return Shape{dim};
+        }
+    }
+
     if (py::isinstance<py::sequence>(shape)) {
         std::vector<int64_t> seq{};
         try {
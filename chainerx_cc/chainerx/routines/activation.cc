@@ -37,6 +37,14 @@ Array Relu(const Array& x) {
     return Maximum(0, x_cast);
 }
 
+Array Relu(Array&& x) {
+    Dtype dtype = internal::GetMathResultDtype(x.dtype());
+    if (x.dtype() != dtype) {
+        return Maximum(0, x.AsType(dtype));
+    }
+    return Maximum(0, std::move(x));
+}
+
 Array LeakyRelu(const Array& x, Scalar slope) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
     const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
@@ -9,6 +9,9 @@ Array Sigmoid(const Array& x);
 
 Array Relu(const Array& x);
 
+// Overload for temporaries, which writes the output into the buffer of `x` if it is not shared and no graph is to be recorded.
+Array Relu(Array&& x);
+
 Array LeakyRelu(const Array& x, Scalar slope);
 
 }  // namespace chainerx
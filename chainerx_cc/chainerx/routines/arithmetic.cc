@@ -140,6 +140,16 @@ Array Add(const Array& x1, Scalar x2) { return internal::Binary(&AddASImpl, x1,
 
 Array Add(Scalar x1, const Array& x2) { return Add(x2, x1); }
 
+Array Add(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinary(&AddImpl, std::move(x1), x2, dtype);
+}
+
+Array Add(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::Binary(&AddASImpl, std::move(x1), x2, dtype);
+}
+
 void SubtractImpl(const Array& x1, const Array& x2, const Array& out) {
     CheckEqual(x1.shape(), x2.shape());
 
@@ -209,6 +219,16 @@ Array Subtract(Scalar x1, const Array& x2) {
     return Add(-x2, x1);
 }
 
+Array Subtract(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinary(&SubtractImpl, std::move(x1), x2, dtype);
+}
+
+Array Subtract(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::Binary(&SubtractASImpl, std::move(x1), x2, dtype);
+}
+
 void MultiplyImpl(const Array& x1, const Array& x2, const Array& out) {
     CheckEqual(x1.shape(), x2.shape());
 
@@ -272,6 +292,16 @@ Array Multiply(const Array& x1, Scalar x2) { return internal::Binary(&MultiplyAS
 
 Array Multiply(Scalar x1, const Array& x2) { return Multiply(x2, x1); }
 
+Array Multiply(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2, true);
+    return internal::BroadcastBinary(&MultiplyImpl, std::move(x1), x2, dtype);
+}
+
+Array Multiply(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2, true);
+    return internal::Binary(&MultiplyASImpl, std::move(x1), x2, dtype);
+}
+
 void FloorDivideImpl(const Array& x1, const Array& x2, const Array& out) {
     CheckEqual(x1.shape(), x2.shape());
 
@@ -417,12 +447,32 @@ Array TrueDivide(Scalar x1, const Array& x2) {
     return internal::Binary(&DivideSAImpl, x1, x2, dtype);
 }
 
+Array TrueDivide(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    if (GetKind(dtype) != DtypeKind::kFloat) {
+        dtype = internal::GetDefaultDtype(DtypeKind::kFloat);
+    }
+    return internal::BroadcastBinary(&DivideImpl, std::move(x1), x2, dtype);
+}
+
+Array TrueDivide(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    if (GetKind(dtype) != DtypeKind::kFloat) {
+        dtype = internal::GetDefaultDtype(DtypeKind::kFloat);
+    }
+    return internal::Binary(&DivideASImpl, std::move(x1), x2, dtype);
+}
+
 Array Divide(const Array& x1, const Array& x2) { return TrueDivide(x1, x2); }
 
 Array Divide(const Array& x1, Scalar x2) { return TrueDivide(x1, x2); }
 
 Array Divide(Scalar x1, const Array& x2) { return TrueDivide(x1, x2); }
 
+Array Divide(Array&& x1, const Array& x2) { return TrueDivide(std::move(x1), x2); }
+
+Array Divide(Array&& x1, Scalar x2) { return TrueDivide(std::move(x1), x2); }
+
 Array Reciprocal(const Array& x) { return Scalar{1, GetKind(x.dtype())} / x; }
 
 void PowerImpl(const Array& x1, const Array& x2, const Array& out) {
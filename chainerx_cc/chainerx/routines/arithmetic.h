@@ -22,6 +22,10 @@ Array Add(const Array& x1, const Array& x2);
 Array Add(const Array& x1, Scalar x2);
 Array Add(Scalar x1, const Array& x2);
 
+// Overloads for temporaries, which write the output into the buffer of `x1` if it is not shared and no graph is to be recorded.
+Array Add(Array&& x1, const Array& x2);
+Array Add(Array&& x1, Scalar x2);
+
 namespace internal {
 
 void ISubtract(const Array& x1, const Array& x2);
@@ -32,6 +36,8 @@ void ISubtract(const Array& x1, Scalar x2);
 Array Subtract(const Array& x1, const Array& x2);
 Array Subtract(const Array& x1, Scalar x2);
 Array Subtract(Scalar x1, const Array& x2);
+Array Subtract(Array&& x1, const Array& x2);
+Array Subtract(Array&& x1, Scalar x2);
 
 namespace internal {
 
@@ -43,6 +49,8 @@ void IMultiply(const Array& x1, Scalar x2);
 Array Multiply(const Array& x1, const Array& x2);
 Array Multiply(const Array& x1, Scalar x2);
 Array Multiply(Scalar x1, const Array& x2);
+Array Multiply(Array&& x1, const Array& x2);
+Array Multiply(Array&& x1, Scalar x2);
 
 namespace internal {
 
@@ -64,10 +72,14 @@ Array FloorDivide(Scalar x1, const Array& x2);
 Array Divide(const Array& x1, const Array& x2);
 Array Divide(const Array& x1, Scalar x2);
 Array Divide(Scalar x1, const Array& x2);
+Array Divide(Array&& x1, const Array& x2);
+Array Divide(Array&& x1, Scalar x2);
 
 Array TrueDivide(const Array& x1, const Array& x2);
 Array TrueDivide(const Array& x1, Scalar x2);
 Array TrueDivide(Scalar x1, const Array& x2);
+Array TrueDivide(Array&& x1, const Array& x2);
+Array TrueDivide(Array&& x1, Scalar x2);
 
 Array Reciprocal(const Array& x);
 
@@ -21,6 +21,7 @@
 #include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
+#include "chainerx/memory_format.h"
 #include "chainerx/routines/type_util.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -238,6 +239,31 @@ Array AsContiguous(const Array& a, Dtype dtype) {
     return out;
 }
 
+Array AsMemoryFormat(const Array& a, MemoryFormat format) {
+    if (format == MemoryFormat::kChannelsFirst) {
+        return AsContiguous(a);
+    }
+    if (GetMemoryFormat(a) == format) {
+        return a;
+    }
+
+    Array out = internal::Empty(a.shape(), a.dtype(), GetMemoryFormatStrides(a.shape(), a.dtype(), format), a.device());
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<CopyKernel>(a.AsGradStopped(), out);
+    }
+
+    {
+        BackwardBuilder bb{"asmemoryformat", a, out};
+        if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+            bt.Define([](BackwardContext& bctx) { bctx.input_grad() = *bctx.output_grad(); });
+        }
+        bb.Finalize();
+    }
+
+    return out;
+}
+
 Array AsContiguousArray(const Array& a, const nonstd::optional<Dtype>& dtype) {
     Dtype src_dt = a.dtype();
     Dtype dt = dtype.value_or(src_dt);
@@ -12,6 +12,7 @@
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/graph.h"
+#include "chainerx/memory_format.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
@@ -97,6 +98,10 @@ Array AsContiguous(const Array& a, Dtype dtype);
 // Returns a C-contiguous array with the same shape and dtype as the input array.
 inline Array AsContiguous(const Array& a) { return AsContiguous(a, a.dtype()); }
 
+// Returns a dense array in the memory format without changing input shape.
+// The input array is returned as it is if it is already in the memory format.
+Array AsMemoryFormat(const Array& a, MemoryFormat format);
+
 // Returns a C-contiguous array.
 // An input array with shape {} results in a new array with shape {1}.
 Array AsContiguousArray(const Array& a, const nonstd::optional<Dtype>& dtype = nonstd::nullopt);
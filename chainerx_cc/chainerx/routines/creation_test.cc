@@ -15,6 +15,7 @@
 #include "chainerx/device.h"
 #include "chainerx/device_id.h"
 #include "chainerx/dtype.h"
+#include "chainerx/memory_format.h"
 #include "chainerx/routines/type_util.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -794,6 +795,37 @@ TEST_THREAD_SAFE_P(CreationTest, AsContiguousArrayScalar) {
     });
 }
 
+TEST_THREAD_SAFE_P(CreationTest, AsMemoryFormat) {
+    Array a = testing::BuildArray({2, 3, 4, 5}).WithLinearData<float>();
+    ASSERT_EQ(MemoryFormat::kChannelsFirst, GetMemoryFormat(a));  // test precondition
+
+    Run([&]() {
+        testing::CheckForward(
+                [](const std::vector<Array>& xs) {
+                    Array y = AsMemoryFormat(xs[0], MemoryFormat::kChannelsLast);
+                    EXPECT_EQ(MemoryFormat::kChannelsLast, GetMemoryFormat(y));
+                    EXPECT_EQ(GetMemoryFormatStrides(y.shape(), y.dtype(), MemoryFormat::kChannelsLast), y.strides());
+
+                    // Converting to the same format does not copy.
+                    EXPECT_EQ(internal::GetArrayBody(y), internal::GetArrayBody(AsMemoryFormat(y, MemoryFormat::kChannelsLast)));
+
+                    Array z = AsMemoryFormat(y, MemoryFormat::kChannelsFirst);
+                    EXPECT_TRUE(z.IsContiguous());
+                    return std::vector<Array>{y, z};
+                },
+                {a},
+                {a, a});
+    });
+}
+
+TEST_P(CreationTest, AsMemoryFormatBackward) {
+    CheckBackward(
+            [](const std::vector<Array>& xs) -> std::vector<Array> { return {AsMemoryFormat(xs[0], MemoryFormat::kChannelsLast)}; },
+            {(*testing::BuildArray({2, 3, 2, 2}).WithLinearData<float>()).RequireGrad()},
+            {testing::BuildArray({2, 3, 2, 2}).WithLinearData<float>(-2.4f, 0.2f)},
+            {Full({2, 3, 2, 2}, 1e-1f)});
+}
+
 TEST_P(CreationTest, AsContiguousArrayBackward) {
     CheckBackward(
             [](const std::vector<Array>& xs) -> std::vector<Array> {
@@ -23,6 +23,7 @@
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/type_util.h"
+#include "chainerx/row_sparse_grad.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
 #include "chainerx/strides.h"
@@ -189,9 +190,13 @@ Array Take(const Array& a, const Array& indices, int8_t axis) {
         CHAINERX_ASSERT(internal::GetArrayBody(indices)->nodes().empty());
         bt.Define([indices, axis_norm, a_shape = a.shape()](BackwardContext& bctx) {
             const Array& gout = *bctx.output_grad();
-            // TODO(hvy): Reduce memory allocation for computing the input gradient, i.e. do not allocate a zero-filled array in addition to
-            // the output of `AddAt`.
-            bctx.input_grad() = AddAt(Zeros(a_shape, gout.dtype(), gout.device()), indices, axis_norm, gout);
+            if (bctx.next_required()) {
+                bctx.input_grad() = AddAt(Zeros(a_shape, gout.dtype(), gout.device()), indices, axis_norm, gout);
+            } else {
+                // The gradient is kept row-sparse unless the graph is needed for higher order derivatives, so that only the taken rows
+                // are accumulated, e.g. into the gradient of an embedding table.
+                bctx.SetRowSparseInputGrad(RowSparseGrad{indices, gout, axis_norm, a_shape});
+            }
         });
     }
     bb.Finalize();
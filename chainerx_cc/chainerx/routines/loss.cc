@@ -1,13 +1,72 @@
 #include "chainerx/routines/loss.h"
 
+#include <cstdint>
+#include <utility>
+
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/kernels/loss.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/explog.h"
 #include "chainerx/routines/indexing.h"
+#include "chainerx/routines/logic.h"
+#include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/misc.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/routines/statistics.h"
 #include "chainerx/scalar.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
+namespace {
+
+Array SoftmaxCrossEntropyGrad(
+        const Array& x, const Array& t, const nonstd::optional<Array>& class_weight, int64_t ignore_label, const Array& gout) {
+    Array gx = EmptyLike(x, x.device());
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<SoftmaxCrossEntropyGradKernel>(
+                x.AsGradStopped(), t, class_weight, ignore_label, gout.AsGradStopped(), gx);
+    }
+    return gx;
+}
+
+// Composes the softmax cross entropy of LogSoftmax and Take, for backends without the kernels.
+// Class weights, if given, must be detached from the graphs.
+Array SoftmaxCrossEntropyComposed(const Array& x, const Array& t, const nonstd::optional<Array>& class_weight, int64_t ignore_label) {
+    int64_t n = x.shape()[0];
+    int64_t c = x.shape()[1];
+    Array labels = t.AsType(Dtype::kInt64, false);
+    Array mask = NotEqual(labels, FullLike(labels, ignore_label, labels.device()));
+    // Ignored labels are replaced with a valid one, whose losses are masked out.
+    Array valid_labels = Where(mask, labels, Scalar{0});
+    // Take wraps indices around, so labels out of range are checked here as the kernels do.
+    if (n > 0) {
+        int64_t min_label = static_cast<int64_t>(AsScalar(AMin(valid_labels)));
+        int64_t max_label = static_cast<int64_t>(AsScalar(AMax(valid_labels)));
+        if (min_label < 0 || max_label >= c) {
+            throw ChainerxError{"Labels must be in the range of the classes [0, ", c, ") or be ignore_label."};
+        }
+    }
+
+    // The log-probabilities of the labels are taken from the flattened log-softmax.
+    Array indices = Arange(0, n * c, c, Dtype::kInt64, x.device()) + valid_labels;
+    Array log_p = Take(LogSoftmax(x, Axes{1}).Reshape({n * c}), indices, 0);
+    if (class_weight.has_value()) {
+        log_p = log_p * Take(*class_weight, valid_labels, 0);
+    }
+    return -Where(mask, log_p, Scalar{0});
+}
+
+}  // namespace
 
 Array AbsoluteError(const Array& x1, const Array& x2) { return Absolute(x1 - x2); }
 
@@ -24,4 +83,65 @@ Array HuberLoss(const Array& x1, const Array& x2, Scalar delta) {
     return Where(abs_a < delta_array, 0.5 * Square(a), delta * (abs_a - Scalar{0.5} * delta));
 }
 
+Array SoftmaxCrossEntropy(const Array& x, const Array& t, const nonstd::optional<Array>& class_weight, int64_t ignore_label) {
+    if (x.ndim() != 2) {
+        throw DimensionError{"Input of softmax cross entropy must be 2-dimensional but was of shape ", x.shape(), "."};
+    }
+    if (t.shape() != Shape{x.shape()[0]}) {
+        throw DimensionError{"Labels of shape ", t.shape(), " do not match the input of shape ", x.shape(), "."};
+    }
+    if (GetKind(x.dtype()) != DtypeKind::kFloat) {
+        throw DtypeError{"Input of softmax cross entropy must be of a floating point dtype but was ", GetDtypeName(x.dtype()), "."};
+    }
+    if (GetKind(t.dtype()) != DtypeKind::kInt && GetKind(t.dtype()) != DtypeKind::kUInt) {
+        throw DtypeError{"Labels must be of an integral dtype but were ", GetDtypeName(t.dtype()), "."};
+    }
+    CheckEqual(x.device(), t.device());
+
+    // Class weights are treated as constants.
+    nonstd::optional<Array> w{};
+    if (class_weight.has_value()) {
+        CheckEqual(Shape{x.shape()[1]}, class_weight->shape());
+        CheckEqual(x.dtype(), class_weight->dtype());
+        CheckEqual(x.device(), class_weight->device());
+        w = class_weight->AsGradStopped();
+    }
+
+    if (!x.device().backend().kernel_registry().HasKernel<SoftmaxCrossEntropyKernel>()) {
+        return SoftmaxCrossEntropyComposed(x, t, w, ignore_label);
+    }
+
+    Array out = Empty(Shape{x.shape()[0]}, x.dtype(), x.device());
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<SoftmaxCrossEntropyKernel>(x.AsGradStopped(), t, w, ignore_label, out);
+    }
+
+    BackwardBuilder bb{"softmax_cross_entropy", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0), t, w, ignore_label](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            Array gx = SoftmaxCrossEntropyGrad(x, t, w, ignore_label, gout);
+
+            {
+                // The gradient is linear in gout, whose coefficients are the gradient for a unit gout.
+                BackwardBuilder bb2{"softmax_cross_entropy_backward", gout, gx};
+                if (BackwardBuilder::Target bt2 = bb2.CreateTarget(0)) {
+                    bt2.Define([x = x.AsGradStopped(), t, w, ignore_label](BackwardContext& bctx2) {
+                        const Array& ggx = *bctx2.output_grad();
+                        Array unit_gx = SoftmaxCrossEntropyGrad(x, t, w, ignore_label, Ones({x.shape()[0]}, x.dtype(), x.device()));
+                        bctx2.input_grad() = Sum(ggx * unit_gx, Axes{1});
+                    });
+                }
+                bb2.Finalize();
+            }
+            bctx.input_grad() = std::move(gx);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
 }  // namespace chainerx
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/scalar.h"
 
@@ -13,4 +17,16 @@ Array GaussianKLDivergence(const Array& mean, const Array& ln_var);
 
 Array HuberLoss(const Array& x1, const Array& x2, Scalar delta);
 
+// Returns the softmax cross entropy of each row of x of shape (N, C) with the integral labels t of shape (N,).
+//
+//     loss[i] = -class_weight[t[i]] * log(softmax(x[i, :])[t[i]])
+//
+// class_weight, if given, is of shape (C,) and of the dtype of x. Rows whose label is ignore_label have zero loss and gradient, and the
+// other labels must be in the range [0, C). The loss and its gradient are each computed in a single pass over the rows without
+// materializing the log-softmax, which is recomputed from x in the backward pass. The gradient is differentiable only with respect to the
+// upstream gradient.
+// On backends without the kernels, the loss is composed of LogSoftmax and Take instead, and its gradient is differentiable in full.
+Array SoftmaxCrossEntropy(
+        const Array& x, const Array& t, const nonstd::optional<Array>& class_weight = nonstd::nullopt, int64_t ignore_label = -1);
+
 }  // namespace chainerx
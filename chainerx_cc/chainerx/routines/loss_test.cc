@@ -0,0 +1,136 @@
+#include "chainerx/routines/loss.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/array_index.h"
+#include "chainerx/axes.h"
+#include "chainerx/backward.h"
+#include "chainerx/check_backward.h"
+#include "chainerx/device.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/routines/trigonometric.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/slice.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class LossTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{"native", 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    // Inputs of shape (n, c) with values spread over a few units.
+    static Array MakeInputs(int64_t n, int64_t c, Dtype dtype) {
+        return Sin(Arange(n * c, dtype).Reshape({n, c}) * Scalar{0.7}) * Scalar{3.0};
+    }
+
+    // Computes the softmax cross entropy by composing LogSoftmax with a one-hot mask.
+    static Array ComposedSoftmaxCrossEntropy(const Array& x, const Array& t, const Array& class_weight, int64_t ignore_label) {
+        Array t_column = t.At({Slice{}, NewAxis{}});
+        Array mask = (t_column == Arange(x.shape()[1], t.dtype())).AsType(x.dtype());
+        Array weight = Sum(mask * class_weight, Axes{1});
+        return -Sum(LogSoftmax(x, Axes{1}) * mask, Axes{1}) * weight * (t != FullLike(t, ignore_label)).AsType(x.dtype());
+    }
+
+private:
+    nonstd::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(LossTest, SoftmaxCrossEntropy) {
+    Array x = testing::BuildArray({3, 4}).WithData<float>({1.f, 2.f, 3.f, 4.f, -1.f, 0.f, 1.f, 0.f, 5.f, 5.f, 5.f, 5.f});
+    Array t = testing::BuildArray({3}).WithData<int32_t>({3, 0, 2});
+    Array e = testing::BuildArray({3}).WithData<float>({0.4401897f, 2.6265234f, 1.3862944f});
+    EXPECT_ARRAY_ALL_CLOSE(e, SoftmaxCrossEntropy(x, t), 1e-5, 1e-6);
+}
+
+TEST_F(LossTest, SoftmaxCrossEntropyLarge) {
+    // Large enough to be split into multiple tasks.
+    Array x = MakeInputs(37 * 28, 37, Dtype::kFloat64);
+    Array t = Arange(37, Dtype::kInt64).BroadcastTo({28, 37}).Reshape({37 * 28});
+    Array w = Ones({37}, Dtype::kFloat64);
+    EXPECT_ARRAY_ALL_CLOSE(ComposedSoftmaxCrossEntropy(x, t, w, -1), SoftmaxCrossEntropy(x, t), 1e-10, 1e-12);
+}
+
+TEST_F(LossTest, SoftmaxCrossEntropyClassWeightAndIgnoreLabel) {
+    Array x = MakeInputs(6, 3, Dtype::kFloat32);
+    Array t = testing::BuildArray({6}).WithData<uint8_t>({2, 255, 0, 1, 255, 1});
+    Array w = testing::BuildArray({3}).WithData<float>({0.5f, 2.f, 1.5f});
+    Array loss = SoftmaxCrossEntropy(x, t, w, 255);
+    EXPECT_ARRAY_ALL_CLOSE(ComposedSoftmaxCrossEntropy(x, t, w, 255), loss, 1e-5, 1e-6);
+    EXPECT_EQ(0.f, static_cast<float>(AsScalar(loss.At({1}))));
+    EXPECT_EQ(0.f, static_cast<float>(AsScalar(loss.At({4}))));
+}
+
+TEST_F(LossTest, SoftmaxCrossEntropyBackward) {
+    Array x = MakeInputs(5, 4, Dtype::kFloat64).RequireGrad();
+    Array t = testing::BuildArray({5}).WithData<int32_t>({0, -1, 3, 2, 1});
+    Array w = testing::BuildArray({4}).WithData<double>({1.0, 0.5, 2.0, 1.5});
+    Array gout = MakeInputs(1, 5, Dtype::kFloat64).Reshape({5});
+
+    // The gradient must match that of the composed routines.
+    Backward(Sum(SoftmaxCrossEntropy(x, t, w) * gout));
+    Array expected_x = x.AsGradStopped().Copy().RequireGrad();
+    Backward(Sum(ComposedSoftmaxCrossEntropy(expected_x, t, w, -1) * gout));
+    EXPECT_ARRAY_ALL_CLOSE(*expected_x.GetGrad(), *x.GetGrad(), 1e-10, 1e-12);
+
+    CheckBackward(
+            [&t, &w](const std::vector<Array>& xs) -> std::vector<Array> { return {SoftmaxCrossEntropy(xs[0], t, w)}; },
+            {x.AsGradStopped().RequireGrad()},
+            {gout},
+            {Full({5, 4}, 1e-3, Dtype::kFloat64)});
+}
+
+TEST_F(LossTest, SoftmaxCrossEntropyDoubleBackward) {
+    Array x = MakeInputs(3, 4, Dtype::kFloat64).RequireGrad();
+    Array t = testing::BuildArray({3}).WithData<int32_t>({1, 3, -1});
+    Array gout = testing::BuildArray({3}).WithData<double>({1.0, -0.5, 2.0}).Build().RequireGrad();
+    Array ggx = MakeInputs(4, 3, Dtype::kFloat64).Reshape({3, 4}) * Scalar{0.1};
+
+    // Only the second-order gradient with respect to the upstream gradient is computed, which is linear in the gradient for a unit one.
+    Backward(Sum(SoftmaxCrossEntropy(x, t) * gout), nonstd::nullopt, DoubleBackpropOption::kEnable);
+    gout.ClearGrad();
+    Backward(Sum(*x.GetGrad() * ggx));
+
+    Array unit_x = x.AsGradStopped().Copy().RequireGrad();
+    Backward(Sum(ComposedSoftmaxCrossEntropy(unit_x, t, Ones({4}, Dtype::kFloat64), -1)));
+    EXPECT_ARRAY_ALL_CLOSE(Sum(ggx * *unit_x.GetGrad(), Axes{1}), *gout.GetGrad(), 1e-10, 1e-12);
+}
+
+TEST_F(LossTest, SoftmaxCrossEntropyInvalid) {
+    Array x = Zeros({2, 3}, Dtype::kFloat32);
+    Array t = Zeros({2}, Dtype::kInt32);
+    EXPECT_THROW(SoftmaxCrossEntropy(Zeros({2, 3, 1}, Dtype::kFloat32), t), DimensionError);
+    EXPECT_THROW(SoftmaxCrossEntropy(x, Zeros({3}, Dtype::kInt32)), DimensionError);
+    EXPECT_THROW(SoftmaxCrossEntropy(Zeros({2, 3}, Dtype::kInt32), t), DtypeError);
+    EXPECT_THROW(SoftmaxCrossEntropy(x, Zeros({2}, Dtype::kFloat32)), DtypeError);
+    EXPECT_THROW(SoftmaxCrossEntropy(x, t, Ones({2}, Dtype::kFloat32)), DimensionError);
+    EXPECT_THROW(SoftmaxCrossEntropy(x, t, Ones({3}, Dtype::kFloat64)), DtypeError);
+
+    // Labels are checked by the kernels, whose errors may be deferred until the device is synchronized.
+    auto loss_with_labels = [&x](const Array& labels) {
+        SoftmaxCrossEntropy(x, labels);
+        x.device().Synchronize();
+    };
+    EXPECT_THROW(loss_with_labels(testing::BuildArray({2}).WithData<int32_t>({0, 3})), ChainerxError);
+    EXPECT_THROW(loss_with_labels(testing::BuildArray({2}).WithData<int32_t>({-2, 0})), ChainerxError);
+}
+
+}  // namespace
+}  // namespace chainerx
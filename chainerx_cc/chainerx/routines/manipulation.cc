@@ -441,17 +441,19 @@ Array ConcatenateImpl(const std::vector<Array>& arrays, int8_t axis) {
 
     {
         NoBackpropModeScope scope{};
+        std::vector<Array> sliced_outs;
+        sliced_outs.reserve(in_size);
         int64_t out_offset = 0;
         for (const Array& array : arrays) {
             const Shape& shape = array.shape();
-            Array sliced_out = internal::MakeArray(shape, strides, out_dtype, device, out.data(), out_offset);
-            Dtype in_dtype = array.dtype();
-            in_dtypes.emplace_back(in_dtype);
-            // Note: In CopyKernel, Input Array Elements are casted to the type of Output Array.
-            device.backend().CallKernel<CopyKernel>(array, sliced_out);
+            sliced_outs.emplace_back(internal::MakeArray(shape, strides, out_dtype, device, out.data(), out_offset));
+            in_dtypes.emplace_back(array.dtype());
             array_refs.emplace_back(ConstArrayRef{array});
             out_offset += strides[axis] * shape[axis];
         }
+        // Copies all the inputs at once.
+        // Note: In BatchCopyKernel, Input Array Elements are casted to the type of Output Array.
+        device.backend().CallKernel<BatchCopyKernel>(arrays, sliced_outs);
     }
 
     {
@@ -461,14 +463,25 @@ Array ConcatenateImpl(const std::vector<Array>& arrays, int8_t axis) {
                 const Array& gy = *bctx.output_grad();
                 Dtype out_dtype = gy.dtype();
                 std::vector<Array> gxs = Split(gy, indices, axis);
+
+                // Gradients of the inputs with different dtypes are casted back, all at once unless they must be differentiable.
+                std::vector<Array> cast_srcs;
+                std::vector<Array> cast_outs;
                 for (size_t i = 0; i < gxs.size(); ++i) {
                     Dtype in_dtype = in_dtypes[i];
-                    if (out_dtype != in_dtype) {
+                    if (out_dtype != in_dtype && bctx.next_required()) {
                         bctx.input_grad(i) = gxs[i].AsType(in_dtype);
+                    } else if (out_dtype != in_dtype) {
+                        cast_outs.emplace_back(Empty(gxs[i].shape(), in_dtype, gy.device()));
+                        cast_srcs.emplace_back(std::move(gxs[i]));
+                        bctx.input_grad(i) = cast_outs.back();
                     } else {
                         bctx.input_grad(i) = std::move(gxs[i]);
                     }
                 }
+                if (!cast_srcs.empty()) {
+                    gy.device().backend().CallKernel<BatchCopyKernel>(cast_srcs, cast_outs);
+                }
             });
         }
         bb.Finalize();
@@ -0,0 +1,49 @@
+#include "chainerx/routines/manipulation.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/check_backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class ManipulationTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{"native", 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    nonstd::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(ManipulationTest, ConcatenateMixedDtypesDoubleBackward) {
+    // The gradients casted back to the input dtypes must be differentiable.
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<float>(-3).WithPadding(1)).RequireGrad();
+    Array b = (*testing::BuildArray({1, 3}).WithLinearData<double>(1, -0.5)).RequireGrad();
+    Array go = (*testing::BuildArray({3, 3}).WithLinearData<double>(-0.1, 0.1)).RequireGrad();
+    Array gga = testing::BuildArray({2, 3}).WithLinearData<float>(-0.1f, 0.1f);
+    Array ggb = testing::BuildArray({1, 3}).WithLinearData<double>(0.2, -0.1);
+
+    CheckDoubleBackwardComputation(
+            [](const std::vector<Array>& xs) -> std::vector<Array> {
+                Array y = Concatenate(xs, 0);
+                return {y * y};  // to make it nonlinear
+            },
+            {a, b},
+            {go},
+            {gga, ggb},
+            {Full({2, 3}, 1e-3, Dtype::kFloat32), Full({1, 3}, 1e-3, Dtype::kFloat64), Full({3, 3}, 1e-3, Dtype::kFloat64)});
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -35,11 +35,10 @@ void CheckComparisonDtypes(const Array& x1, Scalar x2) { return CheckComparisonD
 
 // Calculates: x1 < x2 ? pos : neg
 // Can only differentiate with respect to neg.
-Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
-    CheckComparisonDtypes(x1, x2);
-    Array out = Empty(x1.shape(), ResultType(pos, neg), x1.device());
-    // TODO(niboshi): Create mask array and reuse in backprop.
+Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg);
 
+void IfLessElseImpl(const Array& x1, Scalar x2, Scalar pos, const Array& neg, const Array& out) {
+    // TODO(niboshi): Create mask array and reuse in backprop.
     {
         NoBackpropModeScope scope{};
         x1.device().backend().CallKernel<IfLessElseASSAKernel>(x1, x2, pos, neg, out);
@@ -53,17 +52,21 @@ Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
         });
     }
     bb.Finalize();
+}
 
+Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
+    CheckComparisonDtypes(x1, x2);
+    Array out = Empty(x1.shape(), ResultType(pos, neg), x1.device());
+    IfLessElseImpl(x1, x2, pos, neg, out);
     return out;
 }
 
 // Calculates: x1 > x2 ? pos : neg
 // Can only differentiate with respect to neg.
-Array IfGreaterElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
-    CheckComparisonDtypes(x1, x2);
-    Array out = Empty(x1.shape(), ResultType(pos, neg), x1.device());
-    // TODO(niboshi): Create mask array and reuse in backprop.
+Array IfGreaterElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg);
 
+void IfGreaterElseImpl(const Array& x1, Scalar x2, Scalar pos, const Array& neg, const Array& out) {
+    // TODO(niboshi): Create mask array and reuse in backprop.
     {
         NoBackpropModeScope scope{};
         x1.device().backend().CallKernel<IfGreaterElseASSAKernel>(x1, x2, pos, neg, out);
@@ -77,7 +80,12 @@ Array IfGreaterElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
         });
     }
     bb.Finalize();
+}
 
+Array IfGreaterElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
+    CheckComparisonDtypes(x1, x2);
+    Array out = Empty(x1.shape(), ResultType(pos, neg), x1.device());
+    IfGreaterElseImpl(x1, x2, pos, neg, out);
     return out;
 }
 
@@ -211,6 +219,20 @@ Array Maximum(const Array& x1, Scalar x2) {
 
 Array Maximum(Scalar x1, const Array& x2) { return Maximum(x2, x1); }
 
+Array Maximum(Array&& x1, Scalar x2) {
+    if (x1.dtype() == Dtype::kBool && x2.kind() == DtypeKind::kBool) {
+        return LogicalOr(x1, x2);
+    }
+    CheckComparisonDtypes(x1, x2);
+    if (internal::IsDonatable(x1, x1.shape(), ResultType(x2, x1), {x1})) {
+        IfLessElseImpl(x1, x2, x2, x1, x1);
+        return std::move(x1);
+    }
+    return Maximum(static_cast<const Array&>(x1), x2);
+}
+
+Array Maximum(Scalar x1, Array&& x2) { return Maximum(std::move(x2), x1); }
+
 Array Maximum(const Array& x1, const Array& x2) {
     if (x1.dtype() == Dtype::kBool && x2.dtype() == Dtype::kBool) {
         return LogicalOr(x1, x2);
@@ -229,6 +251,20 @@ Array Minimum(const Array& x1, Scalar x2) {
 
 Array Minimum(Scalar x1, const Array& x2) { return Minimum(x2, x1); }
 
+Array Minimum(Array&& x1, Scalar x2) {
+    if (x1.dtype() == Dtype::kBool && x2.kind() == DtypeKind::kBool) {
+        return LogicalAnd(x1, x2);
+    }
+    CheckComparisonDtypes(x1, x2);
+    if (internal::IsDonatable(x1, x1.shape(), ResultType(x2, x1), {x1})) {
+        IfGreaterElseImpl(x1, x2, x2, x1, x1);
+        return std::move(x1);
+    }
+    return Minimum(static_cast<const Array&>(x1), x2);
+}
+
+Array Minimum(Scalar x1, Array&& x2) { return Minimum(std::move(x2), x1); }
+
 Array Minimum(const Array& x1, const Array& x2) {
     if (x1.dtype() == Dtype::kBool && x2.dtype() == Dtype::kBool) {
         return LogicalAnd(x1, x2);
@@ -21,8 +21,15 @@ Array Maximum(const Array& x1, Scalar x2);
 Array Maximum(Scalar x1, const Array& x2);
 Array Maximum(const Array& x1, const Array& x2);
 
+// Overloads for temporaries, which write the output into the buffer of the array argument if it is not shared and no graph is to be
+// recorded.
+Array Maximum(Array&& x1, Scalar x2);
+Array Maximum(Scalar x1, Array&& x2);
+
 Array Minimum(const Array& x1, Scalar x2);
 Array Minimum(Scalar x1, const Array& x2);
 Array Minimum(const Array& x1, const Array& x2);
+Array Minimum(Array&& x1, Scalar x2);
+Array Minimum(Scalar x1, Array&& x2);
 
 }  // namespace chainerx
@@ -17,8 +17,12 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/arithmetic.h"
+#include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/normalization.h"
+#include "chainerx/kernels/statistics.h"
 #include "chainerx/macro.h"
+#include "chainerx/memory_format.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/misc.h"
@@ -143,8 +147,21 @@ std::tuple<Array, std::unique_ptr<BatchNormGradState>> ApplyGenericBatchNorm(
     const Array& var_cast = var.AsType(interm_dtype, false);
 
     Array inv_std = Reciprocal(Sqrt(var_cast + eps));
-    Array out_cast = (x_cast - mean_cast) * inv_std * gamma_cast + beta_cast;
-    const Array& actual_out = out_cast.dtype() == x.dtype() ? out_cast : out_cast.AsType(x.dtype());
+    Array scale = inv_std * gamma_cast;
+
+    // Normalize in place in a buffer of the memory format of the input, so that e.g. channels-last inputs give channels-last outputs.
+    Device& device = x.device();
+    MemoryFormat format = GetMemoryFormat(x);
+    Array actual_out = internal::Empty(x.shape(), x.dtype(), GetMemoryFormatStrides(x.shape(), x.dtype(), format), device);
+    Array out_cast = interm_dtype == x.dtype()
+                             ? actual_out
+                             : internal::Empty(x.shape(), interm_dtype, GetMemoryFormatStrides(x.shape(), interm_dtype, format), device);
+    device.backend().CallKernel<SubtractKernel>(x_cast, mean_cast.BroadcastTo(x.shape()), out_cast);
+    device.backend().CallKernel<MultiplyKernel>(out_cast, scale.BroadcastTo(x.shape()), out_cast);
+    device.backend().CallKernel<AddKernel>(out_cast, beta_cast.BroadcastTo(x.shape()), out_cast);
+    if (interm_dtype != x.dtype()) {
+        device.backend().CallKernel<CopyKernel>(out_cast, actual_out);
+    }
 
     std::unique_ptr<BatchNormGradState> state =
             return_state ? std::make_unique<GenericBatchNormGradState>(std::move(mean_cast), std::move(inv_std), beta.dtype()) : nullptr;
@@ -176,9 +193,9 @@ std::tuple<Array, std::unique_ptr<BatchNormGradState>> GenericBatchNormKernel::C
 
     // Compute the mean and variance of x with promoted dtype if the parameters have higher precisions.
     Dtype interm_dtype = ResultType(x, gamma, beta);
-    const Array& x_cast = x.dtype() == interm_dtype ? x : x.AsType(interm_dtype);
-    Array x_mean = Mean(x_cast, axis, true);
-    Array x_var = Var(x_cast, axis, true);
+    Array x_mean = internal::EmptyReduced(x.shape(), interm_dtype, axis, true, x.device());
+    Array x_var = internal::EmptyReduced(x.shape(), interm_dtype, axis, true, x.device());
+    x.device().backend().CallKernel<MeanVarKernel>(x, axis, x_mean, x_var);
     std::tuple<Array, std::unique_ptr<BatchNormGradState>> result =
             ApplyGenericBatchNorm(x, gamma, beta, x_mean, x_var, eps, axis, interm_dtype, return_state, out);
 
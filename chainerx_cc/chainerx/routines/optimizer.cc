@@ -0,0 +1,189 @@
+#include "chainerx/routines/optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/backend.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/kernels/optimizer.h"
+#include "chainerx/routines/misc.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace {
+
+// Checks the operands of an update, where operands[0] are the parameters and the others are the gradients and states.
+void CheckUpdateOperands(const std::vector<const std::vector<Array>*>& operands) {
+    const std::vector<Array>& params = *operands.front();
+    for (const std::vector<Array>* others : operands) {
+        if (others->size() != params.size()) {
+            throw ChainerxError{
+                    "The number of gradients or states (", others->size(), ") differs from that of parameters (", params.size(), ")."};
+        }
+    }
+    for (size_t i = 0; i < params.size(); ++i) {
+        const Array& param = params[i];
+        if (GetKind(param.dtype()) != DtypeKind::kFloat) {
+            throw DtypeError{"Parameters must be of floating point dtypes but were ", GetDtypeName(param.dtype()), "."};
+        }
+        for (const std::vector<Array>* others : operands) {
+            const Array& other = (*others)[i];
+            CheckEqual(param.shape(), other.shape());
+            CheckEqual(param.dtype(), other.dtype());
+            CheckEqual(param.device(), other.device());
+        }
+    }
+}
+
+// Splits the operands by the devices of the parameters, so that each group is updated by a single kernel call.
+// Each group holds the lists of the operands in the same order as `operands`.
+std::vector<std::vector<std::vector<Array>>> GroupOperandsByDevice(const std::vector<const std::vector<Array>*>& operands) {
+    const std::vector<Array>& params = *operands.front();
+    std::vector<Device*> devices{};
+    std::vector<std::vector<std::vector<Array>>> groups{};
+    for (size_t i = 0; i < params.size(); ++i) {
+        Device* device = &params[i].device();
+        auto it = std::find(devices.begin(), devices.end(), device);
+        if (it == devices.end()) {
+            devices.emplace_back(device);
+            groups.emplace_back(operands.size());
+            it = devices.end() - 1;
+        }
+        std::vector<std::vector<Array>>& group = groups[it - devices.begin()];
+        for (size_t k = 0; k < operands.size(); ++k) {
+            group[k].emplace_back((*operands[k])[i]);
+        }
+    }
+    return groups;
+}
+
+// Returns whether the backend of the operands has the fused kernel of an update.
+// Otherwise, the update is composed of array routines operating on views of the operands detached from the graphs.
+template <typename KernelType>
+bool HasUpdateKernel(const std::vector<std::vector<Array>>& group) {
+    return group[0].front().device().backend().kernel_registry().HasKernel<KernelType>();
+}
+
+void SgdUpdateComposed(const std::vector<Array>& params, const std::vector<Array>& grads, Scalar lr) {
+    for (size_t i = 0; i < params.size(); ++i) {
+        Array param = params[i].AsGradStopped();
+        param -= grads[i].AsGradStopped() * lr;
+    }
+}
+
+void MomentumSgdUpdateComposed(
+        const std::vector<Array>& params,
+        const std::vector<Array>& grads,
+        const std::vector<Array>& velocities,
+        Scalar lr,
+        Scalar momentum) {
+    for (size_t i = 0; i < params.size(); ++i) {
+        Array param = params[i].AsGradStopped();
+        Array v = velocities[i].AsGradStopped();
+        v *= momentum;
+        v -= grads[i].AsGradStopped() * lr;
+        param += v;
+    }
+}
+
+void AdamUpdateComposed(
+        const std::vector<Array>& params,
+        const std::vector<Array>& grads,
+        const std::vector<Array>& ms,
+        const std::vector<Array>& vs,
+        Scalar alpha_t,
+        Scalar beta1,
+        Scalar beta2,
+        Scalar eps,
+        Scalar weight_decay_rate) {
+    Scalar one_minus_beta1 = 1.0 - static_cast<double>(beta1);
+    Scalar one_minus_beta2 = 1.0 - static_cast<double>(beta2);
+    for (size_t i = 0; i < params.size(); ++i) {
+        Array param = params[i].AsGradStopped();
+        Array grad = grads[i].AsGradStopped();
+        Array m = ms[i].AsGradStopped();
+        Array v = vs[i].AsGradStopped();
+        m += (grad - m) * one_minus_beta1;
+        v += (grad * grad - v) * one_minus_beta2;
+        param -= m / (Sqrt(v) + eps) * alpha_t + param * weight_decay_rate;
+    }
+}
+
+}  // namespace
+
+void SgdUpdate(const std::vector<Array>& params, const std::vector<Array>& grads, Scalar lr) {
+    std::vector<const std::vector<Array>*> operands{&params, &grads};
+    CheckUpdateOperands(operands);
+
+    NoBackpropModeScope scope{};
+    for (const std::vector<std::vector<Array>>& group : GroupOperandsByDevice(operands)) {
+        if (HasUpdateKernel<SgdUpdateKernel>(group)) {
+            group[0].front().device().backend().CallKernel<SgdUpdateKernel>(group[0], group[1], lr);
+        } else {
+            SgdUpdateComposed(group[0], group[1], lr);
+        }
+    }
+}
+
+void MomentumSgdUpdate(
+        const std::vector<Array>& params,
+        const std::vector<Array>& grads,
+        const std::vector<Array>& velocities,
+        Scalar lr,
+        Scalar momentum) {
+    std::vector<const std::vector<Array>*> operands{&params, &grads, &velocities};
+    CheckUpdateOperands(operands);
+
+    NoBackpropModeScope scope{};
+    for (const std::vector<std::vector<Array>>& group : GroupOperandsByDevice(operands)) {
+        if (HasUpdateKernel<MomentumSgdUpdateKernel>(group)) {
+            group[0].front().device().backend().CallKernel<MomentumSgdUpdateKernel>(group[0], group[1], group[2], lr, momentum);
+        } else {
+            MomentumSgdUpdateComposed(group[0], group[1], group[2], lr, momentum);
+        }
+    }
+}
+
+void AdamUpdate(
+        const std::vector<Array>& params,
+        const std::vector<Array>& grads,
+        const std::vector<Array>& ms,
+        const std::vector<Array>& vs,
+        int64_t t,
+        Scalar alpha,
+        Scalar beta1,
+        Scalar beta2,
+        Scalar eps,
+        Scalar weight_decay_rate) {
+    if (t < 1) {
+        throw ChainerxError{"The number of the update of Adam must be positive but was ", t, "."};
+    }
+    std::vector<const std::vector<Array>*> operands{&params, &grads, &ms, &vs};
+    CheckUpdateOperands(operands);
+
+    // The bias correction is computed once for all the parameters.
+    auto t_double = static_cast<double>(t);
+    double fix1 = 1.0 - std::pow(static_cast<double>(beta1), t_double);
+    double fix2 = 1.0 - std::pow(static_cast<double>(beta2), t_double);
+    Scalar alpha_t = static_cast<double>(alpha) * std::sqrt(fix2) / fix1;
+
+    NoBackpropModeScope scope{};
+    for (const std::vector<std::vector<Array>>& group : GroupOperandsByDevice(operands)) {
+        if (HasUpdateKernel<AdamUpdateKernel>(group)) {
+            group[0].front().device().backend().CallKernel<AdamUpdateKernel>(
+                    group[0], group[1], group[2], group[3], alpha_t, beta1, beta2, eps, weight_decay_rate);
+        } else {
+            AdamUpdateComposed(group[0], group[1], group[2], group[3], alpha_t, beta1, beta2, eps, weight_decay_rate);
+        }
+    }
+}
+
+}  // namespace chainerx
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+
+// Update rules of optimizers applied to lists of parameters in-place.
+//
+// The i-th gradient and states must have the same shape, dtype and device as the i-th parameter, whose dtype must be floating point.
+// Parameters on the same device are updated in a single kernel call, with all the arithmetic of an update fused into one pass over the
+// arrays. On backends without the fused kernels, the updates are composed of array routines instead. The updates are not recorded in any
+// graph.
+
+// Vanilla stochastic gradient descent.
+//
+//     param -= lr * grad
+void SgdUpdate(const std::vector<Array>& params, const std::vector<Array>& grads, Scalar lr);
+
+// Stochastic gradient descent with momentum, where `velocities` are the states of the parameters initialized with zeros.
+//
+//     v = momentum * v - lr * grad
+//     param += v
+void MomentumSgdUpdate(
+        const std::vector<Array>& params,
+        const std::vector<Array>& grads,
+        const std::vector<Array>& velocities,
+        Scalar lr,
+        Scalar momentum);
+
+// Adam, where `ms` and `vs` are the states of the parameters initialized with zeros and `t` is the number of the update starting from 1.
+//
+//     m += (1 - beta1) * (grad - m)
+//     v += (1 - beta2) * (grad * grad - v)
+//     param -= alpha * sqrt(1 - beta2^t) / (1 - beta1^t) * m / (sqrt(v) + eps) + weight_decay_rate * param
+void AdamUpdate(
+        const std::vector<Array>& params,
+        const std::vector<Array>& grads,
+        const std::vector<Array>& ms,
+        const std::vector<Array>& vs,
+        int64_t t,
+        Scalar alpha = 0.001,
+        Scalar beta1 = 0.9,
+        Scalar beta2 = 0.999,
+        Scalar eps = 1e-8,
+        Scalar weight_decay_rate = 0.0);
+
+}  // namespace chainerx
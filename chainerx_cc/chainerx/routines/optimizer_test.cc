@@ -0,0 +1,148 @@
+#include "chainerx/routines/optimizer.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/float16.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/misc.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class OptimizerTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{"native", 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    // Parameters of various sizes, including a non-contiguous one, an empty one and one large enough to be split into multiple tasks.
+    static std::vector<Array> MakeArrays(double scale, double shift) {
+        std::vector<Array> arrays{};
+        for (const Shape& shape : {Shape{3, 4}, Shape{1}, Shape{0, 5}, Shape{100, 700}}) {
+            arrays.emplace_back(Arange(shape.GetTotalSize(), Dtype::kFloat32).Reshape(shape) * Scalar{scale} + Scalar{shift});
+        }
+        arrays.emplace_back((Arange(30, Dtype::kFloat32).Reshape({5, 6}) * Scalar{scale} - Scalar{shift}).Transpose());
+        return arrays;
+    }
+
+    static std::vector<Array> CopyArrays(const std::vector<Array>& arrays) {
+        std::vector<Array> copies{};
+        for (const Array& a : arrays) {
+            copies.emplace_back(a.Copy());
+        }
+        return copies;
+    }
+
+private:
+    nonstd::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(OptimizerTest, SgdUpdate) {
+    std::vector<Array> params = MakeArrays(0.01, 1.0);
+    std::vector<Array> grads = MakeArrays(-0.003, 0.5);
+    std::vector<Array> expected{};
+    for (size_t i = 0; i < params.size(); ++i) {
+        expected.emplace_back(params[i] - grads[i] * Scalar{0.1f});
+    }
+
+    SgdUpdate(params, grads, 0.1f);
+    for (size_t i = 0; i < params.size(); ++i) {
+        EXPECT_ARRAY_ALL_CLOSE(expected[i], params[i], 1e-6, 1e-6);
+    }
+}
+
+TEST_F(OptimizerTest, SgdUpdateFloat16) {
+    Array param = testing::BuildArray({4}).WithData<Float16>({Float16{1.0f}, Float16{2.0f}, Float16{-1.0f}, Float16{0.5f}});
+    Array grad = testing::BuildArray({4}).WithData<Float16>({Float16{1.0f}, Float16{-2.0f}, Float16{4.0f}, Float16{0.0f}});
+    SgdUpdate({param}, {grad}, 0.25);
+    EXPECT_ARRAY_EQ(
+            testing::BuildArray({4}).WithData<Float16>({Float16{0.75f}, Float16{2.5f}, Float16{-2.0f}, Float16{0.5f}}), param);
+}
+
+TEST_F(OptimizerTest, MomentumSgdUpdate) {
+    std::vector<Array> params = MakeArrays(0.01, 1.0);
+    std::vector<Array> grads = MakeArrays(-0.003, 0.5);
+    std::vector<Array> velocities = MakeArrays(0.002, -0.1);
+    std::vector<Array> expected_params{};
+    std::vector<Array> expected_velocities{};
+    for (size_t i = 0; i < params.size(); ++i) {
+        Array v = velocities[i] * Scalar{0.9f} - grads[i] * Scalar{0.1f};
+        expected_velocities.emplace_back(v);
+        expected_params.emplace_back(params[i] + v);
+    }
+
+    MomentumSgdUpdate(params, grads, velocities, 0.1f, 0.9f);
+    for (size_t i = 0; i < params.size(); ++i) {
+        EXPECT_ARRAY_ALL_CLOSE(expected_velocities[i], velocities[i], 1e-6, 1e-6);
+        EXPECT_ARRAY_ALL_CLOSE(expected_params[i], params[i], 1e-6, 1e-6);
+    }
+}
+
+TEST_F(OptimizerTest, AdamUpdate) {
+    std::vector<Array> params = MakeArrays(0.01, 1.0);
+    std::vector<Array> ms{};
+    std::vector<Array> vs{};
+    for (const Array& param : params) {
+        ms.emplace_back(ZerosLike(param));
+        vs.emplace_back(ZerosLike(param));
+    }
+    std::vector<Array> expected_params = CopyArrays(params);
+    std::vector<Array> expected_ms = CopyArrays(ms);
+    std::vector<Array> expected_vs = CopyArrays(vs);
+
+    double alpha = 0.01;
+    double beta1 = 0.8;
+    double beta2 = 0.99;
+    double eps = 1e-6;
+    double weight_decay_rate = 0.001;
+    for (int64_t t = 1; t <= 3; ++t) {
+        std::vector<Array> grads = MakeArrays(-0.003 * t, 0.5);
+        double alpha_t = alpha * std::sqrt(1 - std::pow(beta2, t)) / (1 - std::pow(beta1, t));
+        for (size_t i = 0; i < params.size(); ++i) {
+            const Array& g = grads[i];
+            expected_ms[i] = expected_ms[i] + (g - expected_ms[i]) * Scalar{1 - beta1};
+            expected_vs[i] = expected_vs[i] + (g * g - expected_vs[i]) * Scalar{1 - beta2};
+            expected_params[i] = expected_params[i] - (expected_ms[i] * Scalar{alpha_t} / (Sqrt(expected_vs[i]) + Scalar{eps}) +
+                                                       expected_params[i] * Scalar{weight_decay_rate});
+        }
+        AdamUpdate(params, grads, ms, vs, t, alpha, beta1, beta2, eps, weight_decay_rate);
+    }
+    for (size_t i = 0; i < params.size(); ++i) {
+        EXPECT_ARRAY_ALL_CLOSE(expected_ms[i], ms[i], 1e-5, 1e-6);
+        EXPECT_ARRAY_ALL_CLOSE(expected_vs[i], vs[i], 1e-5, 1e-6);
+        EXPECT_ARRAY_ALL_CLOSE(expected_params[i], params[i], 1e-5, 1e-6);
+    }
+}
+
+TEST_F(OptimizerTest, UpdateNoParams) {
+    SgdUpdate({}, {}, 0.1f);
+    AdamUpdate({}, {}, {}, {}, 1);
+}
+
+TEST_F(OptimizerTest, UpdateInvalid) {
+    Array param = Zeros({2, 3}, Dtype::kFloat32);
+    EXPECT_THROW(SgdUpdate({param}, {}, 0.1f), ChainerxError);
+    EXPECT_THROW(SgdUpdate({param}, {Zeros({3, 2}, Dtype::kFloat32)}, 0.1f), DimensionError);
+    EXPECT_THROW(SgdUpdate({param}, {Zeros({2, 3}, Dtype::kFloat64)}, 0.1f), DtypeError);
+    EXPECT_THROW(SgdUpdate({Zeros({2}, Dtype::kInt32)}, {Zeros({2}, Dtype::kInt32)}, 1), DtypeError);
+    EXPECT_THROW(MomentumSgdUpdate({param}, {param}, {Zeros({2}, Dtype::kFloat32)}, 0.1f, 0.9f), DimensionError);
+    EXPECT_THROW(AdamUpdate({param}, {param}, {param}, {param}, 0), ChainerxError);
+}
+
+}  // namespace
+}  // namespace chainerx
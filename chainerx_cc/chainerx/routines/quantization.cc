@@ -0,0 +1,288 @@
+#include "chainerx/routines/quantization.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/device.h"
+#include "chainerx/dims.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/kernels/quantization.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/statistics.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace {
+
+void CheckQuantizedDtype(Dtype dtype) {
+    if (dtype != Dtype::kInt8 && dtype != Dtype::kUInt8) {
+        throw DtypeError{"Quantized dtype must be int8 or uint8 but was ", GetDtypeName(dtype), "."};
+    }
+}
+
+// Returns the quantization parameter cast to `dtype` and broadcast to `shape`, where it is applied per-tensor if `axis` is not given and
+// along `axis` otherwise.
+Array BroadcastQuantizationParam(const Array& param, Dtype dtype, const Shape& shape, const nonstd::optional<int8_t>& axis) {
+    if (!axis.has_value()) {
+        if (param.ndim() != 0) {
+            throw DimensionError{"Per-tensor quantization parameters must be 0-dimensional but had shape ", param.shape(), "."};
+        }
+        return param.AsType(dtype, false).BroadcastTo(shape);
+    }
+    int8_t normalized_axis = internal::NormalizeAxis(*axis, shape.ndim());
+    if (param.ndim() != 1 || param.shape()[0] != shape[normalized_axis]) {
+        throw DimensionError{
+                "Per-channel quantization parameters of shape ", param.shape(), " do not match axis ", int{*axis}, " of ", shape, "."};
+    }
+    Shape param_shape{};
+    for (int8_t i = 0; i < shape.ndim(); ++i) {
+        param_shape.emplace_back(i == normalized_axis ? shape[i] : 1);
+    }
+    return param.AsType(dtype, false).Reshape(param_shape).BroadcastTo(shape);
+}
+
+// Returns a parameter of the quantized matrix product which is given either per-tensor or per-column, as a 1-dimensional array of `n`
+// elements.
+Array BroadcastColumnParam(const Array& param, Dtype dtype, int64_t n, const char* name) {
+    if (param.ndim() > 1 || (param.ndim() == 1 && param.shape()[0] != n)) {
+        throw DimensionError{"Invalid shape of ", name, " ", param.shape(), " for ", n, " output channels."};
+    }
+    return param.AsType(dtype, false).BroadcastTo({n});
+}
+
+Array ScalarParam(const Array& param, const char* name) {
+    if (param.ndim() != 0) {
+        throw DimensionError{name, " must be 0-dimensional but had shape ", param.shape(), "."};
+    }
+    return param.AsType(Dtype::kInt32, false);
+}
+
+void CheckQuantizedOperands(const Array& a, const Array& b) {
+    CheckQuantizedDtype(a.dtype());
+    if (b.dtype() != Dtype::kInt8) {
+        throw DtypeError{"Quantized weights must be int8 but were ", GetDtypeName(b.dtype()), "."};
+    }
+}
+
+// Checks that the zero points are in the range of the quantized dtype, which bounds the intermediate values of the kernels.
+void CheckZeroPointRange(const Array& zero_point, Dtype dtype, const char* name) {
+    if (zero_point.GetTotalSize() == 0) {
+        return;
+    }
+    int64_t low = dtype == Dtype::kInt8 ? std::numeric_limits<int8_t>::min() : std::numeric_limits<uint8_t>::min();
+    int64_t high = dtype == Dtype::kInt8 ? std::numeric_limits<int8_t>::max() : std::numeric_limits<uint8_t>::max();
+    NoBackpropModeScope scope{};
+    Array values = zero_point.AsType(Dtype::kInt64, false);
+    int64_t min = static_cast<int64_t>(AsScalar(AMin(values)));
+    int64_t max = static_cast<int64_t>(AsScalar(AMax(values)));
+    if (min < low || max > high) {
+        throw ChainerxError{
+                name, " must be in the range [", low, ", ", high, "] of ", GetDtypeName(dtype), " but ranged over [", min, ", ", max, "]."};
+    }
+}
+
+void CheckZeroPoints(
+        const Array& a,
+        const Array& a_zero_point,
+        const Array& b_zero_point,
+        const nonstd::optional<Array>& out_zero_point,
+        Dtype out_dtype) {
+    CheckZeroPointRange(a_zero_point, a.dtype(), "Input zero point");
+    CheckZeroPointRange(b_zero_point, Dtype::kInt8, "Weight zero point");
+    if (out_zero_point.has_value()) {
+        CheckZeroPointRange(*out_zero_point, out_dtype, "Output zero point");
+    }
+}
+
+Array QuantizedDotImpl(
+        const Array& a,
+        const Array& a_zero_point,
+        const Array& b,
+        const Array& b_zero_point,
+        const nonstd::optional<Array>& bias,
+        const nonstd::optional<Array>& multiplier,
+        const nonstd::optional<Array>& out_zero_point,
+        Dtype out_dtype) {
+    CheckQuantizedOperands(a, b);
+    if (a.ndim() != 2 || b.ndim() != 2 || a.shape()[1] != b.shape()[0]) {
+        throw DimensionError{"Invalid shapes for quantized matrix multiplication: ", a.shape(), ", ", b.shape(), "."};
+    }
+    CheckZeroPoints(a, a_zero_point, b_zero_point, out_zero_point, out_dtype);
+    int64_t n = b.shape()[1];
+    nonstd::optional<Array> bias_param{};
+    if (bias.has_value()) {
+        if (bias->ndim() != 1 || bias->shape()[0] != n) {
+            throw DimensionError{"Mismatched bias shape ", bias->shape(), " for ", n, " output channels."};
+        }
+        bias_param = bias->AsType(Dtype::kInt32, false);
+    }
+    nonstd::optional<Array> multiplier_param{};
+    nonstd::optional<Array> out_zero_point_param{};
+    if (multiplier.has_value()) {
+        multiplier_param = BroadcastColumnParam(*multiplier, Dtype::kFloat32, n, "multiplier");
+        out_zero_point_param = ScalarParam(*out_zero_point, "Output zero point");
+    }
+
+    Array out = Empty({a.shape()[0], n}, out_dtype, a.device());
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<QuantizedGemmKernel>(
+                a,
+                ScalarParam(a_zero_point, "Input zero point"),
+                b,
+                BroadcastColumnParam(b_zero_point, Dtype::kInt32, n, "weight zero point"),
+                bias_param,
+                multiplier_param,
+                out_zero_point_param,
+                out);
+    }
+    return out;
+}
+
+Array QuantizedConvImpl(
+        const Array& x,
+        const Array& x_zero_point,
+        const Array& w,
+        const Array& w_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Dims& stride,
+        const Dims& pad,
+        const nonstd::optional<Array>& multiplier,
+        const nonstd::optional<Array>& out_zero_point,
+        Dtype out_dtype) {
+    CheckQuantizedOperands(x, w);
+    if (w.ndim() != x.ndim()) {
+        throw DimensionError{"Mismatched number of dimensions between input ", x.ndim(), " and weights ", w.ndim(), "."};
+    }
+    int8_t ndim = x.ndim() - 2;  // Number of spatial dimensions
+    if (ndim < 0) {
+        throw DimensionError{"Number of spatial dimensions must be greater than or equal to 0"};
+    }
+    if (static_cast<int8_t>(stride.size()) != ndim) {
+        throw DimensionError{"Wrong numbers of strides ", stride.size(), " for input with ", x.ndim(), " dimensions."};
+    }
+    if (static_cast<int8_t>(pad.size()) != ndim) {
+        throw DimensionError{"Wrong numbers of paddings ", pad.size(), " for input with ", x.ndim(), " dimensions."};
+    }
+    if (std::any_of(stride.begin(), stride.end(), [](int64_t s) { return s <= 0; })) {
+        throw DimensionError{"Stride elements must be greater than 0: ", DimsFormatter{stride}, "."};
+    }
+    if (w.shape()[1] != x.shape()[1]) {
+        throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
+    }
+    CheckZeroPoints(x, x_zero_point, w_zero_point, out_zero_point, out_dtype);
+    int64_t out_channels = w.shape()[0];
+    nonstd::optional<Array> bias_param{};
+    if (bias.has_value()) {
+        if (bias->ndim() != 1 || bias->shape()[0] != out_channels) {
+            throw DimensionError{"Mismatched bias shape ", bias->shape(), " for weights ", w.shape(), "."};
+        }
+        bias_param = bias->AsType(Dtype::kInt32, false);
+    }
+    nonstd::optional<Array> multiplier_param{};
+    nonstd::optional<Array> out_zero_point_param{};
+    if (multiplier.has_value()) {
+        multiplier_param = BroadcastColumnParam(*multiplier, Dtype::kFloat32, out_channels, "multiplier");
+        out_zero_point_param = ScalarParam(*out_zero_point, "Output zero point");
+    }
+
+    NoBackpropModeScope scope{};
+    return x.device().backend().CallKernel<QuantizedConvKernel>(
+            x,
+            ScalarParam(x_zero_point, "Input zero point"),
+            w,
+            BroadcastColumnParam(w_zero_point, Dtype::kInt32, out_channels, "weight zero point"),
+            bias_param,
+            stride,
+            pad,
+            multiplier_param,
+            out_zero_point_param,
+            out_dtype);
+}
+
+}  // namespace
+
+Array Quantize(const Array& x, const Array& scale, const Array& zero_point, Dtype dtype, const nonstd::optional<int8_t>& axis) {
+    CheckQuantizedDtype(dtype);
+    if (GetKind(x.dtype()) == DtypeKind::kBool) {
+        throw DtypeError{"Boolean arrays cannot be quantized."};
+    }
+    Array out = Empty(x.shape(), dtype, x.device());
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<QuantizeKernel>(
+                x,
+                BroadcastQuantizationParam(scale, Dtype::kFloat32, x.shape(), axis),
+                BroadcastQuantizationParam(zero_point, Dtype::kInt32, x.shape(), axis),
+                out);
+    }
+    return out;
+}
+
+Array Dequantize(const Array& q, const Array& scale, const Array& zero_point, const nonstd::optional<int8_t>& axis) {
+    CheckQuantizedDtype(q.dtype());
+    Array out = Empty(q.shape(), Dtype::kFloat32, q.device());
+    {
+        NoBackpropModeScope scope{};
+        q.device().backend().CallKernel<DequantizeKernel>(
+                q,
+                BroadcastQuantizationParam(scale, Dtype::kFloat32, q.shape(), axis),
+                BroadcastQuantizationParam(zero_point, Dtype::kInt32, q.shape(), axis),
+                out);
+    }
+    return out;
+}
+
+Array QuantizedDot(
+        const Array& a, const Array& a_zero_point, const Array& b, const Array& b_zero_point, const nonstd::optional<Array>& bias) {
+    return QuantizedDotImpl(a, a_zero_point, b, b_zero_point, bias, nonstd::nullopt, nonstd::nullopt, Dtype::kInt32);
+}
+
+Array QuantizedDot(
+        const Array& a,
+        const Array& a_zero_point,
+        const Array& b,
+        const Array& b_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Array& multiplier,
+        const Array& out_zero_point,
+        Dtype out_dtype) {
+    CheckQuantizedDtype(out_dtype);
+    return QuantizedDotImpl(a, a_zero_point, b, b_zero_point, bias, multiplier, out_zero_point, out_dtype);
+}
+
+Array QuantizedConv(
+        const Array& x,
+        const Array& x_zero_point,
+        const Array& w,
+        const Array& w_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Dims& stride,
+        const Dims& pad) {
+    return QuantizedConvImpl(x, x_zero_point, w, w_zero_point, bias, stride, pad, nonstd::nullopt, nonstd::nullopt, Dtype::kInt32);
+}
+
+Array QuantizedConv(
+        const Array& x,
+        const Array& x_zero_point,
+        const Array& w,
+        const Array& w_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Dims& stride,
+        const Dims& pad,
+        const Array& multiplier,
+        const Array& out_zero_point,
+        Dtype out_dtype) {
+    CheckQuantizedDtype(out_dtype);
+    return QuantizedConvImpl(x, x_zero_point, w, w_zero_point, bias, stride, pad, multiplier, out_zero_point, out_dtype);
+}
+
+}  // namespace chainerx
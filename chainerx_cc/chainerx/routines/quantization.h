@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/dims.h"
+#include "chainerx/dtype.h"
+
+namespace chainerx {
+
+// Quantizes an array to int8 or uint8 with the affine mapping q = clip(round(x / scale) + zero_point), rounding half to even.
+//
+// If `axis` is not given, `scale` and `zero_point` must be 0-dimensional (per-tensor quantization). Otherwise, they must be
+// 1-dimensional arrays whose length is the dimension of `x` along `axis` (per-channel quantization).
+// Quantized arrays are not differentiable.
+Array Quantize(
+        const Array& x, const Array& scale, const Array& zero_point, Dtype dtype, const nonstd::optional<int8_t>& axis = nonstd::nullopt);
+
+// Maps a quantized array back to float32 with x = (q - zero_point) * scale.
+//
+// The parameters are interpreted in the same way as Quantize.
+Array Dequantize(const Array& q, const Array& scale, const Array& zero_point, const nonstd::optional<int8_t>& axis = nonstd::nullopt);
+
+// Computes the matrix product of quantized matrices, accumulated in int32.
+//
+// a: (M, K), int8 or uint8
+// a_zero_point: ()
+// b: (K, N), int8
+// b_zero_point: () or (N)
+// bias: (N), added to the int32 accumulator
+//
+// The zero points must be in the range of the dtypes of the respective operands, and ChainerxError is thrown otherwise.
+// Returns an int32 array of shape (M, N). Results out of the range of int32 are saturated.
+Array QuantizedDot(
+        const Array& a,
+        const Array& a_zero_point,
+        const Array& b,
+        const Array& b_zero_point,
+        const nonstd::optional<Array>& bias = nonstd::nullopt);
+
+// Computes the matrix product of quantized matrices and requantizes the int32 accumulator to `out_dtype` (int8 or uint8) with
+// out = clip(round(acc * multiplier) + out_zero_point), where `multiplier` is () or (N) and is typically
+// a_scale * b_scale / out_scale.
+Array QuantizedDot(
+        const Array& a,
+        const Array& a_zero_point,
+        const Array& b,
+        const Array& b_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Array& multiplier,
+        const Array& out_zero_point,
+        Dtype out_dtype);
+
+// Computes the n-dimensional convolution of quantized arrays, accumulated in int32.
+//
+// x: (batch_size, in_channels, in_1, in_2, ..., in_n), int8 or uint8
+// w: (out_channels, in_channels, k_1, k_2, ..., k_n), int8
+// w_zero_point: () or (out_channels)
+// bias: (out_channels)
+//
+// Returns an int32 array of shape (batch_size, out_channels, out_1, out_2, ..., out_n).
+Array QuantizedConv(
+        const Array& x,
+        const Array& x_zero_point,
+        const Array& w,
+        const Array& w_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Dims& stride,
+        const Dims& pad);
+
+// Computes the n-dimensional convolution of quantized arrays and requantizes the result in the same way as QuantizedDot.
+Array QuantizedConv(
+        const Array& x,
+        const Array& x_zero_point,
+        const Array& w,
+        const Array& w_zero_point,
+        const nonstd::optional<Array>& bias,
+        const Dims& stride,
+        const Dims& pad,
+        const Array& multiplier,
+        const Array& out_zero_point,
+        Dtype out_dtype);
+
+}  // namespace chainerx
@@ -0,0 +1,217 @@
+#include "chainerx/routines/quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dims.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+// Deterministic values spread over the whole range of T.
+template <typename T>
+std::vector<T> PseudoRandomData(int64_t size, int64_t seed) {
+    std::vector<T> data(size);
+    for (int64_t i = 0; i < size; ++i) {
+        data[i] = static_cast<T>((i * 97 + seed * 31 + (i * i) % 13) % 256 + (std::is_signed<T>::value ? -128 : 0));
+    }
+    return data;
+}
+
+class QuantizationTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{"native", 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    nonstd::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(QuantizationTest, QuantizePerTensor) {
+    Array x = testing::BuildArray({9}).WithData<float>({-1.0f, -0.25f, 0.0f, 0.25f, 0.75f, 1.25f, 10.0f, 1000.0f, -1000.0f});
+    Array q = Quantize(x, Full({}, 0.5f), Full({}, int32_t{3}), Dtype::kInt8);
+    Array e = testing::BuildArray({9}).WithData<int8_t>({1, 3, 3, 3, 5, 5, 23, 127, -128});
+    EXPECT_ARRAY_EQ(e, q);
+}
+
+TEST_F(QuantizationTest, QuantizePerChannel) {
+    Array x = testing::BuildArray({2, 3}).WithData<double>({0.0, 1.0, 2.0, 3.0, 4.0, -5.0}).WithPadding(1);
+    Array scale = testing::BuildArray({2}).WithData<float>({1.0f, 0.5f});
+    Array zero_point = testing::BuildArray({2}).WithData<int32_t>({128, 0});
+    Array q = Quantize(x, scale, zero_point, Dtype::kUInt8, 0);
+    Array e = testing::BuildArray({2, 3}).WithData<uint8_t>({128, 129, 130, 6, 8, 0});
+    EXPECT_ARRAY_EQ(e, q);
+}
+
+TEST_F(QuantizationTest, Dequantize) {
+    Array q = testing::BuildArray({2, 2}).WithData<int8_t>({-128, 0, 5, 127});
+    Array scale = testing::BuildArray({2}).WithData<float>({0.5f, 2.0f});
+    Array zero_point = testing::BuildArray({2}).WithData<int32_t>({1, -1});
+    Array x = Dequantize(q, scale, zero_point, -1);
+    Array e = testing::BuildArray({2, 2}).WithData<float>({-64.5f, 2.0f, 2.0f, 256.0f});
+    EXPECT_ARRAY_EQ(e, x);
+
+    // Quantizing the dequantized values gives back the original values.
+    EXPECT_ARRAY_EQ(q, Quantize(x, scale, zero_point, Dtype::kInt8, 1));
+}
+
+TEST_F(QuantizationTest, QuantizeInvalid) {
+    Array x = Zeros({2, 3}, Dtype::kFloat32);
+    EXPECT_THROW(Quantize(x, Full({}, 1.0f), Full({}, 0), Dtype::kInt32), DtypeError);
+    EXPECT_THROW(Quantize(x, Full({3}, 1.0f), Full({3}, 0), Dtype::kInt8), DimensionError);
+    EXPECT_THROW(Quantize(x, Full({3}, 1.0f), Full({3}, 0), Dtype::kInt8, 0), DimensionError);
+    EXPECT_THROW(Dequantize(x, Full({}, 1.0f), Full({}, 0)), DtypeError);
+}
+
+template <typename A>
+void CheckQuantizedDot(int64_t m, int64_t k, int64_t n) {
+    std::vector<A> a_data = PseudoRandomData<A>(m * k, 1);
+    std::vector<int8_t> b_data = PseudoRandomData<int8_t>(k * n, 2);
+    int32_t za = std::is_signed<A>::value ? -3 : 131;
+    std::vector<int32_t> zb(n);
+    std::vector<int32_t> bias(n);
+    std::vector<float> multiplier(n);
+    for (int64_t j = 0; j < n; ++j) {
+        zb[j] = static_cast<int32_t>(j % 7) - 3;
+        bias[j] = static_cast<int32_t>(j * 1001) - 5000;
+        multiplier[j] = 1.0f / static_cast<float>(1024 + 64 * j);
+    }
+
+    std::vector<int32_t> expected(m * n);
+    std::vector<int8_t> expected_requantized(m * n);
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            int64_t acc = bias[j];
+            for (int64_t l = 0; l < k; ++l) {
+                acc += (int64_t{a_data[i * k + l]} - za) * (int64_t{b_data[l * n + j]} - zb[j]);
+            }
+            expected[i * n + j] = static_cast<int32_t>(acc);
+            double r = std::nearbyint(static_cast<double>(acc) * multiplier[j]) + 5;
+            expected_requantized[i * n + j] = static_cast<int8_t>(std::min(127.0, std::max(-128.0, r)));
+        }
+    }
+
+    Array a = testing::BuildArray({m, k}).WithData<A>(a_data).WithPadding(1);
+    // Use a transposed view to check non-contiguous operands.
+    std::vector<int8_t> b_transposed_data(k * n);
+    for (int64_t l = 0; l < k; ++l) {
+        for (int64_t j = 0; j < n; ++j) {
+            b_transposed_data[j * k + l] = b_data[l * n + j];
+        }
+    }
+    Array b = testing::BuildArray({n, k}).WithData<int8_t>(b_transposed_data).Build().Transpose();
+    Array za_array = Full({}, za);
+    Array zb_array = testing::BuildArray({n}).WithData<int32_t>(zb);
+    Array bias_array = testing::BuildArray({n}).WithData<int32_t>(bias);
+    Array multiplier_array = testing::BuildArray({n}).WithData<float>(multiplier);
+
+    Array out = QuantizedDot(a, za_array, b, zb_array, bias_array);
+    EXPECT_EQ(Dtype::kInt32, out.dtype());
+    EXPECT_ARRAY_EQ(testing::BuildArray({m, n}).WithData<int32_t>(expected), out);
+
+    Array requantized = QuantizedDot(a, za_array, b, zb_array, bias_array, multiplier_array, Full({}, int32_t{5}), Dtype::kInt8);
+    EXPECT_ARRAY_EQ(testing::BuildArray({m, n}).WithData<int8_t>(expected_requantized), requantized);
+}
+
+TEST_F(QuantizationTest, QuantizedDotInt8) {
+    CheckQuantizedDot<int8_t>(1, 1, 1);
+    CheckQuantizedDot<int8_t>(4, 16, 16);
+    CheckQuantizedDot<int8_t>(9, 37, 21);
+}
+
+TEST_F(QuantizationTest, QuantizedDotUInt8) {
+    CheckQuantizedDot<uint8_t>(3, 5, 2);
+    CheckQuantizedDot<uint8_t>(13, 70, 33);
+}
+
+TEST_F(QuantizationTest, QuantizedDotPerTensorZeroPoint) {
+    Array a = testing::BuildArray({2, 3}).WithData<uint8_t>({1, 2, 3, 4, 5, 6});
+    Array b = testing::BuildArray({3, 2}).WithData<int8_t>({1, -1, 2, -2, 3, -3});
+    Array out = QuantizedDot(a, Full({}, 1), b, Full({}, -1));
+    // (a - 1) . (b + 1)
+    Array e = testing::BuildArray({2, 2}).WithData<int32_t>({11, -5, 38, -14});
+    EXPECT_ARRAY_EQ(e, out);
+}
+
+TEST_F(QuantizationTest, QuantizedDotInvalid) {
+    Array a = Zeros({2, 3}, Dtype::kInt8);
+    Array b = Zeros({3, 4}, Dtype::kInt8);
+    EXPECT_THROW(QuantizedDot(a, Full({}, 0), b.AsType(Dtype::kUInt8), Full({}, 0)), DtypeError);
+    EXPECT_THROW(QuantizedDot(a.AsType(Dtype::kInt16), Full({}, 0), b, Full({}, 0)), DtypeError);
+    EXPECT_THROW(QuantizedDot(a, Full({}, 0), b.Transpose(), Full({}, 0)), DimensionError);
+    EXPECT_THROW(QuantizedDot(a, Full({}, 0), b, Full({3}, 0)), DimensionError);
+    EXPECT_THROW(QuantizedDot(a, Full({}, 0), b, Full({}, 0), Zeros({3}, Dtype::kInt32)), DimensionError);
+    EXPECT_THROW(QuantizedDot(a, Full({}, 0), b, Full({}, 0), nonstd::nullopt, Full({}, 1.0f), Full({}, 0), Dtype::kInt32), DtypeError);
+
+    // Zero points out of the ranges of the dtypes
+    EXPECT_THROW(QuantizedDot(a, Full({}, 128), b, Full({}, 0)), ChainerxError);
+    EXPECT_THROW(QuantizedDot(a.AsType(Dtype::kUInt8), Full({}, -1), b, Full({}, 0)), ChainerxError);
+    EXPECT_THROW(QuantizedDot(a, Full({}, 0), b, testing::BuildArray({4}).WithData<int32_t>({0, 1, -129, 2})), ChainerxError);
+    EXPECT_THROW(
+            QuantizedDot(a, Full({}, 0), b, Full({}, 0), nonstd::nullopt, Full({}, 1.0f), Full({}, 256), Dtype::kUInt8), ChainerxError);
+    Array x = Zeros({1, 3, 2, 2}, Dtype::kInt8);
+    Array w = Zeros({4, 3, 1, 1}, Dtype::kInt8);
+    EXPECT_THROW(QuantizedConv(x, Full({}, -129), w, Full({}, 0), nonstd::nullopt, {1, 1}, {0, 0}), ChainerxError);
+}
+
+TEST_F(QuantizationTest, QuantizedDotSaturated) {
+    // Each product is 255 * (-128 - 127), and their sum exceeds the range of int32.
+    int64_t k = 40000;
+    Array a = Full({1, k}, 255, Dtype::kUInt8);
+    Array b = Full({k, 2}, -128, Dtype::kInt8);
+    Array out = QuantizedDot(a, Full({}, 0), b, testing::BuildArray({2}).WithData<int32_t>({127, -128}));
+    Array e = testing::BuildArray({1, 2}).WithData<int32_t>({std::numeric_limits<int32_t>::min(), 0});
+    EXPECT_ARRAY_EQ(e, out);
+}
+
+TEST_F(QuantizationTest, QuantizedConv) {
+    int64_t batch_size = 2;
+    int64_t in_channels = 3;
+    int64_t out_channels = 5;
+    Shape x_shape{batch_size, in_channels, 6, 5};
+    Shape w_shape{out_channels, in_channels, 3, 2};
+    Dims stride{2, 1};
+    Dims pad{1, 1};
+    int32_t zx = 7;
+
+    Array x = testing::BuildArray(x_shape).WithData<uint8_t>(PseudoRandomData<uint8_t>(x_shape.GetTotalSize(), 3));
+    Array w = testing::BuildArray(w_shape).WithData<int8_t>(PseudoRandomData<int8_t>(w_shape.GetTotalSize(), 4));
+    Array zw = testing::BuildArray({out_channels}).WithData<int32_t>({-2, -1, 0, 1, 2});
+    Array bias = testing::BuildArray({out_channels}).WithData<int32_t>({10, 20, 30, 40, 50});
+
+    // The reference subtracts the zero points in double precision, where the products and sums are exact, so that the padding of the
+    // quantized input corresponds to zeros.
+    Array x_real = x.AsType(Dtype::kFloat64) - Full({}, static_cast<double>(zx));
+    Array w_real = w.AsType(Dtype::kFloat64) - zw.AsType(Dtype::kFloat64).Reshape({out_channels, 1, 1, 1});
+    Array expected = Conv(x_real, w_real, bias.AsType(Dtype::kFloat64), stride, pad).AsType(Dtype::kInt32);
+
+    Array out = QuantizedConv(x, Full({}, zx), w, zw, bias, stride, pad);
+    EXPECT_EQ(Dtype::kInt32, out.dtype());
+    EXPECT_ARRAY_EQ(expected, out);
+
+    Array multiplier = Full({}, 1.0f / 256);
+    Array requantized = QuantizedConv(x, Full({}, zx), w, zw, bias, stride, pad, multiplier, Full({}, 128), Dtype::kUInt8);
+    Array expected_requantized = Quantize(expected, Full({}, 256.0f), Full({}, 128), Dtype::kUInt8);
+    EXPECT_ARRAY_EQ(expected_requantized, requantized);
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <initializer_list>
 #include <memory>
+#include <utility>
 
 #include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 namespace internal {
@@ -49,6 +54,20 @@ void MakeViewForForwardBackwardOutput(std::array<Array, N>& outputs) {
 
 inline void MakeViewForForwardBackwardOutput(Array& output) { output = output.MakeView(); }
 
+// Returns true if the buffer of a temporary array `x` can be reused as the output of an elementwise op of the given shape and dtype.
+//
+// The array must be contiguous and solely own its body and data, so that no other array observes the overwrite. Further, none of the
+// inputs may require grad, since the backward of the op could otherwise retain the overwritten input.
+inline bool IsDonatable(
+        const Array& x, const Shape& shape, Dtype dtype, std::initializer_list<std::reference_wrapper<const Array>> inputs) {
+    const std::shared_ptr<ArrayBody>& x_body = internal::GetArrayBody(x);
+    if (x.shape() != shape || x.dtype() != dtype || !x.IsContiguous() || x_body.use_count() != 1 || x.data().use_count() != 1 ||
+        !x_body->nodes().empty()) {
+        return false;
+    }
+    return std::none_of(inputs.begin(), inputs.end(), [](const Array& input) { return input.IsBackpropRequired(AnyGraph{}); });
+}
+
 // Called from Add, Subtract, Multiply, Divide, etc. to handle broadcasting.
 template <typename Impl>
 Array BroadcastBinary(Impl&& impl, const Array& x1, const Array& x2, Dtype dtype) {
@@ -71,6 +90,16 @@ Array BroadcastBinary(Impl&& impl, const Array& x1, const Array& x2, Dtype dtype
     return func(x1.BroadcastTo(result_shape), x2.BroadcastTo(result_shape));
 }
 
+// Same as above, except that the output is written into the buffer of the temporary `x1` if possible.
+template <typename Impl>
+Array BroadcastBinary(Impl&& impl, Array&& x1, const Array& x2, Dtype dtype) {
+    if (IsDonatable(x1, internal::BroadcastShapes(x1.shape(), x2.shape()), dtype, {x1, x2})) {
+        impl(x1, x1.shape() == x2.shape() ? x2 : x2.BroadcastTo(x1.shape()), x1);
+        return std::move(x1);
+    }
+    return BroadcastBinary(std::forward<Impl>(impl), static_cast<const Array&>(x1), x2, dtype);
+}
+
 // Called from IAdd, ISubtract, IMultiply, IDivide, etc. to handle broadcasting.
 template <typename Impl>
 void BroadcastBinaryInplace(Impl&& impl, const Array& x1, const Array& x2) {
@@ -89,6 +118,16 @@ Array Binary(Impl&& impl, const Array& x1, Scalar x2, Dtype dtype) {
     return out;
 }
 
+// Same as above, except that the output is written into the buffer of the temporary `x1` if possible.
+template <typename Impl>
+Array Binary(Impl&& impl, Array&& x1, Scalar x2, Dtype dtype) {
+    if (IsDonatable(x1, x1.shape(), dtype, {x1})) {
+        impl(x1, x2, x1);
+        return std::move(x1);
+    }
+    return Binary(std::forward<Impl>(impl), static_cast<const Array&>(x1), x2, dtype);
+}
+
 template <typename Impl>
 Array Binary(Impl&& impl, Scalar x1, const Array& x2, Dtype dtype) {
     Array out = Empty(x2.shape(), dtype, x2.device());
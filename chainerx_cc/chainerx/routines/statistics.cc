@@ -1,12 +1,14 @@
 #include "chainerx/routines/statistics.h"
 
+#include <algorithm>
+
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
-
 #include "chainerx/backprop_mode.h"
 #include "chainerx/backward.h"
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
+#include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/kernels/arithmetic.h"
 #include "chainerx/kernels/reduction.h"
@@ -15,6 +17,7 @@
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/type_util.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 
@@ -145,12 +148,51 @@ Array Mean(const Array& a, const OptionalAxes& axis, bool keepdims) {
 }
 
 Array Var(const Array& a, const OptionalAxes& axis, bool keepdims) {
-    // TODO(hvy): Consider allowing device implementations.
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
-    Dtype mean_out = PromoteInt2Float(a.dtype());
-    // TODO(kshitij12345): remove once subtract allows mixed types.
-    Array diff = a.AsType(mean_out, true) - Mean(a, sorted_axis, true);
-    return Mean(diff * diff, sorted_axis, keepdims);
+    Dtype out_dtype = PromoteInt2Float(a.dtype());
+    Array out = internal::EmptyReduced(a.shape(), out_dtype, sorted_axis, keepdims, a.device());
+
+    {
+        NoBackpropModeScope scope{};
+        a.device().backend().CallKernel<VarKernel>(a, sorted_axis, out);
+    }
+
+    BackwardBuilder bb{"var", a, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([a_tok = bb.RetainInput(0), sorted_axis, keepdims](BackwardContext& bctx) {
+            const Array& a = bctx.GetRetainedInput(a_tok);
+            const Array& gout = *bctx.output_grad();
+            CHAINERX_ASSERT(std::is_sorted(sorted_axis.begin(), sorted_axis.end()));
+
+            // The deviations are recomputed from the retained input, so that the gradient is differentiable.
+            // TODO(kshitij12345): remove AsType once subtract allows mixed types.
+            Array diff = a.AsType(gout.dtype(), false) - Mean(a, sorted_axis, true);
+            Array reshaped_gout = keepdims ? gout : gout.Reshape(internal::ReduceShape(a.shape(), sorted_axis, true));
+            Scalar n = internal::CountItemsAlongAxes(a.shape(), sorted_axis);
+            bctx.input_grad() = 2 * reshaped_gout * diff / n;
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+void GenericMeanVarKernel::Call(const Array& a, const Axes& axis, const Array& mean, const Array& var) {
+    Device& device = a.device();
+    Scalar n = internal::CountItemsAlongAxes(a.shape(), axis);
+    device.backend().CallKernel<SumKernel>(a, axis, mean);
+    device.backend().CallKernel<DivideASKernel>(mean, n, mean);
+
+    // TODO(kshitij12345): remove AsType once subtract allows mixed types.
+    Array diff = a.AsType(mean.dtype(), false) - mean.Reshape(internal::ReduceShape(a.shape(), axis, true));
+    device.backend().CallKernel<MultiplyKernel>(diff, diff, diff);
+    device.backend().CallKernel<SumKernel>(diff, axis, var);
+    device.backend().CallKernel<DivideASKernel>(var, n, var);
+}
+
+void GenericVarKernel::Call(const Array& a, const Axes& axis, const Array& out) {
+    Array mean = internal::Empty(out.shape(), out.dtype(), out.strides(), a.device());
+    GenericMeanVarKernel{}.Call(a, axis, mean, out);
 }
 
 }  // namespace chainerx
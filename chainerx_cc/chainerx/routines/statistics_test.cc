@@ -3,6 +3,7 @@
 #include "chainerx/routines/statistics.h"
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <string>
 #include <vector>
@@ -12,10 +13,13 @@
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
+#include "chainerx/backend.h"
 #include "chainerx/check_backward.h"
+#include "chainerx/device.h"
 #include "chainerx/device_id.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
+#include "chainerx/kernels/statistics.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/scalar.h"
 #include "chainerx/testing/array.h"
@@ -243,6 +247,30 @@ TEST_THREAD_SAFE_P(StatisticsTest, VarKeepDims) {
     });
 }
 
+TEST_THREAD_SAFE_P(StatisticsTest, VarLargeOffset) {
+    using T = float;
+
+    // The squared mean dominates the mean of the squares, which cancel each other out if the variance is computed from them.
+    std::vector<T> data;
+    for (int64_t i = 0; i < 0x10000; ++i) {
+        data.emplace_back(10000.0f + static_cast<T>(i % 4));
+    }
+    Array a = testing::BuildArray({0x10000}).WithData<T>(data);
+    Array e = testing::BuildArray({}).WithData<T>({1.25f});
+
+    Run([&]() { testing::CheckForward([](const std::vector<Array>& xs) { return std::vector<Array>{Var(xs[0])}; }, {a}, {e}); });
+}
+
+TEST_P(StatisticsTest, MeanVarKernel) {
+    Array a = testing::BuildArray({2, 3, 4}).WithLinearData<int32_t>().WithPadding(1);
+    Array mean = internal::EmptyReduced(a.shape(), Dtype::kFloat64, Axes{0, 2}, true, a.device());
+    Array var = internal::EmptyReduced(a.shape(), Dtype::kFloat64, Axes{0, 2}, true, a.device());
+    a.device().backend().CallKernel<MeanVarKernel>(a, Axes{0, 2}, mean, var);
+
+    EXPECT_ARRAY_EQ(testing::BuildArray({1, 3, 1}).WithData<double>({7.5, 11.5, 15.5}), mean);
+    EXPECT_ARRAY_EQ(testing::BuildArray({1, 3, 1}).WithData<double>({37.25, 37.25, 37.25}), var);
+}
+
 TEST_P(StatisticsTest, InvalidVarDuplicateAxes) {
     using T = float;
 
@@ -21,22 +21,23 @@ TEST(DtypeTest, GetDefaultDtype) {
 }
 
 // Declares necessary variables and runs a set of checks.
-#define CHECK_RESULT_TYPE_IMPL(check_body)           \
-    {                                                \
-        testing::ContextSession context_session;     \
-        Array Ab = Empty({2, 3}, Dtype::kBool);      \
-        Array Au8 = Empty({2, 3}, Dtype::kUInt8);    \
-        Array Ai8 = Empty({2, 3}, Dtype::kInt8);     \
-        Array Ai16 = Empty({2, 3}, Dtype::kInt16);   \
-        Array Ai32 = Empty({2, 3}, Dtype::kInt32);   \
-        Array Ai64 = Empty({2, 3}, Dtype::kInt64);   \
-        Array Af16 = Empty({2, 3}, Dtype::kFloat16); \
-        Array Af32 = Empty({2, 3}, Dtype::kFloat32); \
-        Array Af64 = Empty({2, 3}, Dtype::kFloat64); \
-        Scalar Sb{bool{1}};                          \
-        Scalar Si{int64_t{1}};                       \
-        Scalar Sf{double{1}};                        \
-        check_body;                                  \
+#define CHECK_RESULT_TYPE_IMPL(check_body)             \
+    {                                                  \
+        testing::ContextSession context_session;       \
+        Array Ab = Empty({2, 3}, Dtype::kBool);        \
+        Array Au8 = Empty({2, 3}, Dtype::kUInt8);      \
+        Array Ai8 = Empty({2, 3}, Dtype::kInt8);       \
+        Array Ai16 = Empty({2, 3}, Dtype::kInt16);     \
+        Array Ai32 = Empty({2, 3}, Dtype::kInt32);     \
+        Array Ai64 = Empty({2, 3}, Dtype::kInt64);     \
+        Array Af16 = Empty({2, 3}, Dtype::kFloat16);   \
+        Array Abf16 = Empty({2, 3}, Dtype::kBFloat16); \
+        Array Af32 = Empty({2, 3}, Dtype::kFloat32);   \
+        Array Af64 = Empty({2, 3}, Dtype::kFloat64);   \
+        Scalar Sb{bool{1}};                            \
+        Scalar Si{int64_t{1}};                         \
+        Scalar Sf{double{1}};                          \
+        check_body;                                    \
     }
 
 // Checks ResultType: static-length 1-arg call
@@ -70,6 +71,7 @@ TEST(ResultTypeTest, NoArgs) {
 TEST(ResultTypeTest, One) {
     CHECK_RESULT_TYPE1(Ab);
     CHECK_RESULT_TYPE1(Af16);
+    CHECK_RESULT_TYPE1(Abf16);
     CHECK_RESULT_TYPE1(Af32);
     CHECK_RESULT_TYPE1(Af64);
     CHECK_RESULT_TYPE1(Ai8);
@@ -90,6 +92,19 @@ TEST(ResultTypeTest, TwoFloat) {
     CHECK_RESULT_TYPE2(Float64, Af32, Af64);
 }
 
+TEST(ResultTypeTest, TwoBFloat16) {
+    CHECK_RESULT_TYPE2(BFloat16, Abf16, Abf16);
+    CHECK_RESULT_TYPE2(Float32, Abf16, Af32);
+    CHECK_RESULT_TYPE2(Float64, Abf16, Af64);
+    // Neither float16 nor bfloat16 can represent the other.
+    CHECK_RESULT_TYPE2(Float32, Abf16, Af16);
+    CHECK_RESULT_TYPE2(BFloat16, Ai8, Abf16);
+    CHECK_RESULT_TYPE2(BFloat16, Ab, Abf16);
+    CHECK_RESULT_TYPE2(BFloat16, Abf16, Sf);
+    CHECK_RESULT_TYPE3(Float32, Abf16, Af16, Ai32);
+    CHECK_RESULT_TYPE3(Float64, Abf16, Af16, Af64);
+}
+
 TEST(ResultTypeTest, TwoSignedInt) {
     CHECK_RESULT_TYPE2(Int8, Ai8, Ai8);
     CHECK_RESULT_TYPE2(Int16, Ai8, Ai16);
@@ -0,0 +1,92 @@
+#include "chainerx/row_sparse_grad.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/indexing.h"
+#include "chainerx/macro.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+RowSparseGrad::RowSparseGrad(const Array& indices, const Array& values, int8_t axis, Shape shape)
+    : axis_{axis}, shape_{std::move(shape)}, dtype_{values.dtype()}, device_{&values.device()} {
+    CHAINERX_ASSERT(0 <= axis_ && axis_ < shape_.ndim());
+    CHAINERX_ASSERT(GetKind(indices.dtype()) == DtypeKind::kInt || GetKind(indices.dtype()) == DtypeKind::kUInt);
+    CHAINERX_ASSERT(values.ndim() == shape_.ndim() + indices.ndim() - 1);
+    CHAINERX_ASSERT(internal::GetArrayBody(values)->nodes().empty());
+
+    // The indices are flattened so that blocks can be concatenated along the axis.
+    int64_t index_count = indices.GetTotalSize();
+    Shape values_shape = shape_;
+    values_shape[axis_] = index_count;
+    indices_blocks_.emplace_back(indices.Reshape({index_count}));
+    values_blocks_.emplace_back(values.Reshape(values_shape));
+}
+
+int64_t RowSparseGrad::row_count() const {
+    int64_t count = 0;
+    for (const Array& indices : indices_blocks_) {
+        count += indices.GetTotalSize();
+    }
+    return count;
+}
+
+Array RowSparseGrad::indices() const {
+    if (indices_blocks_.size() == 1) {
+        return indices_blocks_.front();
+    }
+    NoBackpropModeScope scope{};
+    if (std::all_of(indices_blocks_.begin(), indices_blocks_.end(), [this](const Array& indices) {
+            return indices.dtype() == indices_blocks_.front().dtype();
+        })) {
+        return Concatenate(indices_blocks_, 0);
+    }
+    std::vector<Array> indices_cast;
+    indices_cast.reserve(indices_blocks_.size());
+    for (const Array& indices : indices_blocks_) {
+        indices_cast.emplace_back(indices.AsType(Dtype::kInt64, false));
+    }
+    return Concatenate(indices_cast, 0);
+}
+
+Array RowSparseGrad::values() const {
+    if (values_blocks_.size() == 1) {
+        return values_blocks_.front();
+    }
+    NoBackpropModeScope scope{};
+    return Concatenate(values_blocks_, axis_);
+}
+
+void RowSparseGrad::Merge(const RowSparseGrad& other) {
+    CHAINERX_ASSERT(shape_ == other.shape_);
+    CHAINERX_ASSERT(axis_ == other.axis_);
+    CHAINERX_ASSERT(dtype_ == other.dtype_);
+    CHAINERX_ASSERT(device_ == other.device_);
+    indices_blocks_.insert(indices_blocks_.end(), other.indices_blocks_.begin(), other.indices_blocks_.end());
+    values_blocks_.insert(values_blocks_.end(), other.values_blocks_.begin(), other.values_blocks_.end());
+}
+
+void RowSparseGrad::AddTo(const Array& dense) const {
+    CHAINERX_ASSERT(dense.shape() == shape_);
+    CHAINERX_ASSERT(dense.dtype() == dtype_);
+    for (size_t i = 0; i < indices_blocks_.size(); ++i) {
+        dense.device().backend().CallKernel<AddAtKernel>(dense, indices_blocks_[i], axis_, values_blocks_[i], dense);
+    }
+}
+
+Array RowSparseGrad::ToDense() const {
+    Array dense = Zeros(shape_, dtype_, *device_);
+    AddTo(dense);
+    return dense;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+// Gradient which is non-zero only in some rows along an axis, e.g. the gradient of an embedding table with respect to a lookup by Take.
+//
+// It is represented by the indices of the rows and a dense block of their values, so that memory usage and the cost of accumulation are
+// proportional to the number of touched rows rather than the size of the whole table. Indices may be duplicated, in which case the
+// corresponding rows are summed up on densification.
+//
+// It is not differentiable. Backward functions should emit it only if higher order gradients are not required.
+class RowSparseGrad {
+public:
+    // `values` must have the same shape as `shape` except that the dimension `axis` is replaced by the shape of `indices`, as in the output
+    // of Take(Zeros(shape), indices, axis).
+    RowSparseGrad(const Array& indices, const Array& values, int8_t axis, Shape shape);
+
+    int8_t axis() const { return axis_; }
+
+    // Returns the shape of the dense gradient.
+    const Shape& shape() const { return shape_; }
+
+    Dtype dtype() const { return dtype_; }
+
+    Device& device() const { return *device_; }
+
+    // Returns the number of rows, including duplicates.
+    int64_t row_count() const;
+
+    // Returns the 1-dimensional array of the row indices.
+    Array indices() const;
+
+    // Returns the values of the rows, whose dimension `axis` corresponds to the indices.
+    Array values() const;
+
+    // Appends the rows of another row-sparse gradient with the same dense shape and axis.
+    // The rows are not copied until indices() or values() is called, so that repeated merges take linear time in total.
+    void Merge(const RowSparseGrad& other);
+
+    // Adds the rows to a dense array in-place.
+    void AddTo(const Array& dense) const;
+
+    // Returns the dense gradient.
+    Array ToDense() const;
+
+private:
+    // Blocks of the indices and the values, which are concatenated on demand.
+    std::vector<Array> indices_blocks_;
+    std::vector<Array> values_blocks_;
+    int8_t axis_;
+    Shape shape_;
+    Dtype dtype_;
+    Device* device_;
+};
+
+}  // namespace chainerx
@@ -0,0 +1,72 @@
+#include "chainerx/row_sparse_grad.h"
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/dtype.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+TEST(RowSparseGradTest, Ctor) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    Array indices = testing::BuildArray({2, 2}).WithData<int64_t>({0, 2, 2, -1});
+    Array values = testing::BuildArray({2, 2, 2}).WithLinearData<float>();
+    RowSparseGrad grad{indices, values, 0, Shape{3, 2}};
+
+    EXPECT_EQ(0, grad.axis());
+    EXPECT_EQ(Shape({3, 2}), grad.shape());
+    EXPECT_EQ(Dtype::kFloat32, grad.dtype());
+    EXPECT_EQ(&device_session.device(), &grad.device());
+    EXPECT_EQ(4, grad.row_count());
+
+    // The indices are flattened.
+    EXPECT_ARRAY_EQ(testing::BuildArray({4}).WithData<int64_t>({0, 2, 2, -1}), grad.indices());
+    EXPECT_ARRAY_EQ(testing::BuildArray({4, 2}).WithLinearData<float>(), grad.values());
+}
+
+TEST(RowSparseGradTest, ToDense) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    Array indices = testing::BuildArray({3}).WithData<int32_t>({2, 0, 2});
+    Array values = testing::BuildArray({2, 3}).WithLinearData<float>();
+    RowSparseGrad grad{indices, values, 1, Shape{2, 4}};
+
+    // Duplicate indices are summed up.
+    EXPECT_ARRAY_EQ(testing::BuildArray({2, 4}).WithData<float>({1, 0, 2, 0, 4, 0, 8, 0}), grad.ToDense());
+}
+
+TEST(RowSparseGradTest, AddTo) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    Array dense = testing::BuildArray({3, 2}).WithLinearData<float>();
+    RowSparseGrad grad{testing::BuildArray({1}).WithData<int64_t>({1}), testing::BuildArray({1, 2}).WithData<float>({10, 20}), 0, Shape{3, 2}};
+
+    grad.AddTo(dense);
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 2}).WithData<float>({0, 1, 12, 23, 4, 5}), dense);
+}
+
+TEST(RowSparseGradTest, Merge) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    Shape shape{3, 2};
+    RowSparseGrad grad{testing::BuildArray({2}).WithData<int64_t>({0, 1}), testing::BuildArray({2, 2}).WithLinearData<float>(), 0, shape};
+    RowSparseGrad other{testing::BuildArray({1}).WithData<int32_t>({1}), testing::BuildArray({1, 2}).WithData<float>({10, 20}), 0, shape};
+
+    grad.Merge(other);
+    EXPECT_EQ(3, grad.row_count());
+
+    // Indices of different dtypes are concatenated as int64.
+    EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<int64_t>({0, 1, 1}), grad.indices());
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 2}).WithData<float>({0, 1, 2, 3, 10, 20}), grad.values());
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<float>({0, 1, 12, 23, 0, 0}), grad.ToDense());
+
+    // The merged gradient is not affected.
+    EXPECT_EQ(1, other.row_count());
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -4,6 +4,7 @@
 #include <ostream>
 #include <string>
 
+#include "chainerx/bfloat16.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/float16.h"
@@ -25,6 +26,7 @@ public:
     Scalar(uint16_t v) : int_{int64_t{v}}, kind_{DtypeKind::kInt} {}  // NOLINT
     Scalar(uint32_t v) : int_{int64_t{v}}, kind_{DtypeKind::kInt} {}  // NOLINT
     Scalar(Float16 v) : float_{static_cast<double>(v)}, kind_{DtypeKind::kFloat} {}  // NOLINT
+    Scalar(BFloat16 v) : float_{static_cast<double>(v)}, kind_{DtypeKind::kFloat} {}  // NOLINT
     Scalar(float v) : float_{double{v}}, kind_{DtypeKind::kFloat} {}  // NOLINT
     Scalar(double v) : float_{v}, kind_{DtypeKind::kFloat} {}  // NOLINT
 
@@ -94,6 +96,7 @@ public:
     explicit operator int64_t() const { return UnwrapAndCast<int64_t>(); }
     explicit operator uint8_t() const { return UnwrapAndCast<uint8_t>(); }
     explicit operator Float16() const { return UnwrapAndCast<Float16>(); }
+    explicit operator BFloat16() const { return UnwrapAndCast<BFloat16>(); }
     explicit operator float() const { return UnwrapAndCast<float>(); }
     explicit operator double() const { return UnwrapAndCast<double>(); }
 
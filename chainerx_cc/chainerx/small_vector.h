@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "chainerx/macro.h"
+
+namespace chainerx {
+
+// Vector-like container which stores up to N elements in an inline buffer and falls back to heap allocation beyond that.
+//
+// Unlike StackVector, the number of elements is not limited and the element type can be non-trivial (e.g. std::shared_ptr).
+// It is meant for small sequences that are created very frequently, where the heap allocation of std::vector is dominant.
+// Note that iterators and references are invalidated not only on reallocation but also when the container itself is moved.
+// Not all features in std::vector are implemented.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "SmallVector requires a positive inline capacity.");
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+
+    SmallVector() = default;
+
+    ~SmallVector() {
+        clear();
+        ReleaseHeap();
+    }
+
+    explicit SmallVector(size_type count) { resize(count); }
+
+    SmallVector(size_type count, const T& value) {
+        reserve(count);
+        for (size_type i = 0; i < count; ++i) {
+            emplace_back(value);
+        }
+    }
+
+    template <typename InputIter, typename = typename std::iterator_traits<InputIter>::iterator_category>
+    SmallVector(InputIter first, InputIter last) {
+        for (InputIter it = first; it != last; ++it) {
+            emplace_back(*it);
+        }
+    }
+
+    SmallVector(std::initializer_list<T> list) : SmallVector{list.begin(), list.end()} {}
+
+    SmallVector(const SmallVector& other) : SmallVector{other.begin(), other.end()} {}
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) { MoveFrom(std::move(other)); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            for (const T& value : other) {
+                emplace_back(value);
+            }
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            ReleaseHeap();
+            MoveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    bool operator==(const SmallVector& rhs) const { return size_ == rhs.size_ && std::equal(begin(), end(), rhs.begin()); }
+    bool operator!=(const SmallVector& rhs) const { return !operator==(rhs); }
+
+    const_reference operator[](size_type index) const {
+        CHAINERX_ASSERT(index < size_);
+        return data_[index];
+    }
+
+    reference operator[](size_type index) {
+        CHAINERX_ASSERT(index < size_);
+        return data_[index];
+    }
+
+    // iterators
+    iterator begin() noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+    const_iterator cbegin() const noexcept { return data_; }
+    const_iterator cend() const noexcept { return data_ + size_; }
+
+    // reverse iterators
+    reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+    reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
+
+    size_type size() const noexcept { return size_; }
+
+    size_type capacity() const noexcept { return capacity_; }
+
+    // Returns true if the elements are stored in the inline buffer.
+    bool is_inline() const noexcept { return data_ == InlineData(); }
+
+    value_type* data() noexcept { return data_; }
+
+    const value_type* data() const noexcept { return data_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    void clear() noexcept {
+        for (size_type i = 0; i < size_; ++i) {
+            data_[i].~T();
+        }
+        size_ = 0;
+    }
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+        for (size_type i = 0; i < size_; ++i) {
+            new (new_data + i) T(std::move_if_noexcept(data_[i]));
+            data_[i].~T();
+        }
+        ReleaseHeap();
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    void resize(size_type count) {
+        if (count < size_) {
+            for (size_type i = count; i < size_; ++i) {
+                data_[i].~T();
+            }
+            size_ = count;
+            return;
+        }
+        reserve(count);
+        while (size_ < count) {
+            emplace_back();
+        }
+    }
+
+    reference front() {
+        CHAINERX_ASSERT(size_ > 0);
+        return data_[0];
+    }
+
+    const_reference front() const {
+        CHAINERX_ASSERT(size_ > 0);
+        return data_[0];
+    }
+
+    reference back() {
+        CHAINERX_ASSERT(size_ > 0);
+        return data_[size_ - 1];
+    }
+
+    const_reference back() const {
+        CHAINERX_ASSERT(size_ > 0);
+        return data_[size_ - 1];
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            // The new element is constructed before relocation, since the arguments may refer to the existing elements.
+            size_type new_capacity = std::max(capacity_ * 2, size_ + 1);
+            T* new_data = static_cast<T*>(::operator new(new_capacity * sizeof(T)));
+            new (new_data + size_) T(std::forward<Args>(args)...);
+            for (size_type i = 0; i < size_; ++i) {
+                new (new_data + i) T(std::move_if_noexcept(data_[i]));
+                data_[i].~T();
+            }
+            ReleaseHeap();
+            data_ = new_data;
+            capacity_ = new_capacity;
+        } else {
+            new (data_ + size_) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() {
+        CHAINERX_ASSERT(size_ > 0);
+        data_[--size_].~T();
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        CHAINERX_ASSERT(cbegin() <= first && first <= last && last <= cend());
+        iterator it_first = begin() + (first - cbegin());
+        iterator it_last = begin() + (last - cbegin());
+        iterator new_end = std::move(it_last, end(), it_first);
+        resize(static_cast<size_type>(new_end - begin()));
+        return it_first;
+    }
+
+private:
+    using InlineStorage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    T* InlineData() noexcept { return reinterpret_cast<T*>(&inline_storage_[0]); }  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    const T* InlineData() const noexcept {
+        return reinterpret_cast<const T*>(&inline_storage_[0]);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    // Frees the heap buffer, if any, and resets to the inline buffer. Elements must have been destroyed or relocated.
+    void ReleaseHeap() noexcept {
+        if (!is_inline()) {
+            ::operator delete(data_);
+            data_ = InlineData();
+            capacity_ = N;
+        }
+    }
+
+    // Takes the elements of the other container, which is left empty. This container must be empty and inline.
+    void MoveFrom(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        CHAINERX_ASSERT(size_ == 0 && is_inline());
+        if (other.is_inline()) {
+            for (size_type i = 0; i < other.size_; ++i) {
+                new (data_ + i) T(std::move(other.data_[i]));
+            }
+            size_ = other.size_;
+            other.clear();
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.InlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+
+    InlineStorage inline_storage_[N];  // NOLINT(modernize-avoid-c-arrays)
+    T* data_{InlineData()};
+    size_type size_{0};
+    size_type capacity_{N};
+};
+
+}  // namespace chainerx
@@ -0,0 +1,147 @@
+#include "chainerx/small_vector.h"
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace {
+
+static_assert(
+        std::is_same<std::iterator_traits<SmallVector<int, 2>::iterator>::iterator_category, std::random_access_iterator_tag>::value, "");
+
+TEST(SmallVectorTest, Operations) {
+    using Vector = SmallVector<int, 2>;
+    Vector vec{};
+    EXPECT_EQ(size_t{0}, vec.size());
+    EXPECT_EQ(size_t{2}, vec.capacity());
+    EXPECT_TRUE(vec.empty());
+    EXPECT_TRUE(vec.is_inline());
+
+    vec.emplace_back(4);
+    vec.push_back(3);
+    EXPECT_EQ(size_t{2}, vec.size());
+    EXPECT_TRUE(vec.is_inline());
+
+    // Grows beyond the inline capacity.
+    vec.emplace_back(-1);
+    vec.emplace_back(5);
+    EXPECT_EQ(size_t{4}, vec.size());
+    EXPECT_FALSE(vec.is_inline());
+    EXPECT_EQ(4, vec[0]);
+    EXPECT_EQ(3, vec[1]);
+    EXPECT_EQ(-1, vec[2]);
+    EXPECT_EQ(5, vec[3]);
+    EXPECT_EQ(4, vec.front());
+    EXPECT_EQ(5, vec.back());
+
+    Vector vec2{4, 3, -1, 5};
+    EXPECT_EQ(vec2, vec);
+    vec2[1] = 2;
+    EXPECT_NE(vec2, vec);
+
+    // erase
+    vec.erase(vec.begin() + 1);
+    EXPECT_EQ((Vector{4, -1, 5}), vec);
+    vec.erase(vec.begin(), vec.begin() + 2);
+    EXPECT_EQ((Vector{5}), vec);
+
+    // pop_back / clear
+    vec.pop_back();
+    EXPECT_TRUE(vec.empty());
+    vec2.clear();
+    EXPECT_TRUE(vec2.empty());
+
+    // resize
+    vec.resize(3);
+    EXPECT_EQ((Vector{0, 0, 0}), vec);
+    vec.resize(1);
+    EXPECT_EQ((Vector{0}), vec);
+}
+
+TEST(SmallVectorTest, Iterators) {
+    SmallVector<int, 2> vec{1, 2, 3};
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), (std::vector<int>{vec.begin(), vec.end()}));
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), (std::vector<int>{vec.rbegin(), vec.rend()}));
+
+    const SmallVector<int, 2>& cvec = vec;
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), (std::vector<int>{cvec.begin(), cvec.end()}));
+}
+
+TEST(SmallVectorTest, NonTrivialElements) {
+    std::shared_ptr<int> p = std::make_shared<int>(1);
+    {
+        SmallVector<std::shared_ptr<int>, 1> vec{};
+        vec.emplace_back(p);
+        vec.emplace_back(p);
+        vec.emplace_back(p);
+        EXPECT_EQ(4, p.use_count());
+        vec.pop_back();
+        EXPECT_EQ(3, p.use_count());
+    }
+    // Elements must be destroyed with the container.
+    EXPECT_EQ(1, p.use_count());
+}
+
+TEST(SmallVectorTest, MoveOnlyElements) {
+    SmallVector<std::unique_ptr<int>, 2> vec{};
+    for (int i = 0; i < 5; ++i) {
+        vec.emplace_back(std::make_unique<int>(i));
+    }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(i, *vec[i]);
+    }
+}
+
+TEST(SmallVectorTest, EmplaceBackReferringToElement) {
+    SmallVector<std::string, 2> vec{"a", "b"};
+    // The argument refers to an element which is relocated by the reallocation.
+    vec.emplace_back(vec[0]);
+    EXPECT_EQ((SmallVector<std::string, 2>{"a", "b", "a"}), vec);
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+    for (size_t n : {size_t{1}, size_t{5}}) {
+        SmallVector<std::string, 2> vec{};
+        for (size_t i = 0; i < n; ++i) {
+            vec.emplace_back(std::to_string(i));
+        }
+
+        // copy
+        SmallVector<std::string, 2> vec2{vec};
+        EXPECT_EQ(vec, vec2);
+        SmallVector<std::string, 2> vec3{};
+        vec3 = vec;
+        EXPECT_EQ(vec, vec3);
+
+        // move
+        SmallVector<std::string, 2> vec4{std::move(vec2)};
+        EXPECT_EQ(vec, vec4);
+        EXPECT_TRUE(vec2.empty());  // NOLINT(bugprone-use-after-move)
+        SmallVector<std::string, 2> vec5{"x"};
+        vec5 = std::move(vec3);
+        EXPECT_EQ(vec, vec5);
+        EXPECT_TRUE(vec3.empty());  // NOLINT(bugprone-use-after-move)
+        EXPECT_EQ(n <= 2, vec5.is_inline());
+
+        // The moved-from container can be reused.
+        vec3.emplace_back("y");
+        EXPECT_EQ((SmallVector<std::string, 2>{"y"}), vec3);
+    }
+}
+
+TEST(SmallVectorTest, Reserve) {
+    SmallVector<int, 2> vec{1};
+    vec.reserve(10);
+    EXPECT_EQ(size_t{10}, vec.capacity());
+    EXPECT_FALSE(vec.is_inline());
+    EXPECT_EQ((SmallVector<int, 2>{1}), vec);
+}
+
+}  // namespace
+}  // namespace chainerx
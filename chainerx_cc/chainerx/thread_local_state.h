@@ -13,6 +13,8 @@ struct InternalThreadLocalState {
     Context* default_context;
     Device* default_device;
     internal::BackpropModeStack backprop_mode_stack;
+    internal::BackpropModeCache backprop_mode_cache;
+    bool inference_mode;
 };
 
 InternalThreadLocalState& GetInternalThreadLocalState();
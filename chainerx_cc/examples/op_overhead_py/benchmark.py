@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+# Measures the per-call overhead of frequently used operators on tiny arrays,
+# where the cost of the Python binding dominates the computation.
+
+import argparse
+import timeit
+
+import chainerx as chx
+
+
+def get_cases(device):
+    a = chx.ones((2, 3), chx.float32, device=device)
+    b = chx.ones((2, 3), chx.float32, device=device)
+    return [
+        ('a + b', lambda: a + b),
+        ('a + 1.0', lambda: a + 1.0),
+        ('a * b', lambda: a * b),
+        ('a * 2', lambda: a * 2),
+        ('a[0]', lambda: a[0]),
+        ('a[:, 1:]', lambda: a[:, 1:]),
+        ('a.reshape((3, 2))', lambda: a.reshape((3, 2))),
+        ('a.reshape(3, 2)', lambda: a.reshape(3, 2)),
+        ('a.sum()', lambda: a.sum()),
+        ('a.sum(axis=1)', lambda: a.sum(axis=1)),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        'Per-op overhead benchmark of ChainerX Python binding')
+    parser.add_argument('--device', default='native',
+                        help='Device to run the operators on')
+    parser.add_argument('--number', type=int, default=100000,
+                        help='Number of calls per measurement')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='Number of measurements per operator')
+    args = parser.parse_args()
+
+    for name, func in get_cases(args.device):
+        func()  # warm-up
+        elapsed = min(timeit.repeat(
+            func, number=args.number, repeat=args.repeat))
+        print('{:<20} {:8.3f} us/call'.format(
+            name, elapsed / args.number * 1e6))
+
+
+if __name__ == '__main__':
+    main()
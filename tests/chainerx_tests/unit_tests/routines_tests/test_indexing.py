@@ -157,6 +157,10 @@ def test_getitem_zero_sized_offsets(device):
     ((2, 3), [1, 2], 1),
     ((2, 3), [2, 1], 1),
     ((2, 3), [[0], [1]], 0),
+    ((5, 2, 3), [4, 0, 2, 2, -1], 0),
+    ((2, 5, 3), [[1, 4], [0, -5]], 1),
+    ((2, 3, 5), [1, 4, 4], 2),
+    ((3, 4), [[2, 2], [2, -2]], 0),
     # Invalid: Axis out of bounds
     ((2, 3), [0], 2),
     ((2, 3), [0], -3),
@@ -135,3 +135,51 @@ class TestHuberLoss(LossBase):
         else:
             out = xp.huber_loss(x, t, self.delta, reduce='no')
         return out,
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    chainer.testing.product({
+        'shape': [(2, 3), (5, 4)],
+        'dtype': ['float32', 'float64'],
+        'use_class_weight': [False, True],
+        'ignore_label': [-1, 2],
+    })
+))
+class TestSoftmaxCrossEntropy(op_utils.ChainerOpTest):
+
+    # The native kernel differentiates its gradient only with respect to the
+    # upstream gradient. On CUDA, the loss is composed of array routines.
+    skip_double_backward_test = True
+
+    def setup(self):
+        n, c = self.shape
+        self.t = numpy.random.randint(0, c, (n,)).astype(numpy.int32)
+        self.t[0] = self.ignore_label
+        if self.use_class_weight:
+            self.class_weight = numpy.random.uniform(
+                0.5, 2, (c,)).astype(self.dtype)
+        else:
+            self.class_weight = None
+        if self.dtype == 'float32':
+            self.check_forward_options.update({'rtol': 1e-4, 'atol': 1e-5})
+            self.check_backward_options.update({'rtol': 1e-3, 'atol': 1e-3})
+
+    def generate_inputs(self):
+        x = numpy.random.uniform(-1, 1, self.shape).astype(self.dtype)
+        return x,
+
+    def forward_chainerx(self, inputs):
+        x, = inputs
+        t = chainerx.array(self.t, device=x.device)
+        class_weight = None
+        if self.class_weight is not None:
+            class_weight = chainerx.array(self.class_weight, device=x.device)
+        return chainerx.softmax_cross_entropy(
+            x, t, class_weight, self.ignore_label),
+
+    def forward_chainer(self, inputs):
+        x, = inputs
+        return F.softmax_cross_entropy(
+            x, self.t, class_weight=self.class_weight,
+            ignore_label=self.ignore_label, reduce='no'),
@@ -0,0 +1,112 @@
+import numpy
+import pytest
+
+import chainerx
+import chainerx.testing
+
+
+_shapes = [(2, 3), (4,), ()]
+
+
+def _make_arrays(dtype, seed):
+    numpy.random.seed(seed)
+    return [numpy.random.uniform(-1, 1, shape).astype(dtype)
+            for shape in _shapes]
+
+
+def _to_chainerx(arrays):
+    return [chainerx.array(a) for a in arrays]
+
+
+def _assert_allclose(expected, actual, dtype):
+    tol = 1e-3 if dtype == 'float16' else 1e-6
+    for e, a in zip(expected, actual):
+        chainerx.testing.assert_allclose(e, a, rtol=tol, atol=tol)
+
+
+# On backends without the fused kernels, the updates are composed of array
+# routines, which must give the same results.
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+@pytest.mark.parametrize('dtype', ['float16', 'float32', 'float64'])
+def test_sgd_update(device, dtype):
+    params = _make_arrays(dtype, 0)
+    grads = _make_arrays(dtype, 1)
+    lr = 0.1
+    expected = [p - lr * g for p, g in zip(params, grads)]
+
+    params = _to_chainerx(params)
+    chainerx.sgd_update(params, _to_chainerx(grads), lr)
+    _assert_allclose(expected, params, dtype)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+@pytest.mark.parametrize('dtype', ['float16', 'float32', 'float64'])
+def test_momentum_sgd_update(device, dtype):
+    params = _make_arrays(dtype, 0)
+    grads = _make_arrays(dtype, 1)
+    velocities = _make_arrays(dtype, 2)
+    lr = 0.1
+    momentum = 0.9
+    expected_velocities = [
+        momentum * v - lr * g for v, g in zip(velocities, grads)]
+    expected_params = [p + v for p, v in zip(params, expected_velocities)]
+
+    params = _to_chainerx(params)
+    velocities = _to_chainerx(velocities)
+    chainerx.momentum_sgd_update(
+        params, _to_chainerx(grads), velocities, lr, momentum)
+    _assert_allclose(expected_velocities, velocities, dtype)
+    _assert_allclose(expected_params, params, dtype)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+@pytest.mark.parametrize('dtype', ['float32', 'float64'])
+def test_adam_update(device, dtype):
+    params = _make_arrays(dtype, 0)
+    grads = _make_arrays(dtype, 1)
+    ms = _make_arrays(dtype, 2)
+    vs = [numpy.abs(v) for v in _make_arrays(dtype, 3)]
+    t = 3
+    alpha = 0.001
+    beta1 = 0.9
+    beta2 = 0.999
+    eps = 1e-8
+    weight_decay_rate = 0.01
+    alpha_t = alpha * numpy.sqrt(1 - beta2 ** t) / (1 - beta1 ** t)
+    expected_ms = [m + (1 - beta1) * (g - m) for m, g in zip(ms, grads)]
+    expected_vs = [v + (1 - beta2) * (g * g - v) for v, g in zip(vs, grads)]
+    expected_params = [
+        p - (alpha_t * m / (numpy.sqrt(v) + eps) + weight_decay_rate * p)
+        for p, m, v in zip(params, expected_ms, expected_vs)]
+
+    params = _to_chainerx(params)
+    ms = _to_chainerx(ms)
+    vs = _to_chainerx(vs)
+    chainerx.adam_update(
+        params, _to_chainerx(grads), ms, vs, t, alpha, beta1, beta2, eps,
+        weight_decay_rate)
+    _assert_allclose(expected_ms, ms, dtype)
+    _assert_allclose(expected_vs, vs, dtype)
+    _assert_allclose(expected_params, params, dtype)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_sgd_update_params_requiring_grad(device):
+    # The update is not recorded in the graph of the parameter.
+    param = chainerx.ones((2, 3), 'float32').require_grad()
+    grad = chainerx.ones((2, 3), 'float32')
+    chainerx.sgd_update([param], [grad], 0.5)
+    chainerx.testing.assert_allclose(
+        numpy.full((2, 3), 0.5, 'float32'), param)
+    assert param.is_grad_required()
+
+
+def test_update_invalid():
+    param = chainerx.ones((2, 3), 'float32')
+    with pytest.raises(chainerx.ChainerxError):
+        chainerx.sgd_update([param], [], 0.1)
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.sgd_update([param], [chainerx.ones((3,), 'float32')], 0.1)
+    with pytest.raises(chainerx.ChainerxError):
+        chainerx.adam_update(
+            [param], [param.copy()], [param.copy()], [param.copy()], 0)
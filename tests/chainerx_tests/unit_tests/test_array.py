@@ -730,3 +730,35 @@ def test_is_chained():
 
     arr2 = 2 * arr
     assert arr2._is_chained()
+
+
+@pytest.mark.parametrize('rhs,rhs_value', [
+    (chainerx.full((2,), 3, chainerx.float32), 3),
+    (3.0, 3),
+    (3, 3),
+    (True, 1),
+    (numpy.float32(3), 3),
+    (numpy.int64(3), 3),
+])
+def test_add_mul_operand_types(rhs, rhs_value):
+    arr = chainerx.array([1, 2], chainerx.float32)
+    chainerx.testing.assert_array_equal(
+        arr + rhs, numpy.array([1 + rhs_value, 2 + rhs_value], numpy.float32))
+    chainerx.testing.assert_array_equal(
+        arr * rhs, numpy.array([rhs_value, 2 * rhs_value], numpy.float32))
+
+
+@pytest.mark.parametrize('rhs', ['a', None, object(), 2 ** 64])
+def test_add_mul_invalid_operand(rhs):
+    arr = chainerx.array([1, 2], chainerx.float32)
+    with pytest.raises(TypeError):
+        arr + rhs
+    with pytest.raises(TypeError):
+        arr * rhs
+
+
+@pytest.mark.parametrize('axis', ['a', 1.5, (0, 'a')])
+def test_sum_invalid_axis_type(axis):
+    arr = chainerx.array([1, 2], chainerx.float32)
+    with pytest.raises(TypeError):
+        arr.sum(axis=axis)
@@ -30,7 +30,7 @@ def test_incorrect_backward_unary():
         _check_backward_unary(fprop)
 
 
-def _check_backward_binary(fprop):
+def _check_backward_binary(fprop, **kwargs):
     chainerx.check_backward(
         fprop,
         (chainerx.array([1, -2, 1], chainerx.float32).require_grad(),
@@ -38,6 +38,7 @@ def _check_backward_binary(fprop):
         (chainerx.array([1, -2, 3], chainerx.float32),),
         (chainerx.full((3,), 1e-3, chainerx.float32),
          chainerx.full((3,), 1e-3, chainerx.float32)),
+        **kwargs
     )
 
 
@@ -45,6 +46,17 @@ def test_correct_backward_binary():
     _check_backward_binary(lambda xs: (xs[0] * xs[1],))
 
 
+@pytest.mark.parametrize('elementwise,parallel', [
+    (True, False),
+    (False, True),
+])
+def test_correct_backward_binary_elementwise_or_parallel(
+        elementwise, parallel):
+    _check_backward_binary(
+        lambda xs: (xs[0] * xs[1],), elementwise=elementwise,
+        parallel=parallel)
+
+
 def test_incorrect_backward_binary():
     # See the comment of test_incorrect_backward_unary().
     def fprop(xs):
@@ -52,6 +64,8 @@ def test_incorrect_backward_binary():
         return (x * y).as_grad_stopped() + x + y,
     with pytest.raises(chainerx.GradientCheckError):
         _check_backward_binary(fprop)
+    with pytest.raises(chainerx.GradientCheckError):
+        _check_backward_binary(fprop, elementwise=True)
 
 
 def test_correct_double_backward_unary():
@@ -81,3 +95,26 @@ def test_correct_double_backward_binary():
         1e-4,
         1e-3,
     )
+
+
+@pytest.mark.parametrize('elementwise,parallel', [
+    (True, False),
+    (False, True),
+])
+def test_correct_double_backward_binary_elementwise_or_parallel(
+        elementwise, parallel):
+    chainerx.check_double_backward(
+        lambda xs: (xs[0] * xs[1],),
+        (chainerx.array([1, 2, 3], chainerx.float32).require_grad(),
+         chainerx.ones((3,), chainerx.float32).require_grad()),
+        (chainerx.ones((3,), chainerx.float32).require_grad(),),
+        (chainerx.ones((3,), chainerx.float32),
+         chainerx.ones((3,), chainerx.float32)),
+        (chainerx.full((3,), 1e-3, chainerx.float32),
+         chainerx.full((3,), 1e-3, chainerx.float32),
+         chainerx.full((3,), 1e-3, chainerx.float32)),
+        1e-4,
+        1e-3,
+        elementwise=elementwise,
+        parallel=parallel,
+    )
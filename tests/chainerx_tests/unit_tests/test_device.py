@@ -1,6 +1,7 @@
 import copy
 import pickle
 
+import numpy
 import pytest
 
 import chainerx
@@ -65,6 +66,25 @@ def test_synchronize():
     device.synchronize()
 
 
+def test_synchronize_async_with_numpy_memory(monkeypatch):
+    # Pending kernels may hold the last references to NumPy memory wrapped
+    # without copies, whose release requires the GIL held by the caller.
+    monkeypatch.setenv('CHAINERX_NATIVE_ASYNC', '1')
+    ctx = chainerx.Context()
+    device = ctx.get_device('native', 0)
+    with chainerx.using_device(device):
+        for _ in range(100):
+            x = numpy.arange(1000, dtype=numpy.float32)
+            assert float((chainerx.asarray(x) * 2).sum()) == x.sum() * 2
+
+        y = chainerx.asarray(numpy.ones((2, 3), numpy.float32)) + 1
+        device.synchronize()
+        numpy.testing.assert_array_equal(chainerx.to_numpy(y), 2)
+        assert y[0, 0].item() == 2
+        # Arrays are released before the context.
+        del y
+
+
 @pytest.mark.usefixtures('cache_restore_device')
 def test_default_device(device_instance1):
     device = device_instance1
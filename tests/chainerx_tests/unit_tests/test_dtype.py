@@ -1,4 +1,8 @@
+import subprocess
+import sys
+
 import numpy
+import pytest
 
 import chainerx
 
@@ -20,3 +24,52 @@ def test_dtypes():
     assert chainerx.float16 is numpy.float16
     assert chainerx.float32 is numpy.float32
     assert chainerx.float64 is numpy.float64
+
+
+@pytest.mark.parametrize('dtype_spec', ['bfloat16', chainerx.bfloat16])
+def test_bfloat16_array(dtype_spec):
+    a = chainerx.ones((2,), dtype_spec)
+    assert a.dtype == 'bfloat16'
+    assert a.dtype.name == 'bfloat16'
+    assert a.dtype.itemsize == 2
+    assert 'bfloat16' in repr(a)
+    assert chainerx.ones((2,), a.dtype).dtype == a.dtype
+
+
+def test_bfloat16_with_ml_dtypes():
+    ml_dtypes = pytest.importorskip('ml_dtypes')
+    assert chainerx.bfloat16 is ml_dtypes.bfloat16
+    a = chainerx.ones((2,), 'bfloat16')
+    assert a.dtype == numpy.dtype(ml_dtypes.bfloat16)
+    numpy.testing.assert_array_equal(
+        chainerx.to_numpy(a).astype(numpy.float32),
+        numpy.ones((2,), numpy.float32))
+
+
+# Runs in a subprocess, as the availability of ml_dtypes is determined when
+# ChainerX is imported.
+_without_ml_dtypes_code = '''
+import sys
+sys.modules['ml_dtypes'] = None
+
+import chainerx
+
+a = chainerx.ones((2,), chainerx.bfloat16)
+assert a.dtype is chainerx.bfloat16
+assert a.dtype == 'bfloat16'
+assert a.dtype != 'float16'
+assert hash(a.dtype) == hash('bfloat16')
+assert repr(a.dtype) == "dtype('bfloat16')"
+assert 'bfloat16' in repr(a)
+assert a.astype(chainerx.float32).dtype == chainerx.float32
+try:
+    chainerx.to_numpy(a)
+except chainerx.DtypeError:
+    pass
+else:
+    assert False
+'''
+
+
+def test_bfloat16_without_ml_dtypes():
+    subprocess.check_call([sys.executable, '-c', _without_ml_dtypes_code])
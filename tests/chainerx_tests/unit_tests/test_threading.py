@@ -0,0 +1,75 @@
+import threading
+
+import numpy
+import pytest
+
+import chainerx
+import chainerx.testing
+
+
+def _run_threads(func, n_threads=4):
+    # Runs func(thread_index) in multiple threads and returns the results.
+    results = [None] * n_threads
+    errors = []
+
+    def target(i):
+        try:
+            results[i] = func(i)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [
+        threading.Thread(target=target, args=(i,)) for i in range(n_threads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    if errors:
+        raise errors[0]
+    return results
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_routines_multithread(device):
+    a_np = numpy.arange(64 * 32, dtype=numpy.float32).reshape(64, 32)
+    b_np = numpy.arange(32 * 16, dtype=numpy.float32).reshape(32, 16)
+    a = chainerx.array(a_np)
+    b = chainerx.array(b_np)
+
+    def func(i):
+        y = chainerx.dot(a, b) * (i + 1)
+        return chainerx.sum(y, axis=1).astype(chainerx.float64)
+
+    expected = a_np.dot(b_np).sum(axis=1).astype(numpy.float64)
+    for i, y in enumerate(_run_threads(func)):
+        chainerx.testing.assert_allclose(y, expected * (i + 1))
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_backward_multithread(device):
+    def func(i):
+        x = chainerx.full((3, 2), i, chainerx.float32, device=device)
+        x.require_grad()
+        y = chainerx.sum(x * x)
+        y.backward()
+        return x.grad
+
+    for i, gx in enumerate(_run_threads(func)):
+        chainerx.testing.assert_array_equal(
+            gx, numpy.full((3, 2), 2 * i, numpy.float32))
+
+
+def test_release_numpy_backed_array_without_gil():
+    # The last reference to the NumPy array is released during the backward,
+    # which runs without the GIL.
+    def func(i):
+        x = chainerx.asarray(
+            numpy.full((3,), i, numpy.float32), device='native:0')
+        x.require_grad()
+        y = chainerx.sum(x * x)
+        del x
+        y.backward()
+        return y
+
+    for i, y in enumerate(_run_threads(func)):
+        assert float(y) == 3 * i * i